@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_API_HANDLERS_H
+#define ZENOH_PICO_API_HANDLERS_H
+
+#include <stdint.h>
+
+#include "zenoh-pico/api/types.h"
+#include "zenoh-pico/collections/ring_mt.h"
+#include "zenoh-pico/config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if Z_FEATURE_MULTI_THREAD == 1
+/**
+ * Represents a channel, a built-in handler buffering the samples, replies or queries received by the ``send`` closure
+ * in a bounded ring, for another thread to receive them.
+ *
+ * The ``send`` closure is meant to be moved into the entity producing the elements, e.g. ``z_declare_subscriber``,
+ * ``z_get`` or ``z_declare_queryable``. The channel is closed when that entity drops the closure, or when the channel
+ * itself is dropped.
+ *
+ * While the ring is full, a FIFO channel makes ``send`` wait for some room, and a ring channel drops its oldest
+ * element to make room for the new one.
+ *
+ * Operations over a channel must be done using the provided functions, ``X`` being ``sample``, ``reply`` or ``query``.
+ * The reply channels require ``Z_FEATURE_QUERY`` and the query channels ``Z_FEATURE_QUERYABLE``:
+ *
+ *   - ``z_owned_fifo_channel_X_t z_fifo_channel_X_new(size_t capacity);``
+ *   - ``int8_t z_fifo_channel_X_recv(const z_owned_fifo_channel_X_t *channel, z_owned_X_t *elem);``
+ *   - ``int8_t z_fifo_channel_X_try_recv(const z_owned_fifo_channel_X_t *channel, z_owned_X_t *elem);``
+ *
+ * ``recv`` waits for an element while the channel is empty, whereas ``try_recv`` returns
+ * ``_Z_ERR_CHANNEL_EMPTY`` straight away. Both return ``_Z_ERR_CHANNEL_CLOSED`` once the channel is closed and the
+ * elements left in it have all been received.
+ *
+ * Members:
+ *   z_owned_closure_X_t send: The closure pushing the elements into the channel.
+ */
+#define _Z_CHANNEL_DECLARE(kind, name)                                                                               \
+    typedef struct {                                                                                                 \
+        z_owned_closure_##name##_t send;                                                                             \
+        _z_ring_mt_t *_ring;                                                                                         \
+    } z_owned_##kind##_channel_##name##_t;                                                                           \
+                                                                                                                     \
+    z_owned_##kind##_channel_##name##_t z_##kind##_channel_##name##_new(size_t capacity);                            \
+    int8_t z_##kind##_channel_##name##_recv(const z_owned_##kind##_channel_##name##_t *channel,                      \
+                                            z_owned_##name##_t *e);                                                  \
+    int8_t z_##kind##_channel_##name##_try_recv(const z_owned_##kind##_channel_##name##_t *channel,                  \
+                                                z_owned_##name##_t *e);                                              \
+    _Bool z_##kind##_channel_##name##_check(const z_owned_##kind##_channel_##name##_t *channel);                     \
+    z_owned_##kind##_channel_##name##_t *z_##kind##_channel_##name##_move(z_owned_##kind##_channel_##name##_t *ch);  \
+    void z_##kind##_channel_##name##_drop(z_owned_##kind##_channel_##name##_t *channel);                             \
+    z_owned_##kind##_channel_##name##_t z_##kind##_channel_##name##_null(void);
+
+_Z_CHANNEL_DECLARE(fifo, sample)
+_Z_CHANNEL_DECLARE(ring, sample)
+#if Z_FEATURE_QUERY == 1
+_Z_CHANNEL_DECLARE(fifo, reply)
+_Z_CHANNEL_DECLARE(ring, reply)
+#endif
+#if Z_FEATURE_QUERYABLE == 1
+_Z_CHANNEL_DECLARE(fifo, query)
+_Z_CHANNEL_DECLARE(ring, query)
+#endif
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_API_HANDLERS_H */
@@ -14,6 +14,7 @@
 #ifndef ZENOH_PICO_API_MACROS_H
 #define ZENOH_PICO_API_MACROS_H
 
+#include "zenoh-pico/api/handlers.h"
 #include "zenoh-pico/api/primitives.h"
 #include "zenoh-pico/api/types.h"
 
@@ -23,6 +24,32 @@
 
 // clang-format off
 
+#if Z_FEATURE_MULTI_THREAD == 1
+#define _z_channel_sample_generic(ref, f) \
+                  z_owned_fifo_channel_sample_t ref : z_fifo_channel_sample_##f,      \
+                  z_owned_ring_channel_sample_t ref : z_ring_channel_sample_##f,
+#else
+#define _z_channel_sample_generic(ref, f)
+#endif
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_QUERY == 1
+#define _z_channel_reply_generic(ref, f) \
+                  z_owned_fifo_channel_reply_t ref : z_fifo_channel_reply_##f,        \
+                  z_owned_ring_channel_reply_t ref : z_ring_channel_reply_##f,
+#else
+#define _z_channel_reply_generic(ref, f)
+#endif
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_QUERYABLE == 1
+#define _z_channel_query_generic(ref, f) \
+                  z_owned_fifo_channel_query_t ref : z_fifo_channel_query_##f,        \
+                  z_owned_ring_channel_query_t ref : z_ring_channel_query_##f,
+#else
+#define _z_channel_query_generic(ref, f)
+#endif
+#define _z_channel_generic(ref, f) \
+                  _z_channel_sample_generic(ref, f)                                   \
+                  _z_channel_reply_generic(ref, f)                                    \
+                  _z_channel_query_generic(ref, f)
+
 /**
  * Defines a generic function for loaning any of the ``z_owned_X_t`` types.
  *
@@ -41,6 +68,8 @@
                   z_owned_pull_subscriber_t : z_pull_subscriber_loan, \
                   z_owned_publisher_t : z_publisher_loan,             \
                   z_owned_reply_t : z_reply_loan,                     \
+                  z_owned_sample_t : z_sample_loan,                   \
+                  z_owned_query_t : z_query_loan,                     \
                   z_owned_hello_t : z_hello_loan,                     \
                   z_owned_str_t : z_str_loan,                         \
                   z_owned_str_array_t : z_str_array_loan              \
@@ -61,6 +90,9 @@
                   z_owned_publisher_t * : z_publisher_drop,                         \
                   z_owned_queryable_t * : z_queryable_drop,                         \
                   z_owned_reply_t * : z_reply_drop,                                 \
+                  z_owned_sample_t * : z_sample_drop,                               \
+                  z_owned_query_t * : z_query_drop,                                 \
+                  _z_channel_generic(*, drop)                                       \
                   z_owned_hello_t * : z_hello_drop,                                 \
                   z_owned_str_t * : z_str_drop,                                     \
                   z_owned_str_array_t * : z_str_array_drop,                         \
@@ -87,6 +119,9 @@
                   z_owned_subscriber_t * : z_subscriber_null,                       \
                   z_owned_queryable_t * : z_queryable_null,                         \
                   z_owned_reply_t * : z_reply_null,                                 \
+                  z_owned_sample_t * : z_sample_null,                               \
+                  z_owned_query_t * : z_query_null,                                 \
+                  _z_channel_generic(*, null)                                       \
                   z_owned_hello_t * : z_hello_null,                                 \
                   z_owned_str_t * : z_str_null,                                     \
                   z_owned_closure_sample_t * : z_closure_sample_null,               \
@@ -117,6 +152,9 @@
                   z_owned_publisher_t : z_publisher_check,             \
                   z_owned_queryable_t : z_queryable_check,             \
                   z_owned_reply_t : z_reply_check,                     \
+                  z_owned_sample_t : z_sample_check,                   \
+                  z_owned_query_t : z_query_check,                     \
+                  _z_channel_generic(, check)                          \
                   z_owned_hello_t : z_hello_check,                     \
                   z_owned_str_t : z_str_check,                         \
                   z_owned_str_array_t : z_str_array_check,             \
@@ -156,6 +194,9 @@
                   z_owned_publisher_t : z_publisher_move,             \
                   z_owned_queryable_t : z_queryable_move,             \
                   z_owned_reply_t : z_reply_move,                     \
+                  z_owned_sample_t : z_sample_move,                   \
+                  z_owned_query_t : z_query_move,                     \
+                  _z_channel_generic(, move)                          \
                   z_owned_hello_t : z_hello_move,                     \
                   z_owned_str_t : z_str_move,                         \
                   z_owned_str_array_t : z_str_array_move,             \
@@ -184,6 +225,8 @@
                   z_owned_publisher_t : z_publisher_clone,             \
                   z_owned_queryable_t : z_queryable_clone,             \
                   z_owned_reply_t : z_reply_clone,                     \
+                  z_owned_sample_t : z_sample_clone,                   \
+                  z_owned_query_t : z_query_clone,                     \
                   z_owned_hello_t : z_hello_clone,                     \
                   z_owned_str_t : z_str_clone,                         \
                   z_owned_str_array_t : z_str_array_clone              \
@@ -205,6 +248,9 @@
                   z_owned_subscriber_t * : z_subscriber_null,                       \
                   z_owned_queryable_t * : z_queryable_null,                         \
                   z_owned_reply_t * : z_reply_null,                                 \
+                  z_owned_sample_t * : z_sample_null,                               \
+                  z_owned_query_t * : z_query_null,                                 \
+                  _z_channel_generic(*, null)                                       \
                   z_owned_hello_t * : z_hello_null,                                 \
                   z_owned_str_t * : z_str_null,                                     \
                   z_owned_closure_sample_t * : z_closure_sample_null,               \
@@ -244,6 +290,8 @@ template<> struct zenoh_loan_type<z_owned_config_t>{ typedef z_config_t type; };
 template<> struct zenoh_loan_type<z_owned_publisher_t>{ typedef z_publisher_t type; };
 template<> struct zenoh_loan_type<z_owned_pull_subscriber_t>{ typedef z_pull_subscriber_t type; };
 template<> struct zenoh_loan_type<z_owned_hello_t>{ typedef z_hello_t type; };
+template<> struct zenoh_loan_type<z_owned_sample_t>{ typedef z_sample_t type; };
+template<> struct zenoh_loan_type<z_owned_query_t>{ typedef z_query_t type; };
 template<> struct zenoh_loan_type<z_owned_str_t>{  typedef const char* type; };
 
 template<> inline z_session_t z_loan(const z_owned_session_t& x) { return z_session_loan(&x); }
@@ -252,6 +300,8 @@ template<> inline z_config_t z_loan(const z_owned_config_t& x) { return z_config
 template<> inline z_publisher_t z_loan(const z_owned_publisher_t& x) { return z_publisher_loan(&x); }
 template<> inline z_pull_subscriber_t z_loan(const z_owned_pull_subscriber_t& x) { return z_pull_subscriber_loan(&x); }
 template<> inline z_hello_t z_loan(const z_owned_hello_t& x) { return z_hello_loan(&x); }
+template<> inline z_sample_t z_loan(const z_owned_sample_t& x) { return z_sample_loan(&x); }
+template<> inline z_query_t z_loan(const z_owned_query_t& x) { return z_query_loan(&x); }
 template<> inline const char* z_loan(const z_owned_str_t& x) { return z_str_loan(&x); }
 
 template<class T> struct zenoh_drop_type { typedef T type; };
@@ -267,6 +317,8 @@ template<> struct zenoh_drop_type<z_owned_subscriber_t> { typedef int8_t type; }
 template<> struct zenoh_drop_type<z_owned_queryable_t> { typedef int8_t type; };
 template<> struct zenoh_drop_type<z_owned_reply_t> { typedef void type; };
 template<> struct zenoh_drop_type<z_owned_hello_t> { typedef void type; };
+template<> struct zenoh_drop_type<z_owned_sample_t> { typedef void type; };
+template<> struct zenoh_drop_type<z_owned_query_t> { typedef void type; };
 template<> struct zenoh_drop_type<z_owned_str_t> { typedef void type; };
 template<> struct zenoh_drop_type<z_owned_closure_sample_t> { typedef void type; };
 template<> struct zenoh_drop_type<z_owned_closure_query_t> { typedef void type; };
@@ -284,6 +336,8 @@ template<> inline int8_t z_drop(z_owned_subscriber_t* v) { return z_undeclare_su
 template<> inline int8_t z_drop(z_owned_queryable_t* v) { return z_undeclare_queryable(v); }
 template<> inline void z_drop(z_owned_reply_t* v) { z_reply_drop(v); }
 template<> inline void z_drop(z_owned_hello_t* v) { z_hello_drop(v); }
+template<> inline void z_drop(z_owned_sample_t* v) { z_sample_drop(v); }
+template<> inline void z_drop(z_owned_query_t* v) { z_query_drop(v); }
 template<> inline void z_drop(z_owned_str_t* v) { z_str_drop(v); }
 template<> inline void z_drop(z_owned_closure_sample_t* v) { z_closure_sample_drop(v); }
 template<> inline void z_drop(z_owned_closure_query_t* v) { z_closure_query_drop(v); }
@@ -301,6 +355,8 @@ inline void z_null(z_owned_subscriber_t& v) { v = z_subscriber_null(); }
 inline void z_null(z_owned_queryable_t& v) { v = z_queryable_null(); }
 inline void z_null(z_owned_reply_t& v) { v = z_reply_null(); }
 inline void z_null(z_owned_hello_t& v) { v = z_hello_null(); }
+inline void z_null(z_owned_sample_t& v) { v = z_sample_null(); }
+inline void z_null(z_owned_query_t& v) { v = z_query_null(); }
 inline void z_null(z_owned_str_t& v) { v = z_str_null(); }
 inline void z_null(z_owned_closure_sample_t& v) { v = z_closure_sample_null(); }
 inline void z_null(z_owned_closure_query_t& v) { v = z_closure_query_null(); }
@@ -320,6 +376,8 @@ inline bool z_check(const z_owned_pull_subscriber_t& v) { return z_pull_subscrib
 inline bool z_check(const z_owned_queryable_t& v) { return z_queryable_check(&v); }
 inline bool z_check(const z_owned_reply_t& v) { return z_reply_check(&v); }
 inline bool z_check(const z_owned_hello_t& v) { return z_hello_check(&v); }
+inline bool z_check(const z_owned_sample_t& v) { return z_sample_check(&v); }
+inline bool z_check(const z_owned_query_t& v) { return z_query_check(&v); }
 inline bool z_check(const z_owned_str_t& v) { return z_str_check(&v); }
 
 inline void z_call(const z_owned_closure_sample_t &closure, const z_sample_t *sample) 
@@ -332,6 +390,25 @@ inline void z_call(const z_owned_closure_hello_t &closure, z_owned_hello_t *hell
     { z_closure_hello_call(&closure, hello); }
 inline void z_call(const z_owned_closure_zid_t &closure, const z_id_t *zid)
     { z_closure_zid_call(&closure, zid); }
+#if Z_FEATURE_MULTI_THREAD == 1
+#define _z_channel_overloads(kind, name) \
+    template<> struct zenoh_drop_type<z_owned_##kind##_channel_##name##_t> { typedef void type; };                 \
+    template<> inline void z_drop(z_owned_##kind##_channel_##name##_t* v) { z_##kind##_channel_##name##_drop(v); } \
+    inline void z_null(z_owned_##kind##_channel_##name##_t& v) { v = z_##kind##_channel_##name##_null(); }         \
+    inline bool z_check(const z_owned_##kind##_channel_##name##_t& v) { return z_##kind##_channel_##name##_check(&v); }
+
+_z_channel_overloads(fifo, sample)
+_z_channel_overloads(ring, sample)
+#if Z_FEATURE_QUERY == 1
+_z_channel_overloads(fifo, reply)
+_z_channel_overloads(ring, reply)
+#endif
+#if Z_FEATURE_QUERYABLE == 1
+_z_channel_overloads(fifo, query)
+_z_channel_overloads(ring, query)
+#endif
+#endif
+
 // clang-format on
 
 #define _z_closure_overloader(callback, dropper, ctx, ...) \
@@ -693,6 +693,8 @@ _OWNED_FUNCTIONS(z_queryable_t, z_owned_queryable_t, queryable)
 _OWNED_FUNCTIONS(z_hello_t, z_owned_hello_t, hello)
 _OWNED_FUNCTIONS(z_reply_t, z_owned_reply_t, reply)
 _OWNED_FUNCTIONS(z_str_array_t, z_owned_str_array_t, str_array)
+_OWNED_FUNCTIONS(z_sample_t, z_owned_sample_t, sample)
+_OWNED_FUNCTIONS(z_query_t, z_owned_query_t, query)
 
 #define _OWNED_FUNCTIONS_CLOSURE(ownedtype, name) \
     _Bool z_##name##_check(const ownedtype *val); \
@@ -936,6 +938,20 @@ int8_t z_publisher_put(const z_publisher_t pub, const uint8_t *payload, size_t l
  *   Returns ``0`` if the delete operation is successful, or a ``negative value`` otherwise.
  */
 int8_t z_publisher_delete(const z_publisher_t pub, const z_publisher_delete_options_t *options);
+
+/**
+ * Checks whether some subscribers match the keyexpr associated to the given publisher.
+ *
+ * The remote subscribers are the ones declared to the session, they are only tracked if ``Z_FEATURE_INTEREST`` is
+ * enabled, otherwise they are assumed to exist.
+ *
+ * Parameters:
+ *   pub: A loaned instance of :c:type:`z_publisher_t` to check.
+ *
+ * Returns:
+ *   Returns ``true`` if some local or remote subscribers match the publisher, or ``false`` otherwise.
+ */
+_Bool zp_publisher_has_matching_subscribers(const z_publisher_t pub);
 #endif
 
 #if Z_FEATURE_QUERY == 1
@@ -1343,6 +1359,46 @@ int8_t zp_start_lease_task(z_session_t zs, const zp_task_lease_options_t *option
  */
 int8_t zp_stop_lease_task(z_session_t zs);
 
+/**
+ * Constructs the default values for the session TX task.
+ *
+ * Returns:
+ *   Returns the constructed :c:type:`zp_task_tx_options_t`.
+ */
+zp_task_tx_options_t zp_task_tx_options_default(void);
+
+/**
+ * Start a separate task to send the network messages of the session.
+ *
+ * Once started, the publications are pushed into a bounded queue and return without waiting for the transport, the
+ * task sends them in order and batches them when possible. When the queue is full, the messages with
+ * :c:enum:`Z_CONGESTION_CONTROL_DROP` are dropped while the ones with :c:enum:`Z_CONGESTION_CONTROL_BLOCK` wait for
+ * room. Not supported on raw ethernet transports.
+ * Note that the task can be implemented in form of thread, process, etc. and its implementation is platform-dependent.
+ *
+ * Parameters:
+ *   zs: A loaned instance of the the :c:type:`z_session_t` where to start the TX task.
+ *   options: The options to apply when starting the TX task. If ``NULL`` is passed, the default options will be
+ * applied.
+ *
+ * Returns:
+ *   Returns ``0`` if the TX task started successfully, or a ``negative value`` otherwise.
+ */
+int8_t zp_start_tx_task(z_session_t zs, const zp_task_tx_options_t *options);
+
+/**
+ * Stop the TX task, after it has sent the messages submitted so far.
+ *
+ * This may result in stopping a thread or a process depending on the target platform.
+ *
+ * Parameters:
+ *   zs: A loaned instance of the the :c:type:`z_session_t` where to stop the TX task.
+ *
+ * Returns:
+ *   Returns ``0`` if the TX task stopped successfully, or a ``negative value`` otherwise.
+ */
+int8_t zp_stop_tx_task(z_session_t zs);
+
 /************* Single Thread helpers **************/
 /**
  * Constructs the default values for the reading procedure.
@@ -1411,6 +1467,82 @@ zp_send_join_options_t zp_send_join_options_default(void);
  */
 int8_t zp_send_join(z_session_t zs, const zp_send_join_options_t *options);
 
+/************* Batching helpers **************/
+/**
+ * Constructs the default values for the TX batching.
+ *
+ * Returns:
+ *   Returns the constructed :c:type:`zp_batch_options_t`.
+ */
+zp_batch_options_t zp_batch_options_default(void);
+
+/**
+ * Start batching the messages sent on the session.
+ *
+ * Consecutive messages with the same reliability are appended to a single frame instead of being sent one by one.
+ * The batch is sent when it is full, when it has been pending for longer than the configured linger time, or when
+ * :c:func:`zp_flush` is called. The linger time is enforced on the next send and by the lease task, if running.
+ * Batching is only supported on unicast transports.
+ *
+ * Parameters:
+ *   zs: A loaned instance of the the :c:type:`z_session_t` where to start batching.
+ *   options: The options to apply to the batching. If ``NULL`` is passed, the default options will be applied.
+ *
+ * Returns:
+ *   Returns ``0`` if batching started successfully, or a ``negative value`` otherwise.
+ */
+int8_t zp_batch_start(z_session_t zs, const zp_batch_options_t *options);
+
+/**
+ * Stop batching the messages sent on the session, sending the pending batch if any.
+ *
+ * Parameters:
+ *   zs: A loaned instance of the the :c:type:`z_session_t` where to stop batching.
+ *
+ * Returns:
+ *   Returns ``0`` if batching stopped successfully, or a ``negative value`` otherwise.
+ */
+int8_t zp_batch_stop(z_session_t zs);
+
+/**
+ * Send the pending batch of the session, if any.
+ *
+ * Parameters:
+ *   zs: A loaned instance of the the :c:type:`z_session_t` to flush.
+ *
+ * Returns:
+ *   Returns ``0`` if the batch was sent successfully, or a ``negative value`` otherwise.
+ */
+int8_t zp_flush(z_session_t zs);
+
+/************* Memory helpers **************/
+/**
+ * Report the usage of the memory pools serving the allocations of the library, when it is built with
+ * ``Z_FEATURE_MEMORY_POOLS``. The high-water marks tell how many blocks of each size the application needs.
+ *
+ * Parameters:
+ *   stats: The array where to write the usage of the pools, from the smallest blocks to the largest ones.
+ *   len: The number of elements of ``stats``.
+ *
+ * Returns:
+ *   Returns the number of memory pools, ``0`` if the library is built without them. Only the first ``len`` pools are
+ *   reported if there are more of them.
+ */
+size_t zp_memory_stats(zp_memory_pool_stats_t *stats, size_t len);
+
+/**
+ * Replace the allocator serving the allocations of the library, which are otherwise served by the platform, or by the
+ * memory pools when it is built with ``Z_FEATURE_MEMORY_POOLS``. It must be called before any other function of the
+ * library, or once everything it allocated has been released.
+ *
+ * Parameters:
+ *   allocator: Pointer to the allocator to use, or ``NULL`` to restore the default one.
+ *
+ * Returns:
+ *   Returns ``0`` if the allocator is set, or a ``negative value`` if one of its functions is missing.
+ */
+int8_t zp_set_allocator(const zp_allocator_t *allocator);
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,8 @@
 #include "zenoh-pico/net/session.h"
 #include "zenoh-pico/net/subscribe.h"
 #include "zenoh-pico/protocol/core.h"
+#include "zenoh-pico/utils/allocator.h"
+#include "zenoh-pico/utils/pool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -262,10 +264,15 @@ typedef struct {
  *   z_congestion_control_t congestion_control: The congestion control to apply when routing messages from this
  * publisher.
  *   z_priority_t priority: The priority of messages issued by this publisher.
+ *   _Bool skip_unmatched: Whether to skip sending the samples that no remote subscriber declared to the session
+ * matches. Only enable it when the remote nodes declare their subscribers to the session, e.g. between peers.
  */
 typedef struct {
     z_congestion_control_t congestion_control;
     z_priority_t priority;
+#if Z_FEATURE_INTEREST == 1
+    _Bool skip_unmatched;
+#endif
 } z_publisher_options_t;
 
 /**
@@ -389,6 +396,22 @@ typedef struct {
 #endif
 } zp_task_lease_options_t;
 
+/**
+ * Represents the set of options that can be applied to the TX task,
+ * whenever issued via :c:func:`zp_start_tx_task`.
+ *
+ * Members:
+ *   size_t queue_size: The number of network messages the queue of the task can hold.
+ */
+typedef struct {
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_task_attr_t *task_attributes;
+    size_t queue_size;
+#else
+    uint8_t __dummy;  // Just to avoid empty structures that might cause undefined behavior
+#endif
+} zp_task_tx_options_t;
+
 /**
  * Represents the set of options that can be applied to the read operation,
  * whenever issued via :c:func:`zp_read`.
@@ -413,6 +436,41 @@ typedef struct {
     uint8_t __dummy;  // Just to avoid empty structures that might cause undefined behavior
 } zp_send_join_options_t;
 
+/**
+ * Represents the set of options that can be applied to the TX batching,
+ * whenever started via :c:func:`zp_batch_start`.
+ *
+ * Members:
+ *   uint32_t linger_ms: The maximum time in milliseconds a batch can be pending before being sent, ``0`` to only
+ *     send it when full or when :c:func:`zp_flush` is called.
+ */
+typedef struct {
+    uint32_t linger_ms;
+} zp_batch_options_t;
+
+/**
+ * Represents the usage of a memory pool, as reported by :c:func:`zp_memory_stats`.
+ *
+ * Members:
+ *   size_t block_size: The size in bytes of the blocks of the pool.
+ *   size_t blocks: The number of blocks of the pool.
+ *   size_t in_use: The number of blocks currently allocated.
+ *   size_t high_water: The highest number of blocks ever allocated at once.
+ *   size_t misses: The number of allocations fitting in the pool that it could not serve, because it was exhausted.
+ */
+typedef _z_pool_stats_t zp_memory_pool_stats_t;
+
+/**
+ * Represents the allocator serving the allocations of the library, as set by :c:func:`zp_set_allocator`.
+ *
+ * Members:
+ *   void *(*alloc_fn)(size_t size, void *ctx): Allocate ``size`` bytes, ``NULL`` if it fails.
+ *   void *(*realloc_fn)(void *ptr, size_t size, void *ctx): Resize an allocation, ``NULL`` if it fails.
+ *   void (*free_fn)(void *ptr, void *ctx): Release an allocation, or do nothing if ``ptr`` is ``NULL``.
+ *   void *ctx: The context passed to the functions.
+ */
+typedef _z_allocator_t zp_allocator_t;
+
 /**
  * QoS settings of zenoh message.
  */
@@ -453,6 +511,7 @@ static inline z_qos_t z_qos_default(void) { return _Z_N_QOS_DEFAULT; }
  *   z_qos_t qos: Quality of service settings used to deliver this sample.
  */
 typedef _z_sample_t z_sample_t;
+_OWNED_TYPE_PTR(z_sample_t, sample)
 
 /**
  * Represents the content of a `hello` message returned by a zenoh entity as a reply to a `scout` message.
@@ -691,6 +750,51 @@ z_owned_bytes_map_t z_bytes_map_new(void);
  * Constructs the gravestone value for `z_owned_bytes_map_t`
  */
 z_owned_bytes_map_t z_bytes_map_null(void);
+
+/**
+ * An attachment built directly in its wire format: each key and value is appended, prefixed by its length, to a single
+ * growable buffer. Encoding it is then a single copy of that buffer, and its length is known without iterating.
+ *
+ * Unlike `z_owned_bytes_map_t`, keys are not deduplicated: looking a key up returns the value it was first inserted
+ * with. Clearing the builder keeps its buffer, so that it can be reused for the attachment of each sample.
+ */
+typedef struct z_owned_attachment_builder_t {
+    _z_bytes_t _bytes;
+    size_t _capacity;
+} z_owned_attachment_builder_t;
+
+/**
+ * Constructs an empty builder, whose buffer initially holds `capacity` bytes.
+ */
+z_owned_attachment_builder_t z_attachment_builder_new(size_t capacity);
+/**
+ * Constructs the gravestone value for `z_owned_attachment_builder_t`
+ */
+z_owned_attachment_builder_t z_attachment_builder_null(void);
+/**
+ * Returns `true` if the builder is not in its gravestone state
+ */
+bool z_attachment_builder_check(const z_owned_attachment_builder_t *this_);
+/**
+ * Destroys the builder, resetting `this` to its gravestone value.
+ *
+ * This function is double-free safe, passing a pointer to the gravestone value will have no effect.
+ */
+void z_attachment_builder_drop(z_owned_attachment_builder_t *this_);
+/**
+ * Appends `key` and `value`, copying them, growing the buffer if needed.
+ *
+ * Returns `0` if the pair has been appended, or a negative value if the buffer could not grow.
+ */
+int8_t z_attachment_builder_insert(z_owned_attachment_builder_t *this_, z_bytes_t key, z_bytes_t value);
+/**
+ * Removes all the pairs, keeping the buffer for the next ones.
+ */
+void z_attachment_builder_clear(z_owned_attachment_builder_t *this_);
+/**
+ * Aliases `this` into a generic `z_attachment_t`, allowing it to be passed to corresponding APIs.
+ */
+z_attachment_t z_attachment_builder_as_attachment(const z_owned_attachment_builder_t *this_);
 #endif
 
 /**
@@ -40,6 +40,12 @@ _z_bytes_t _z_bytes_make(size_t capacity);
 _z_bytes_t _z_bytes_wrap(const uint8_t *bs, size_t len);
 _z_bytes_t _z_bytes_steal(_z_bytes_t *b);
 
+/**
+ * Makes `bs` point to `len` writable bytes. The storage `bs` currently points to is reused when it holds at least
+ * `len` bytes, so a caller wrapping a scratch buffer avoids the allocation; otherwise `bs` is cleared and allocated.
+ */
+int8_t _z_bytes_reserve(_z_bytes_t *bs, size_t len);
+
 void _z_bytes_copy(_z_bytes_t *dst, const _z_bytes_t *src);
 _z_bytes_t _z_bytes_duplicate(const _z_bytes_t *src);
 void _z_bytes_move(_z_bytes_t *dst, _z_bytes_t *src);
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_COLLECTIONS_KETREE_H
+#define ZENOH_PICO_COLLECTIONS_KETREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/collections/list.h"
+
+/*-------- Key expression tree --------*/
+/**
+ * A node of a key expression tree, holding one chunk of the key expressions that go through it.
+ *
+ * Members:
+ *   char *chunk: the chunk of this node, NULL for the root.
+ *   char *key: the full key expression of the values stored on this node, NULL if there is none.
+ *   size_t key_len: the length of the full key expression.
+ *   _z_ketree_node_t **children: the child nodes, one per distinct next chunk.
+ *   _z_list_t *vals: the values stored on this node. They are not owned by the tree.
+ *   size_t mark: the last query this node has been reported for, to report each node once per query.
+ */
+typedef struct _z_ketree_node_t {
+    char *_chunk;
+    char *_key;
+    size_t _key_len;
+    struct _z_ketree_node_t *_parent;
+    struct _z_ketree_node_t **_children;
+    size_t _children_len;
+    size_t _children_capacity;
+    _z_list_t *_vals;
+    size_t _mark;
+} _z_ketree_node_t;
+
+/**
+ * A tree of key expressions split at chunk level, used to find the values whose key expression intersects a given one
+ * with a cost proportional to the depth of the key expression rather than to the number of values.
+ * Wildcards (``*``, ``**`` and ``$*``) are supported on both sides with the same semantics as
+ * :c:func:`_z_keyexpr_intersects`.
+ *
+ * Members:
+ *   _z_ketree_node_t *root: the root node, NULL if the tree is empty.
+ *   size_t epoch: the number of queries run on the tree.
+ */
+typedef struct {
+    _z_ketree_node_t *_root;
+    size_t _epoch;
+} _z_ketree_t;
+
+typedef void (*_z_ketree_visit_f)(void *val, void *arg);
+
+void _z_ketree_init(_z_ketree_t *tree);
+int8_t _z_ketree_insert(_z_ketree_t *tree, const char *key, void *val);
+_Bool _z_ketree_remove(_z_ketree_t *tree, const char *key, const void *val);
+void _z_ketree_intersecting(_z_ketree_t *tree, const char *key, _z_ketree_visit_f visit, void *arg);
+_Bool _z_ketree_is_empty(const _z_ketree_t *tree);
+void _z_ketree_clear(_z_ketree_t *tree);
+
+#endif /* ZENOH_PICO_COLLECTIONS_KETREE_H */
@@ -16,6 +16,7 @@
 #define ZENOH_PICO_COLLECTIONS_REFCOUNT_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #if Z_FEATURE_MULTI_THREAD == 1
@@ -24,6 +25,7 @@
 #ifndef __cplusplus
 #include <stdatomic.h>
 #define _z_atomic(X) _Atomic X
+#define _z_atomic_load_explicit atomic_load_explicit
 #define _z_atomic_store_explicit atomic_store_explicit
 #define _z_atomic_fetch_add_explicit atomic_fetch_add_explicit
 #define _z_atomic_fetch_sub_explicit atomic_fetch_sub_explicit
@@ -33,6 +35,7 @@
 #else
 #include <atomic>
 #define _z_atomic(X) std::atomic<X>
+#define _z_atomic_load_explicit std::atomic_load_explicit
 #define _z_atomic_store_explicit std::atomic_store_explicit
 #define _z_atomic_fetch_add_explicit std::atomic_fetch_add_explicit
 #define _z_atomic_fetch_sub_explicit std::atomic_fetch_sub_explicit
@@ -48,6 +51,12 @@
 #define _ZP_RC_OP_DECR_AND_CMP _z_atomic_fetch_sub_explicit(&p->in->_cnt, 1, _z_memory_order_release) > 1
 #define _ZP_RC_OP_SYNC atomic_thread_fence(_z_memory_order_acquire);
 
+// c11 atomic variant of a word written under a lock and read without it
+#define _ZP_SHARED_SIZE_TYPE _z_atomic(size_t)
+#define _ZP_SHARED_SIZE_LOAD(x) _z_atomic_load_explicit(&(x), _z_memory_order_acquire)
+#define _ZP_SHARED_SIZE_STORE(x, v) _z_atomic_store_explicit(&(x), (v), _z_memory_order_release)
+#define _ZP_SHARED_SIZE_INCR(x) (void)_z_atomic_fetch_add_explicit(&(x), 1, _z_memory_order_release)
+
 #else  // ZENOH_C_STANDARD == 99
 #ifdef ZENOH_COMPILER_GCC
 
@@ -60,6 +69,17 @@
 #define _ZP_RC_OP_DECR_AND_CMP __sync_fetch_and_sub(&p->in->_cnt, 1) > 1
 #define _ZP_RC_OP_SYNC __sync_synchronize();
 
+// c99 gcc sync builtin variant of a word written under a lock and read without it
+#define _ZP_SHARED_SIZE_TYPE size_t
+#define _ZP_SHARED_SIZE_LOAD(x) __sync_fetch_and_add(&(x), 0)
+#define _ZP_SHARED_SIZE_STORE(x, v) \
+    do {                            \
+        __sync_synchronize();       \
+        (x) = (v);                  \
+        __sync_synchronize();       \
+    } while (0)
+#define _ZP_SHARED_SIZE_INCR(x) (void)__sync_fetch_and_add(&(x), 1)
+
 #else  // !ZENOH_COMPILER_GCC
 
 // None variant
@@ -69,6 +89,10 @@
 #define _ZP_RC_OP_INCR_CNT
 #define _ZP_RC_OP_DECR_AND_CMP
 #define _ZP_RC_OP_SYNC
+#define _ZP_SHARED_SIZE_TYPE size_t
+#define _ZP_SHARED_SIZE_LOAD(x) (x)
+#define _ZP_SHARED_SIZE_STORE(x, v) (x) = (v)
+#define _ZP_SHARED_SIZE_INCR(x) (x)++
 
 #endif  // ZENOH_COMPILER_GCC
 #endif  // ZENOH_C_STANDARD != 99
@@ -81,6 +105,12 @@
 #define _ZP_RC_OP_DECR_AND_CMP p->in->_cnt-- > 1
 #define _ZP_RC_OP_SYNC
 
+// Single thread variant of a word written under a lock and read without it
+#define _ZP_SHARED_SIZE_TYPE size_t
+#define _ZP_SHARED_SIZE_LOAD(x) (x)
+#define _ZP_SHARED_SIZE_STORE(x, v) (x) = (v)
+#define _ZP_SHARED_SIZE_INCR(x) (x)++
+
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
 /*------------------ Internal Array Macros ------------------*/
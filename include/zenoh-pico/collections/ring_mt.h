@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_COLLECTIONS_RING_MT_H
+#define ZENOH_PICO_COLLECTIONS_RING_MT_H
+
+#include <stdint.h>
+
+#include "zenoh-pico/collections/element.h"
+#include "zenoh-pico/config.h"
+
+#if Z_FEATURE_MULTI_THREAD == 1
+/*-------- Bounded multi-thread ring --------*/
+/**
+ * A bounded ring of pointers shared by any number of producer and consumer threads. Its slots are preallocated, and
+ * pushing or pulling an element never takes a lock: the lock is only used to sleep on an empty or a full ring.
+ *
+ * The ring is reference counted, so that a producer and a consumer can each hold it and release it in any order. Once
+ * closed, pushed elements are dropped and pulling returns the elements left before reporting the ring empty.
+ */
+typedef struct _z_ring_mt_t _z_ring_mt_t;
+
+/**
+ * Create a ring of at least ``capacity`` elements, the elements it still holds when freed are freed with ``f_f``.
+ */
+_z_ring_mt_t *_z_ring_mt_new(size_t capacity, z_element_free_f f_f);
+_z_ring_mt_t *_z_ring_mt_clone(_z_ring_mt_t *ring);
+void _z_ring_mt_free(_z_ring_mt_t **ring);
+size_t _z_ring_mt_capacity(const _z_ring_mt_t *ring);
+
+// Wake up the threads waiting on the ring and make the next pushes drop their element
+void _z_ring_mt_close(_z_ring_mt_t *ring);
+_Bool _z_ring_mt_is_closed(const _z_ring_mt_t *ring);
+
+/**
+ * Push an element, waiting for some room while the ring is full.
+ *
+ * Returns:
+ *   ``true`` if the element has been pushed, ``false`` if the ring is closed and the element has been freed.
+ */
+_Bool _z_ring_mt_push(_z_ring_mt_t *ring, void *elem);
+/**
+ * Push an element without ever waiting: while the ring is full, its oldest elements are freed to make some room.
+ *
+ * Returns:
+ *   ``true`` if the element has been pushed, ``false`` if the ring is closed and the element has been freed.
+ */
+_Bool _z_ring_mt_push_force(_z_ring_mt_t *ring, void *elem);
+/**
+ * Push an element without ever waiting.
+ *
+ * Returns:
+ *   ``true`` if the element has been pushed, ``false`` if the ring is full or closed and the element is left to the
+ *   caller.
+ */
+_Bool _z_ring_mt_try_push(_z_ring_mt_t *ring, void *elem);
+// Take the oldest element out of the ring, or return ``NULL`` if it is empty
+void *_z_ring_mt_try_pull(_z_ring_mt_t *ring);
+// Take the oldest element out of the ring, waiting for one while it is empty. Returns ``NULL`` once it is closed.
+void *_z_ring_mt_pull(_z_ring_mt_t *ring);
+// Make a thread waiting in _z_ring_mt_pull, or the next one to wait, return ``NULL`` without closing the ring
+void _z_ring_mt_wake(_z_ring_mt_t *ring);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+#endif /* ZENOH_PICO_COLLECTIONS_RING_MT_H */
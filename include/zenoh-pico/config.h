@@ -119,6 +119,14 @@
 #define Z_FEATURE_DYNAMIC_MEMORY_ALLOCATION 0
 #endif
 
+/**
+ * Serve every z_malloc from fixed-size blocks reserved at compile time instead of the heap, see the
+ * Z_MEMORY_POOL_BLOCKS_* sizes and zp_memory_stats.
+ */
+#ifndef Z_FEATURE_MEMORY_POOLS
+#define Z_FEATURE_MEMORY_POOLS 0
+#endif
+
 /**
  * Enable queryables
  */
@@ -239,6 +247,29 @@
 #define Z_FEATURE_ATTACHMENT 1
 #endif
 
+/**
+ * Track the subscribers declared by the remote nodes, so that publishers can skip the samples that no one listens to.
+ */
+#ifndef Z_FEATURE_INTEREST
+#define Z_FEATURE_INTEREST 1
+#endif
+
+/**
+ * Enable TX batching of network messages on unicast transports.
+ */
+#ifndef Z_FEATURE_BATCHING
+#define Z_FEATURE_BATCHING 1
+#endif
+
+/**
+ * Let the network messages of a higher priority be sent between the fragments of a lower priority message.
+ * Zenoh-pico reassembles such interleaved fragments, but receivers that expect the fragments of a message to have
+ * consecutive sequence numbers drop the interrupted message. Only enable it when the remote nodes are zenoh-pico ones.
+ */
+#ifndef Z_FEATURE_TX_PREEMPTION
+#define Z_FEATURE_TX_PREEMPTION 0
+#endif
+
 /*------------------ Compile-time configuration properties ------------------*/
 /**
  * Default length for Zenoh ID. Maximum size is 16 bytes.
@@ -316,6 +347,27 @@
 #define Z_BATCH_MULTICAST_SIZE 8192
 #endif
 
+/**
+ * Number of buckets of the table indexing the multicast peers by their source address.
+ */
+#ifndef Z_PEER_INDEX_SIZE
+#define Z_PEER_INDEX_SIZE 16
+#endif
+
+/**
+ * Default time in milliseconds a TX batch is allowed to linger before being flushed.
+ */
+#ifndef Z_BATCH_LINGER_MS
+#define Z_BATCH_LINGER_MS 1
+#endif
+
+/**
+ * Default number of network messages the queue of the TX task can hold.
+ */
+#ifndef Z_TX_QUEUE_SIZE
+#define Z_TX_QUEUE_SIZE 64
+#endif
+
 /**
  * Default maximum size for fragmented messages.
  */
@@ -323,6 +375,73 @@
 #define Z_FRAG_MAX_SIZE 300000
 #endif
 
+/**
+ * Number of 256-entry lookup tables used to compute the CRC32 of the serial frames: 8 for slicing-by-8 (8 KiB of
+ * tables), 1 for a byte at a time (1 KiB), or 0 for the bit at a time loop of the tiniest flash targets.
+ */
+#ifndef Z_CRC32_TABLES
+#define Z_CRC32_TABLES 8
+#endif
+
+/**
+ * Number of blocks of each memory pool, when Z_FEATURE_MEMORY_POOLS is enabled. An allocation is served by the
+ * smallest pool it fits in, or by a larger one while that pool is exhausted: list nodes, reference counters and
+ * keyexpr strings in the pools of 16 to 64 bytes, network messages, samples and session entities in the pools of 128
+ * to 2048 bytes, TX and RX batches in the batch pool and defragmentation buffers in the frag pool.
+ */
+#ifndef Z_MEMORY_POOL_BLOCKS_16
+#define Z_MEMORY_POOL_BLOCKS_16 256
+#endif
+#ifndef Z_MEMORY_POOL_BLOCKS_32
+#define Z_MEMORY_POOL_BLOCKS_32 256
+#endif
+#ifndef Z_MEMORY_POOL_BLOCKS_64
+#define Z_MEMORY_POOL_BLOCKS_64 128
+#endif
+#ifndef Z_MEMORY_POOL_BLOCKS_128
+#define Z_MEMORY_POOL_BLOCKS_128 64
+#endif
+#ifndef Z_MEMORY_POOL_BLOCKS_256
+#define Z_MEMORY_POOL_BLOCKS_256 64
+#endif
+#ifndef Z_MEMORY_POOL_BLOCKS_512
+#define Z_MEMORY_POOL_BLOCKS_512 32
+#endif
+#ifndef Z_MEMORY_POOL_BLOCKS_2K
+#define Z_MEMORY_POOL_BLOCKS_2K 16
+#endif
+#ifndef Z_MEMORY_POOL_BLOCKS_BATCH
+#define Z_MEMORY_POOL_BLOCKS_BATCH 4
+#endif
+#ifndef Z_MEMORY_POOL_BLOCKS_FRAG
+#define Z_MEMORY_POOL_BLOCKS_FRAG 4
+#endif
+
+/**
+ * Size in bytes of the blocks of the batch memory pool, when Z_FEATURE_MEMORY_POOLS is enabled. The blocks of the
+ * frag pool are Z_FRAG_MAX_SIZE bytes long.
+ */
+#ifndef Z_MEMORY_POOL_BATCH_SIZE
+#define Z_MEMORY_POOL_BATCH_SIZE Z_BATCH_UNICAST_SIZE
+#endif
+
+/**
+ * Time in milliseconds a task waiting for the memory pools lock sleeps once it has spun for a while, when
+ * Z_FEATURE_MEMORY_POOLS and Z_FEATURE_MULTI_THREAD are enabled. Sleeping lets a lower priority task holding the lock
+ * run on priority-preemptive schedulers, so it must last at least one tick of the RTOS.
+ */
+#ifndef Z_MEMORY_POOL_LOCK_BACKOFF_MS
+#define Z_MEMORY_POOL_LOCK_BACKOFF_MS 1
+#endif
+
+/**
+ * Size in bytes of the arena serving the transient allocations made while handling a received transport message,
+ * e.g. expanded keys and subscription matches. It is reset after each message, and 0 disables it.
+ */
+#ifndef Z_RX_ARENA_SIZE
+#define Z_RX_ARENA_SIZE 2048
+#endif
+
 /**
  * Default "nop" instruction
  */
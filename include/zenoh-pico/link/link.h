@@ -94,10 +94,14 @@ typedef int8_t (*_z_f_link_listen)(struct _z_link_t *self);
 typedef void (*_z_f_link_close)(struct _z_link_t *self);
 typedef size_t (*_z_f_link_write)(const struct _z_link_t *self, const uint8_t *ptr, size_t len);
 typedef size_t (*_z_f_link_write_all)(const struct _z_link_t *self, const uint8_t *ptr, size_t len);
+typedef size_t (*_z_f_link_write_vec)(const struct _z_link_t *self, const _z_bytes_t *bufs, size_t count);
 typedef size_t (*_z_f_link_read)(const struct _z_link_t *self, uint8_t *ptr, size_t len, _z_bytes_t *addr);
 typedef size_t (*_z_f_link_read_exact)(const struct _z_link_t *self, uint8_t *ptr, size_t len, _z_bytes_t *addr);
 typedef void (*_z_f_link_free)(struct _z_link_t *self);
 
+// Maximum number of ioslices of a wbuf sent with a single vectored write
+#define _Z_LINK_WRITE_VEC_MAX 8
+
 typedef struct _z_link_t {
     _z_endpoint_t _endpoint;
 
@@ -127,6 +131,7 @@ typedef struct _z_link_t {
     _z_f_link_close _close_f;
     _z_f_link_write _write_f;
     _z_f_link_write_all _write_all_f;
+    _z_f_link_write_vec _write_vec_f;  // Optional, NULL if the link does not support vectored writes
     _z_f_link_read _read_f;
     _z_f_link_read_exact _read_exact_f;
     _z_f_link_free _free_f;
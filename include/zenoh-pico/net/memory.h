@@ -24,6 +24,11 @@
  *     sample: The :c:type:`_z_sample_t` to free.
  */
 void _z_sample_move(_z_sample_t *dst, _z_sample_t *src);
+/**
+ * Deep copy a :c:type:`_z_sample_t`, so that it outlives the callback it has been received in. As the attachment of a
+ * sample is only borrowed for the time of the callback, it is not copied over.
+ */
+void _z_sample_copy(_z_sample_t *dst, const _z_sample_t *src);
 void _z_sample_clear(_z_sample_t *sample);
 void _z_sample_free(_z_sample_t **sample);
 
@@ -82,12 +82,16 @@ int8_t _z_undeclare_resource(_z_session_t *zn, uint16_t rid);
  *     zn: The zenoh-net session. The caller keeps its ownership.
  *     keyexpr:  The resource key to publish. The callee gets the ownership
  *              of any allocated value.
+ *     congestion_control: The congestion control to apply when routing the messages of this publisher.
+ *     priority: The priority of the messages of this publisher.
+ *     skip_unmatched: Whether to skip sending the samples that no known remote subscriber matches.
  *
  * Returns:
  *    The created :c:type:`_z_publisher_t` or null if the declaration failed.
  */
 _z_publisher_t *_z_declare_publisher(_z_session_rc_t *zn, _z_keyexpr_t keyexpr,
-                                     z_congestion_control_t congestion_control, z_priority_t priority);
+                                     z_congestion_control_t congestion_control, z_priority_t priority,
+                                     _Bool skip_unmatched);
 
 /**
  * Undeclare a :c:type:`_z_publisher_t`.
@@ -125,6 +129,26 @@ int8_t _z_write(_z_session_t *zn, const _z_keyexpr_t keyexpr, const uint8_t *pay
                 z_attachment_t attachment
 #endif
 );
+
+/**
+ * Write a put through a :c:type:`_z_publisher_t`. Unless an attachment or a non-default encoding is given, the
+ * message is encoded from the pre-encoded headers of the publisher.
+ *
+ * Parameters:
+ *     pub: The publisher to write through. The caller keeps its ownership.
+ *     payload: The value to write.
+ *     len: The length of the value to write.
+ *     encoding: The encoding of the payload. The callee gets the ownership of
+ *               any allocated value.
+ * Returns:
+ *     ``0`` in case of success, ``-1`` in case of failure.
+ */
+int8_t _z_publisher_write(_z_publisher_t *pub, const uint8_t *payload, const size_t len, const _z_encoding_t encoding
+#if Z_FEATURE_ATTACHMENT == 1
+                          ,
+                          z_attachment_t attachment
+#endif
+);
 #endif
 
 #if Z_FEATURE_SUBSCRIPTION == 1
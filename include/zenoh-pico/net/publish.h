@@ -27,6 +27,16 @@ typedef struct {
     _z_session_rc_t _zn;
     z_congestion_control_t _congestion_control;
     z_priority_t _priority;
+    _z_bytes_t _put_header;  // Pre-encoded push and put headers of the puts with the default encoding, if any
+#if Z_FEATURE_SUBSCRIPTION == 1
+    // Generation of the local subscriptions last matched against the key, shifted left by one, with the lowest bit set
+    // if none of them matched. A single word so that it can be checked without locking the session
+    _ZP_SHARED_SIZE_TYPE _local_subscriptions_state;
+#endif
+#if Z_FEATURE_INTEREST == 1
+    _Bool _skip_unmatched;
+    _ZP_SHARED_SIZE_TYPE _remote_subscribers_state;  // Same as _local_subscriptions_state, for the remote subscribers
+#endif
 } _z_publisher_t;
 
 #if Z_FEATURE_PUBLICATION == 1
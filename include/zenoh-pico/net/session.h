@@ -18,10 +18,13 @@
 #include <stdint.h>
 
 #include "zenoh-pico/collections/element.h"
+#include "zenoh-pico/collections/ketree.h"
 #include "zenoh-pico/collections/list.h"
+#include "zenoh-pico/collections/refcount.h"
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/session/session.h"
+#include "zenoh-pico/utils/allocator.h"
 #include "zenoh-pico/utils/config.h"
 
 /**
@@ -46,22 +49,34 @@ typedef struct _z_session_t {
     _z_zint_t _interest_id;
 
     // Session declarations
-    _z_resource_list_t *_local_resources;
-    _z_resource_list_t *_remote_resources;
+    _z_resource_table_t _local_resources;
+    _z_resource_table_t _remote_resources;
 
     // Session subscriptions
 #if Z_FEATURE_SUBSCRIPTION == 1
     _z_subscription_rc_list_t *_local_subscriptions;
-    _z_subscription_rc_list_t *_remote_subscriptions;
+    _z_ketree_t _local_subscriptions_ketree;
+    _ZP_SHARED_SIZE_TYPE _subscriptions_generation;  // Bumped on each change of the local subscriptions
+#endif
+
+    // Subscribers declared by the remote nodes
+#if Z_FEATURE_INTEREST == 1
+    _z_remote_subscriber_list_t *_remote_subscribers;
+    _z_ketree_t _remote_subscribers_ketree;
+    _ZP_SHARED_SIZE_TYPE _remote_subscribers_generation;  // Bumped on each change of the remote subscribers
 #endif
 
     // Session queryables
 #if Z_FEATURE_QUERYABLE == 1
     _z_session_queryable_rc_list_t *_local_queryable;
+    _z_ketree_t _local_queryable_ketree;
 #endif
 #if Z_FEATURE_QUERY == 1
     _z_pending_query_list_t *_pending_queries;
 #endif
+
+    // Transient allocations of the RX path, reset after each transport message it handles
+    _z_arena_t _rx_arena;
 } _z_session_t;
 
 extern void _z_session_clear(_z_session_t *zn);  // Forward type declaration to avoid cyclical include
@@ -132,6 +147,41 @@ int8_t _zp_send_keep_alive(_z_session_t *z);
  */
 int8_t _zp_send_join(_z_session_t *z);
 
+#if Z_FEATURE_BATCHING == 1
+/**
+ * Start batching the network messages sent on the session transport. Messages with the same
+ * reliability are appended to a single frame, which is sent when full, when it has been pending
+ * for more than ``linger_ms`` milliseconds, or when :c:func:`_zp_flush` is called.
+ *
+ * Parameters:
+ *     session: The zenoh-net session. The caller keeps its ownership.
+ *     linger_ms: The maximum time a batch can be pending, ``0`` to disable the time-based flush.
+ * Returns:
+ *     ``0`` in case of success, ``-1`` in case of failure.
+ */
+int8_t _zp_batch_start(_z_session_t *z, uint32_t linger_ms);
+
+/**
+ * Stop batching the network messages and send the pending batch, if any.
+ *
+ * Parameters:
+ *     session: The zenoh-net session. The caller keeps its ownership.
+ * Returns:
+ *     ``0`` in case of success, ``-1`` in case of failure.
+ */
+int8_t _zp_batch_stop(_z_session_t *z);
+
+/**
+ * Send the pending batch, if any.
+ *
+ * Parameters:
+ *     session: The zenoh-net session. The caller keeps its ownership.
+ * Returns:
+ *     ``0`` in case of success, ``-1`` in case of failure.
+ */
+int8_t _zp_flush(_z_session_t *z);
+#endif  // Z_FEATURE_BATCHING == 1
+
 #if Z_FEATURE_MULTI_THREAD == 1
 /**
  * Start a separate task to read from the network and process the messages
@@ -182,6 +232,31 @@ int8_t _zp_start_lease_task(_z_session_t *z, z_task_attr_t *attr);
  *     ``0`` in case of success, ``-1`` in case of failure.
  */
 int8_t _zp_stop_lease_task(_z_session_t *z);
+
+/**
+ * Start a separate task to send the network messages of the session. Once started, publications are
+ * pushed into a bounded queue of ``queue_size`` messages and return without waiting for the transport,
+ * the task sends them in order, batching them when possible. Note that the task can be implemented in
+ * form of thread, process, etc. and its implementation is platform-dependent.
+ *
+ * Parameters:
+ *     session: The zenoh-net session. The caller keeps its ownership.
+ *     queue_size: The number of network messages the queue can hold.
+ * Returns:
+ *     ``0`` in case of success, ``-1`` in case of failure.
+ */
+int8_t _zp_start_tx_task(_z_session_t *z, z_task_attr_t *attr, size_t queue_size);
+
+/**
+ * Stop the TX task, after it has sent the messages submitted so far. This may result in stopping a
+ * thread or a process depending on the target platform.
+ *
+ * Parameters:
+ *     session: The zenoh-net session. The caller keeps its ownership.
+ * Returns:
+ *     ``0`` in case of success, ``-1`` in case of failure.
+ */
+int8_t _zp_stop_tx_task(_z_session_t *z);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
 #endif /* INCLUDE_ZENOH_PICO_NET_SESSION_H */
@@ -63,6 +63,8 @@ int8_t _z_uint64_encode(_z_wbuf_t *buf, uint64_t v);
 int8_t _z_uint64_decode(uint64_t *u64, _z_zbuf_t *buf);
 
 uint8_t _z_zint_len(_z_zint_t v);
+// Write a zint on ``dst``, which must have room for ``_z_zint_len(v)`` bytes. Returns the number of bytes written.
+uint8_t _z_zint_write(uint8_t *dst, _z_zint_t v);
 int8_t _z_zint_encode(_z_wbuf_t *buf, _z_zint_t v);
 int8_t _z_zint64_encode(_z_wbuf_t *buf, uint64_t v);
 int8_t _z_zint16_decode(uint16_t *zint, _z_zbuf_t *buf);
@@ -81,6 +83,11 @@ int8_t _z_zbuf_read_exact(_z_zbuf_t *zbf, uint8_t *dest, size_t length);
 
 int8_t _z_str_encode(_z_wbuf_t *buf, const char *s);
 int8_t _z_str_decode(char **str, _z_zbuf_t *buf);
+/**
+ * Decode a string without allocating: it is terminated in place, in the buffer of ``buf``, over its encoded length.
+ * The decoded string lives as long as the buffer, which must be writable.
+ */
+int8_t _z_str_decode_na(char **str, _z_zbuf_t *buf);
 
 int8_t _z_period_encode(_z_wbuf_t *wbf, const _z_period_t *m);
 int8_t _z_period_decode(_z_period_t *p, _z_zbuf_t *zbf);
@@ -21,6 +21,11 @@
 #include "zenoh-pico/protocol/iobuf.h"
 int8_t _z_push_encode(_z_wbuf_t *wbf, const _z_n_msg_push_t *msg);
 int8_t _z_push_decode(_z_n_msg_push_t *msg, _z_zbuf_t *zbf, uint8_t header);
+/**
+ * Encode a put push message up to its payload length, for it to be used as the ``_header`` of the next pushes sharing
+ * its key, QoS and put headers. The payload of ``msg`` is ignored.
+ */
+int8_t _z_push_header_make(_z_bytes_t *header, const _z_n_msg_push_t *msg);
 int8_t _z_request_encode(_z_wbuf_t *wbf, const _z_n_msg_request_t *msg);
 int8_t _z_request_decode(_z_n_msg_request_t *msg, _z_zbuf_t *zbf, uint8_t header);
 int8_t _z_response_encode(_z_wbuf_t *wbf, const _z_n_msg_response_t *msg);
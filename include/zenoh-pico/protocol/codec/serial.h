@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef INCLUDE_ZENOH_PICO_PROTOCOL_CODEC_SERIAL_H
+#define INCLUDE_ZENOH_PICO_PROTOCOL_CODEC_SERIAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define _Z_SERIAL_MTU_SIZE 1500
+#define _Z_SERIAL_MFS_SIZE _Z_SERIAL_MTU_SIZE + 2 + 4  // MTU + Serial Len + Serial CRC32
+#define _Z_SERIAL_MAX_COBS_BUF_SIZE \
+    1516  // Max On-the-wire length for an MFS/MTU of 1510/1500 (MFS + Overhead Byte (OHB) + End of packet (EOP))
+
+/*------------------ Serial frames ------------------*/
+/**
+ * On the wire, a serial frame is the little endian 16-bit length of the payload, the payload and the little endian
+ * CRC32 of the payload, COBS encoded so that it holds no zero byte, and followed by a zero byte delimiter.
+ */
+
+/**
+ * Frame a payload of at most ``_Z_SERIAL_MTU_SIZE`` bytes into ``out``, which must be able to hold
+ * ``_Z_SERIAL_MAX_COBS_BUF_SIZE`` bytes.
+ *
+ * Returns:
+ *   The number of bytes of the frame, delimiter included, or ``SIZE_MAX`` if the payload is too large.
+ */
+size_t _z_serial_frame_encode(uint8_t *out, const uint8_t *ptr, size_t len);
+
+/**
+ * An incremental decoder of serial frames: the bytes read from the link are fed as they come, so that a frame can
+ * span several reads and a read can hold several frames.
+ */
+typedef struct {
+    uint8_t _frame[_Z_SERIAL_MFS_SIZE];
+    size_t _len;
+    uint8_t _code;   // Code of the current COBS block, 0xFF when it is not followed by an implicit zero
+    uint8_t _block;  // Bytes left in the current COBS block
+    _Bool _invalid;
+} _z_serial_decoder_t;
+
+void _z_serial_decoder_reset(_z_serial_decoder_t *dec);
+/**
+ * Feed the decoder with the bytes read from the link, up to the end of the next non-empty frame.
+ *
+ * Returns:
+ *   The number of bytes consumed. ``complete`` is set to ``true`` if a frame has been completed, in which case the
+ *   bytes left must be fed once it has been taken with :c:func:`_z_serial_decoder_take`.
+ */
+size_t _z_serial_decoder_feed(_z_serial_decoder_t *dec, const uint8_t *raw, size_t len, _Bool *complete);
+/**
+ * Check the length and the CRC32 of the completed frame, copy its payload into ``ptr`` and reset the decoder.
+ *
+ * Returns:
+ *   The length of the payload, or ``SIZE_MAX`` if the frame is corrupted or its payload does not fit in ``len``.
+ */
+size_t _z_serial_decoder_take(_z_serial_decoder_t *dec, uint8_t *ptr, size_t len);
+
+#endif /* INCLUDE_ZENOH_PICO_PROTOCOL_CODEC_SERIAL_H */
@@ -126,6 +126,16 @@ typedef struct {
  * Estimate the length of an attachment once encoded.
  */
 size_t _z_attachment_estimate_length(z_attachment_t att);
+/**
+ * Alias key-value pairs laid out in their wire format, i.e. each key and value prefixed by its length, into an
+ * attachment.
+ */
+z_attachment_t _z_encoded_attachment_wrap(const _z_bytes_t *encoded);
+/**
+ * Returns the key-value pairs of an attachment in their wire format if that is how it holds them, e.g. a received
+ * attachment, or ``NULL`` if they have to be iterated over to be encoded.
+ */
+const _z_bytes_t *_z_attachment_as_encoded(z_attachment_t att);
 z_attachment_t _z_encoded_as_attachment(const _z_owned_encoded_attachment_t *att);
 void _z_encoded_attachment_drop(_z_owned_encoded_attachment_t *att);
 #endif
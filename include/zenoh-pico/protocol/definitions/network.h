@@ -183,6 +183,9 @@ typedef struct {
     _z_timestamp_t _timestamp;
     _z_n_qos_t _qos;
     _z_push_body_t _body;
+    // If not empty, the put encoding up to its payload length (see _z_push_header_make): only the payload is encoded
+    // after it, the other fields are ignored. Aliased, not owned by the message.
+    _z_bytes_t _header;
 } _z_n_msg_push_t;
 void _z_n_msg_push_clear(_z_n_msg_push_t *msg);
 
@@ -238,9 +241,9 @@ void _z_n_msg_free(_z_network_message_t **m);
 inline static void _z_msg_clear(_z_zenoh_message_t *msg) { _z_n_msg_clear(msg); }
 inline static void _z_msg_free(_z_zenoh_message_t **msg) { _z_n_msg_free(msg); }
 _Z_ELEM_DEFINE(_z_network_message, _z_network_message_t, _z_noop_size, _z_n_msg_clear, _z_noop_copy)
-_Z_VEC_DEFINE(_z_network_message, _z_network_message_t)
 
 void _z_msg_fix_mapping(_z_zenoh_message_t *msg, uint16_t mapping);
+z_priority_t _z_n_msg_get_priority(const _z_network_message_t *msg);
 _z_network_message_t _z_msg_make_pull(_z_keyexpr_t key, _z_zint_t pull_id);
 _z_network_message_t _z_msg_make_query(_Z_MOVE(_z_keyexpr_t) key, _Z_MOVE(_z_bytes_t) parameters, _z_zint_t qid,
                                        z_consolidation_mode_t consolidation, _Z_MOVE(_z_value_t) value
@@ -20,6 +20,7 @@
 
 #include "zenoh-pico/link/endpoint.h"
 #include "zenoh-pico/protocol/definitions/network.h"
+#include "zenoh-pico/protocol/iobuf.h"
 
 #define _Z_MID_SCOUT 0x01
 #define _Z_MID_HELLO 0x02
@@ -443,8 +444,11 @@ void _z_t_msg_keep_alive_clear(_z_t_msg_keep_alive_t *msg);
 //
 // - if R==1 then the FRAME is sent on the reliable channel, best-effort otherwise.
 //
+// The network messages are not decoded along with the frame: its payload is a view on the buffer it has been
+// decoded from, which the receiver decodes and dispatches one message at a time.
+//
 typedef struct {
-    _z_network_message_vec_t _messages;
+    _z_zbuf_t _payload;
     _z_zint_t _sn;
 } _z_t_msg_frame_t;
 void _z_t_msg_frame_clear(_z_t_msg_frame_t *msg);
@@ -505,7 +509,7 @@ _z_transport_message_t _z_t_msg_make_open_syn(_z_zint_t lease, _z_zint_t initial
 _z_transport_message_t _z_t_msg_make_open_ack(_z_zint_t lease, _z_zint_t initial_sn);
 _z_transport_message_t _z_t_msg_make_close(uint8_t reason, _Bool link_only);
 _z_transport_message_t _z_t_msg_make_keep_alive(void);
-_z_transport_message_t _z_t_msg_make_frame(_z_zint_t sn, _z_network_message_vec_t messages, _Bool is_reliable);
+_z_transport_message_t _z_t_msg_make_frame(_z_zint_t sn, _z_zbuf_t payload, _Bool is_reliable);
 _z_transport_message_t _z_t_msg_make_frame_header(_z_zint_t sn, _Bool is_reliable);
 _z_transport_message_t _z_t_msg_make_fragment_header(_z_zint_t sn, _Bool is_reliable, _Bool is_last);
 _z_transport_message_t _z_t_msg_make_fragment(_z_zint_t sn, _z_bytes_t messages, _Bool is_reliable, _Bool is_last);
@@ -93,12 +93,25 @@ void _z_zbuf_clear(_z_zbuf_t *zbf);
 void _z_zbuf_free(_z_zbuf_t **zbf);
 
 /*------------------ WBuf ------------------*/
+// Minimum size of the bytes aliased rather than copied by a non-expandable wbuf allowing it, see _z_wbuf_t
+#define _Z_WBUF_ALIAS_MIN_SIZE 1024
+
+/**
+ * A buffer to write on, made of one or more ioslices.
+ *
+ * Members:
+ *   size_t capacity: the capacity of the ioslices allocated by the buffer.
+ *   size_t expansion_step: the capacity of the ioslices added when the buffer is full, 0 if it is not expandable.
+ *   _Bool alias_bytes: whether a non-expandable buffer may alias large bytes instead of copying them. The bytes must
+ *     then outlive the buffer or its next reset, and the buffer is best sent with a vectored write.
+ */
 typedef struct {
     _z_iosli_vec_t _ioss;
     size_t _r_idx;
     size_t _w_idx;
     size_t _capacity;
     size_t _expansion_step;
+    _Bool _alias_bytes;
 } _z_wbuf_t;
 
 _z_wbuf_t _z_wbuf_make(size_t capacity, _Bool is_expandable);
@@ -123,6 +136,9 @@ size_t _z_wbuf_len_iosli(const _z_wbuf_t *wbf);
 
 _z_zbuf_t _z_wbuf_to_zbuf(const _z_wbuf_t *wbf);
 int8_t _z_wbuf_siphon(_z_wbuf_t *dst, _z_wbuf_t *src, size_t length);
+// Like _z_wbuf_siphon, but appends ioslices aliasing the bytes of src instead of copying them.
+// src must outlive dst or its next _z_wbuf_reset, which drops the aliasing ioslices.
+int8_t _z_wbuf_siphon_view(_z_wbuf_t *dst, _z_wbuf_t *src, size_t length);
 
 void _z_wbuf_copy(_z_wbuf_t *dst, const _z_wbuf_t *src);
 void _z_wbuf_reset(_z_wbuf_t *wbf);
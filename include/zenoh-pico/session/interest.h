@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef INCLUDE_ZENOH_PICO_SESSION_INTEREST_H
+#define INCLUDE_ZENOH_PICO_SESSION_INTEREST_H
+
+#include "zenoh-pico/net/publish.h"
+#include "zenoh-pico/net/session.h"
+#include "zenoh-pico/protocol/definitions/declarations.h"
+
+#if Z_FEATURE_INTEREST == 1
+/*------------------ Remote subscribers ------------------*/
+int8_t _z_register_remote_subscriber(_z_session_t *zn, const _z_decl_subscriber_t *decl, uint16_t mapping);
+void _z_unregister_remote_subscriber(_z_session_t *zn, uint32_t id, uint16_t mapping);
+void _z_unregister_remote_subscribers_for_peer(_z_session_t *zn, uint16_t mapping);
+void _z_flush_remote_subscribers(_z_session_t *zn);
+
+/*------------------ Interest ------------------*/
+/**
+ * Ask the remote nodes to declare their current subscribers matching a key expression.
+ */
+int8_t _z_declare_subscribers_interest(_z_session_t *zn, const _z_keyexpr_t *keyexpr);
+/**
+ * Declare again all the current local subscribers, for the remote nodes that joined after they were declared.
+ */
+int8_t _z_declare_current_subscribers(_z_session_t *zn);
+/**
+ * Answer the interest of a remote node, declaring the current local subscribers it is interested in.
+ */
+int8_t _z_handle_interest(_z_session_t *zn, const _z_decl_interest_t *interest);
+
+#if Z_FEATURE_PUBLICATION == 1
+/**
+ * Whether some subscribers declared by the remote nodes match the key of a publisher. The answer is remembered on the
+ * publisher until the remote subscribers change, so that it is given without locking nor allocating anything.
+ */
+_Bool _z_publisher_has_remote_subscribers(_z_publisher_t *pub);
+#endif
+#endif
+
+#endif /* INCLUDE_ZENOH_PICO_SESSION_INTEREST_H */
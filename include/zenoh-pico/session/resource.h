@@ -22,6 +22,16 @@
 /*------------------ Entity ------------------*/
 uint32_t _z_get_entity_id(_z_session_t *zn);
 
+/*------------------ Resource table ------------------*/
+void _z_resource_table_init(_z_resource_table_t *table);
+int8_t _z_resource_table_insert(_z_resource_table_t *table, _z_resource_t *res);
+_z_resource_t *_z_resource_table_get_by_id(const _z_resource_table_t *table, uint16_t mapping, _z_zint_t id);
+_z_resource_t *_z_resource_table_get_by_key(const _z_resource_table_t *table, const _z_keyexpr_t *keyexpr);
+void _z_resource_table_remove(_z_resource_table_t *table, const _z_resource_t *res);
+void _z_resource_table_drop_mapping(_z_resource_table_t *table, uint16_t mapping);
+size_t _z_resource_table_len(const _z_resource_table_t *table);
+void _z_resource_table_clear(_z_resource_table_t *table);
+
 /*------------------ Resource ------------------*/
 uint16_t _z_get_resource_id(_z_session_t *zn);
 _z_resource_t *_z_get_resource_by_id(_z_session_t *zn, uint16_t mapping, _z_zint_t rid);
@@ -33,6 +43,8 @@ void _z_unregister_resources_for_peer(_z_session_t *zn, uint16_t mapping);
 void _z_flush_resources(_z_session_t *zn);
 
 _z_keyexpr_t __unsafe_z_get_expanded_key_from_key(_z_session_t *zn, const _z_keyexpr_t *keyexpr);
+_z_keyexpr_t __unsafe_z_get_shared_expanded_key_from_key(_z_session_t *zn, const _z_keyexpr_t *keyexpr,
+                                                         _z_string_rc_t *shared, _z_arena_t *arena);
 _z_resource_t *__unsafe_z_get_resource_by_id(_z_session_t *zn, uint16_t mapping, _z_zint_t id);
 _z_resource_t *__unsafe_z_get_resource_matching_key(_z_session_t *zn, const _z_keyexpr_t *keyexpr);
 
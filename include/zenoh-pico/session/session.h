@@ -69,19 +69,6 @@ typedef struct {
 void _z_reply_clear(_z_reply_t *src);
 void _z_reply_free(_z_reply_t **hello);
 
-typedef struct {
-    _z_keyexpr_t _key;
-    uint16_t _id;
-    uint16_t _refcount;
-} _z_resource_t;
-
-_Bool _z_resource_eq(const _z_resource_t *one, const _z_resource_t *two);
-void _z_resource_clear(_z_resource_t *res);
-void _z_resource_free(_z_resource_t **res);
-
-_Z_ELEM_DEFINE(_z_resource, _z_resource_t, _z_noop_size, _z_resource_clear, _z_noop_copy)
-_Z_LIST_DEFINE(_z_resource, _z_resource_t)
-
 /**
  * The callback signature of the functions handling data messages.
  */
@@ -105,11 +92,84 @@ _Z_ELEM_DEFINE(_z_subscriber, _z_subscription_t, _z_noop_size, _z_subscription_c
 _Z_ELEM_DEFINE(_z_subscription_rc, _z_subscription_rc_t, _z_noop_size, _z_subscription_rc_drop, _z_noop_copy)
 _Z_LIST_DEFINE(_z_subscription_rc, _z_subscription_rc_t)
 
+/**
+ * The local subscriptions matching a resource, memoized on the resource itself.
+ *
+ * Members:
+ *   _z_subscription_rc_list_t *_subscriptions: the matching subscriptions.
+ */
+typedef struct {
+    _z_subscription_rc_list_t *_subscriptions;
+} _z_subscription_cache_t;
+
+void _z_subscription_cache_clear(_z_subscription_cache_t *cache);
+
+_Z_REFCOUNT_DEFINE(_z_subscription_cache, _z_subscription_cache)
+
+_Z_REFCOUNT_DEFINE(_z_string, _z_string)
+
+typedef struct {
+    _z_keyexpr_t _key;
+    _z_string_rc_t _expanded;  // Fully expanded key, computed once at declaration
+#if Z_FEATURE_SUBSCRIPTION == 1
+    _z_subscription_cache_rc_t _subscriptions;  // Matching local subscriptions, valid for _subscriptions_generation
+    size_t _subscriptions_generation;
+#endif
+    uint16_t _id;
+    uint16_t _refcount;
+} _z_resource_t;
+
+_Bool _z_resource_eq(const _z_resource_t *one, const _z_resource_t *two);
+void _z_resource_clear(_z_resource_t *res);
+void _z_resource_free(_z_resource_t **res);
+
+_Z_ELEM_DEFINE(_z_resource, _z_resource_t, _z_noop_size, _z_resource_clear, _z_noop_copy)
+_Z_LIST_DEFINE(_z_resource, _z_resource_t)
+
+/**
+ * A table of resources, indexed both by (mapping, id) and by (mapping, parent id, suffix).
+ *
+ * Both indexes are open-addressed with linear probing and share the same capacity, which is always a power of two.
+ * The table owns the resources it contains.
+ *
+ * Members:
+ *   _z_resource_t **_by_id: the slots of the (mapping, id) index.
+ *   _z_resource_t **_by_key: the slots of the (mapping, parent id, suffix) index.
+ *   size_t _capacity: the number of slots of each index.
+ *   size_t _len: the number of resources in the table.
+ */
+typedef struct {
+    _z_resource_t **_by_id;
+    _z_resource_t **_by_key;
+    size_t _capacity;
+    size_t _len;
+} _z_resource_table_t;
+
 typedef struct {
     _z_keyexpr_t _key;
     uint32_t _id;
 } _z_publication_t;
 
+/**
+ * A subscriber declared by a remote node.
+ *
+ * Members:
+ *   _z_keyexpr_t _key: the fully expanded key of the subscriber.
+ *   uint32_t _id: the id of the subscriber, unique for the remote node.
+ *   uint16_t _mapping: the mapping of the remote node that declared it.
+ */
+typedef struct {
+    _z_keyexpr_t _key;
+    uint32_t _id;
+    uint16_t _mapping;
+} _z_remote_subscriber_t;
+
+_Bool _z_remote_subscriber_eq(const _z_remote_subscriber_t *one, const _z_remote_subscriber_t *two);
+void _z_remote_subscriber_clear(_z_remote_subscriber_t *sub);
+
+_Z_ELEM_DEFINE(_z_remote_subscriber, _z_remote_subscriber_t, _z_noop_size, _z_remote_subscriber_clear, _z_noop_copy)
+_Z_LIST_DEFINE(_z_remote_subscriber, _z_remote_subscriber_t)
+
 typedef struct z_query_t z_query_t;  // Forward type declaration to avoid cyclical include
 /**
  * The callback signature of the functions handling query messages.
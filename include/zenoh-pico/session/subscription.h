@@ -15,14 +15,15 @@
 #ifndef INCLUDE_ZENOH_PICO_SESSION_SUBSCRIPTION_H
 #define INCLUDE_ZENOH_PICO_SESSION_SUBSCRIPTION_H
 
+#include "zenoh-pico/net/publish.h"
 #include "zenoh-pico/net/session.h"
 
 #if Z_FEATURE_SUBSCRIPTION == 1
 /*------------------ Subscription ------------------*/
-_z_subscription_rc_t *_z_get_subscription_by_id(_z_session_t *zn, uint8_t is_local, const _z_zint_t id);
-_z_subscription_rc_list_t *_z_get_subscriptions_by_key(_z_session_t *zn, uint8_t is_local, const _z_keyexpr_t *keyexpr);
+_z_subscription_rc_t *_z_get_subscription_by_id(_z_session_t *zn, const _z_zint_t id);
+_z_subscription_rc_list_t *_z_get_subscriptions_by_key(_z_session_t *zn, const _z_keyexpr_t *keyexpr);
 
-_z_subscription_rc_t *_z_register_subscription(_z_session_t *zn, uint8_t is_local, _z_subscription_t *sub);
+_z_subscription_rc_t *_z_register_subscription(_z_session_t *zn, _z_subscription_t *sub);
 void _z_trigger_local_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, const uint8_t *payload,
                                     _z_zint_t payload_len, _z_n_qos_t qos
 #if Z_FEATURE_ATTACHMENT == 1
@@ -30,6 +31,26 @@ void _z_trigger_local_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr
                                     z_attachment_t att
 #endif
 );
+/**
+ * Whether some local subscriptions match the key of a publisher. The answer is remembered on the publisher until the
+ * local subscriptions change, so that it is given without locking nor allocating anything.
+ */
+_Bool _z_publisher_has_local_subscriptions(_z_publisher_t *pub);
+/**
+ * Same as :c:func:`_z_trigger_local_subscriptions` for a sample put by a publisher, skipped without locking nor
+ * allocating anything when no local subscription matches its key.
+ */
+void _z_trigger_publisher_local_subscriptions(_z_publisher_t *pub, const uint8_t *payload, _z_zint_t payload_len,
+                                              _z_n_qos_t qos
+#if Z_FEATURE_ATTACHMENT == 1
+                                              ,
+                                              z_attachment_t att
+#endif
+);
+/**
+ * Dispatch a sample received from the network to the matching local subscriptions. Its transient allocations are
+ * served by the RX arena of the session, so it must only be called while handling a received message.
+ */
 int8_t _z_trigger_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, const _z_bytes_t payload,
                                 const _z_encoding_t encoding, const _z_zint_t kind, const _z_timestamp_t timestamp,
                                 const _z_n_qos_t qos
@@ -38,7 +59,7 @@ int8_t _z_trigger_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, co
                                 z_attachment_t att
 #endif
 );
-void _z_unregister_subscription(_z_session_t *zn, uint8_t is_local, _z_subscription_rc_t *sub);
+void _z_unregister_subscription(_z_session_t *zn, _z_subscription_rc_t *sub);
 void _z_flush_subscriptions(_z_session_t *zn);
 
 /*------------------ Pull ------------------*/
@@ -19,27 +19,57 @@
 
 #include "zenoh-pico/collections/string.h"
 #include "zenoh-pico/config.h"
+#include "zenoh-pico/protocol/codec/serial.h"
 #include "zenoh-pico/system/platform.h"
 
 #if Z_FEATURE_LINK_SERIAL == 1
 
-#define _Z_SERIAL_MTU_SIZE 1500
-#define _Z_SERIAL_MFS_SIZE _Z_SERIAL_MTU_SIZE + 2 + 4  // MTU + Serial Len + Serial CRC32
-#define _Z_SERIAL_MAX_COBS_BUF_SIZE \
-    1516  // Max On-the-wire length for an MFS/MTU of 1510/1500 (MFS + Overhead Byte (OHB) + End of packet (EOP))
+#define _Z_SERIAL_RX_BUF_SIZE 256  // Bytes read at once from the device
+
+/**
+ * The buffers of a serial link, allocated once when it is opened: the raw bytes read in bulk from the device and not
+ * decoded yet, the decoder of the frame in progress, and the frame being sent.
+ */
+typedef struct {
+    uint8_t _rx[_Z_SERIAL_RX_BUF_SIZE];
+    size_t _rx_pos;
+    size_t _rx_len;
+    _z_serial_decoder_t _dec;
+    uint8_t _tx[_Z_SERIAL_MAX_COBS_BUF_SIZE];
+} _z_serial_buffers_t;
 
 typedef struct {
     _z_sys_net_socket_t _sock;
+    _z_serial_buffers_t *_bufs;
 } _z_serial_socket_t;
 
+// Implemented by each platform: open the device and move raw bytes in and out of it
 int8_t _z_open_serial_from_pins(_z_sys_net_socket_t *sock, uint32_t txpin, uint32_t rxpin, uint32_t baudrate);
 int8_t _z_open_serial_from_dev(_z_sys_net_socket_t *sock, char *dev, uint32_t baudrate);
 int8_t _z_listen_serial_from_pins(_z_sys_net_socket_t *sock, uint32_t txpin, uint32_t rxpin, uint32_t baudrate);
 int8_t _z_listen_serial_from_dev(_z_sys_net_socket_t *sock, char *dev, uint32_t baudrate);
 void _z_close_serial(_z_sys_net_socket_t *sock);
-size_t _z_read_exact_serial(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len);
-size_t _z_read_serial(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len);
-size_t _z_send_serial(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len);
+/**
+ * Read up to ``len`` bytes already received, waiting for some for at most a platform defined timeout.
+ *
+ * Returns:
+ *   The number of bytes read, or ``SIZE_MAX`` if none could be read.
+ */
+size_t _z_read_serial_internal(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len);
+/**
+ * Write all the ``len`` bytes.
+ *
+ * Returns:
+ *   ``len``, or ``SIZE_MAX`` if they could not all be written.
+ */
+size_t _z_send_serial_internal(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len);
+
+// Frame the payloads over the raw bytes of any platform
+int8_t _z_serial_buffers_init(_z_serial_socket_t *sock);
+void _z_serial_buffers_clear(_z_serial_socket_t *sock);
+size_t _z_read_exact_serial(const _z_serial_socket_t *sock, uint8_t *ptr, size_t len);
+size_t _z_read_serial(const _z_serial_socket_t *sock, uint8_t *ptr, size_t len);
+size_t _z_send_serial(const _z_serial_socket_t *sock, const uint8_t *ptr, size_t len);
 
 #endif
 
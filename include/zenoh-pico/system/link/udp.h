@@ -40,6 +40,10 @@ size_t _z_read_exact_udp_unicast(const _z_sys_net_socket_t sock, uint8_t *ptr, s
 size_t _z_read_udp_unicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len);
 size_t _z_send_udp_unicast(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len,
                            const _z_sys_net_endpoint_t rep);
+#if defined(_Z_SYS_NET_SEND_VEC)
+size_t _z_send_vec_udp_unicast(const _z_sys_net_socket_t sock, const _z_bytes_t *bufs, size_t count,
+                               const _z_sys_net_endpoint_t rep);
+#endif
 
 // Multicast
 int8_t _z_open_udp_multicast(_z_sys_net_socket_t *sock, const _z_sys_net_endpoint_t rep, _z_sys_net_endpoint_t *lep,
@@ -54,6 +58,10 @@ size_t _z_read_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_
                              _z_bytes_t *ep);
 size_t _z_send_udp_multicast(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len,
                              const _z_sys_net_endpoint_t rep);
+#if defined(_Z_SYS_NET_SEND_VEC)
+size_t _z_send_vec_udp_multicast(const _z_sys_net_socket_t sock, const _z_bytes_t *bufs, size_t count,
+                                 const _z_sys_net_endpoint_t rep);
+#endif
 #endif
 
 #endif /* ZENOH_PICO_SYSTEM_LINK_UDP_H */
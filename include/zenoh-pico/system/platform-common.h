@@ -56,10 +56,18 @@ uint64_t z_random_u64(void);
 void z_random_fill(void *buf, size_t len);
 
 /*------------------ Memory ------------------*/
+// Served by the allocator set with _z_allocator_set, see zenoh-pico/utils/allocator.h
 void *z_malloc(size_t size);
 void *z_realloc(void *ptr, size_t size);
 void z_free(void *ptr);
 
+#if Z_FEATURE_MEMORY_POOLS == 0
+// The default allocator, provided by each platform
+void *_z_platform_malloc(size_t size);
+void *_z_platform_realloc(void *ptr, size_t size);
+void _z_platform_free(void *ptr);
+#endif
+
 #if Z_FEATURE_MULTI_THREAD == 1
 /*------------------ Thread ------------------*/
 int8_t z_task_init(z_task_t *task, z_task_attr_t *attr, void *(*fun)(void *), void *arg);
@@ -81,6 +89,11 @@ int8_t z_condvar_free(z_condvar_t *cv);
 
 int8_t z_condvar_signal(z_condvar_t *cv);
 int8_t z_condvar_wait(z_condvar_t *cv, z_mutex_t *m);
+/**
+ * Same as z_condvar_wait, giving up after ``time_ms`` milliseconds. The platforms without condition variables return
+ * an error straight away.
+ */
+int8_t z_condvar_wait_for(z_condvar_t *cv, z_mutex_t *m, uint32_t time_ms);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
 /*------------------ Sleep ------------------*/
@@ -37,7 +37,7 @@ typedef struct timeval z_time_t;
 typedef struct {
     union {
 #if Z_FEATURE_LINK_TCP == 1 || Z_FEATURE_LINK_UDP_MULTICAST == 1 || Z_FEATURE_LINK_UDP_UNICAST == 1 || \
-    Z_FEATURE_RAWETH_TRANSPORT == 1
+    Z_FEATURE_RAWETH_TRANSPORT == 1 || Z_FEATURE_LINK_SERIAL == 1
         int _fd;
 #endif
     };
@@ -51,4 +51,7 @@ typedef struct {
     };
 } _z_sys_net_endpoint_t;
 
+// The network sockets support vectored writes, see _z_send_vec_tcp
+#define _Z_SYS_NET_SEND_VEC 1
+
 #endif /* ZENOH_PICO_SYSTEM_UNIX_TYPES_H */
@@ -23,7 +23,14 @@ void __unsafe_z_prepare_wbuf(_z_wbuf_t *buf, uint8_t link_flow_capability);
 void __unsafe_z_finalize_wbuf(_z_wbuf_t *buf, uint8_t link_flow_capability);
 /*This function is unsafe because it operates in potentially concurrent
         data.*Make sure that the following mutexes are locked before calling this function : *-ztu->mutex_tx */
-int8_t __unsafe_z_serialize_zenoh_fragment(_z_wbuf_t *dst, _z_wbuf_t *src, z_reliability_t reliability, size_t sn);
+int8_t __unsafe_z_serialize_zenoh_fragment(_z_wbuf_t *dst, _z_wbuf_t *src, z_reliability_t reliability, size_t sn,
+                                           _Bool alias_payload);
+
+/**
+ * Write a network message on a buffer, either by encoding it or, if ``encoded`` is not ``NULL``, by writing its
+ * encoding. The encoding is aliased rather than copied under the same conditions as a payload.
+ */
+int8_t _z_write_n_msg(_z_wbuf_t *wbf, const _z_network_message_t *n_msg, const _z_bytes_t *encoded);
 
 /*------------------ Transmission and Reception helpers ------------------*/
 int8_t _z_send_t_msg(_z_transport_t *zt, const _z_transport_message_t *t_msg);
@@ -26,4 +26,13 @@ int8_t _z_multicast_open_client(_z_transport_multicast_establish_param_t *param,
 int8_t _z_multicast_send_close(_z_transport_multicast_t *ztm, uint8_t reason, _Bool link_only);
 int8_t _z_multicast_transport_close(_z_transport_multicast_t *ztm, uint8_t reason);
 void _z_multicast_transport_clear(_z_transport_t *zt);
+
+#if Z_FEATURE_MULTICAST_TRANSPORT == 1 || Z_FEATURE_RAWETH_TRANSPORT == 1
+// Milliseconds elapsed on the clock the peer lease deadlines refer to
+uint64_t _z_multicast_lease_now(_z_transport_multicast_t *ztm);
+// Registers a new peer in the peer list, the address index and the lease heap. Must be called with `_mutex_peer` held.
+int8_t _z_multicast_peer_add(_z_transport_multicast_t *ztm, _z_transport_peer_entry_t *entry);
+// Forgets and frees a peer and the subscribers it declared. Must be called with `_mutex_peer` held.
+void _z_multicast_peer_drop(_z_transport_multicast_t *ztm, _z_transport_peer_entry_t *entry);
+#endif
 #endif /* ZENOH_PICO_MULTICAST_TRANSPORT_H */
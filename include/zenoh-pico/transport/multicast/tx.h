@@ -22,4 +22,11 @@ int8_t _z_multicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *z_m
                                z_congestion_control_t cong_ctrl);
 int8_t _z_multicast_send_t_msg(_z_transport_multicast_t *ztm, const _z_transport_message_t *t_msg);
 
+#if Z_FEATURE_MULTI_THREAD == 1
+void *_zp_multicast_tx_task(void *ztm_arg);  // The argument is void* to avoid incompatible pointer types in tasks
+int8_t _zp_multicast_start_tx_task(_z_transport_multicast_t *ztm, z_task_attr_t *attr, z_task_t *task,
+                                   size_t queue_size);
+int8_t _zp_multicast_stop_tx_task(_z_transport_multicast_t *ztm);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
 #endif /* ZENOH_PICO_MULTICAST_TX_H */
@@ -24,12 +24,13 @@
 #include "zenoh-pico/link/link.h"
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/protocol/definitions/transport.h"
+#include "zenoh-pico/transport/utils.h"
 
-typedef struct {
+typedef struct _z_transport_peer_entry_t {
 #if Z_FEATURE_FRAGMENTATION == 1
     // Defragmentation buffers
-    _z_wbuf_t _dbuf_reliable;
-    _z_wbuf_t _dbuf_best_effort;
+    _z_defrag_buf_t _dbuf_reliable;
+    _z_defrag_buf_t _dbuf_best_effort;
 #endif
 
     _z_id_t _remote_zid;
@@ -39,10 +40,15 @@ typedef struct {
     // SN numbers
     _z_zint_t _sn_res;
     volatile _z_zint_t _lease;
-    volatile _z_zint_t _next_lease;
+    // Lease deadline in ms on the transport lease clock, and position in the transport lease heap
+    uint64_t _lease_deadline;
+    size_t _lease_heap_idx;
 
     uint16_t _peer_id;
     volatile _Bool _received;
+
+    // Next entry in the same bucket of the peer index
+    struct _z_transport_peer_entry_t *_index_next;
 } _z_transport_peer_entry_t;
 
 size_t _z_transport_peer_entry_size(const _z_transport_peer_entry_t *src);
@@ -55,6 +61,40 @@ _Z_LIST_DEFINE(_z_transport_peer_entry, _z_transport_peer_entry_t)
 _z_transport_peer_entry_list_t *_z_transport_peer_entry_list_insert(_z_transport_peer_entry_list_t *root,
                                                                     _z_transport_peer_entry_t *entry);
 
+// Upper bound of a link source address, used to size the scratch buffers the read paths hand to the link
+#define _Z_TRANSPORT_PEER_ADDR_MAX_LEN 32
+
+/**
+ * Fixed-size hash table over the peer list, keyed by the peer source address. It does not own its entries: they are
+ * owned by the peer list and must be removed from the index before being dropped from it.
+ */
+typedef struct {
+    _z_transport_peer_entry_t *_buckets[Z_PEER_INDEX_SIZE];
+} _z_transport_peer_index_t;
+
+void _z_transport_peer_index_init(_z_transport_peer_index_t *index);
+void _z_transport_peer_index_add(_z_transport_peer_index_t *index, _z_transport_peer_entry_t *entry);
+void _z_transport_peer_index_remove(_z_transport_peer_index_t *index, const _z_transport_peer_entry_t *entry);
+_z_transport_peer_entry_t *_z_transport_peer_index_get(const _z_transport_peer_index_t *index, const _z_bytes_t *addr);
+
+/**
+ * Binary min-heap of the peers ordered by lease deadline, so that the lease task only visits the peers whose deadline
+ * has passed. Like the index, it does not own its entries.
+ */
+typedef struct {
+    _z_transport_peer_entry_t **_vals;
+    size_t _len;
+    size_t _capacity;
+} _z_transport_peer_lease_heap_t;
+
+void _z_transport_peer_lease_heap_init(_z_transport_peer_lease_heap_t *heap);
+void _z_transport_peer_lease_heap_clear(_z_transport_peer_lease_heap_t *heap);
+int8_t _z_transport_peer_lease_heap_push(_z_transport_peer_lease_heap_t *heap, _z_transport_peer_entry_t *entry);
+void _z_transport_peer_lease_heap_remove(_z_transport_peer_lease_heap_t *heap, const _z_transport_peer_entry_t *entry);
+// Restores the heap order after the deadline of `entry` changed
+void _z_transport_peer_lease_heap_update(_z_transport_peer_lease_heap_t *heap, _z_transport_peer_entry_t *entry);
+_z_transport_peer_entry_t *_z_transport_peer_lease_heap_top(const _z_transport_peer_lease_heap_t *heap);
+
 // Forward type declaration to avoid cyclical include
 typedef struct _z_session_t _z_session_t;
 
@@ -71,14 +111,16 @@ typedef struct {
     // TX and RX mutexes
     z_mutex_t _mutex_rx;
     z_mutex_t _mutex_tx;
+    // Priority order of the network messages waiting for the TX mutex
+    _z_tx_gate_t _gate_tx;
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
     _z_link_t _link;
 
 #if Z_FEATURE_FRAGMENTATION == 1
     // Defragmentation buffer
-    _z_wbuf_t _dbuf_reliable;
-    _z_wbuf_t _dbuf_best_effort;
+    _z_defrag_buf_t _dbuf_reliable;
+    _z_defrag_buf_t _dbuf_best_effort;
 #endif
 
     // Regular Buffers
@@ -95,11 +137,33 @@ typedef struct {
     _z_zint_t _sn_rx_best_effort;
     volatile _z_zint_t _lease;
 
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_FRAGMENTATION == 1 && Z_FEATURE_TX_PREEMPTION == 1
+    // Fragmented messages interrupted by messages of a higher priority
+    _z_wbuf_t *_frag_suspended_reliable;
+    _z_wbuf_t *_frag_suspended_best_effort;
+#endif
+
+#if Z_FEATURE_BATCHING == 1
+    // Pending TX batch, i.e. an open FRAME in _wbuf
+    z_clock_t _batch_start;
+    uint32_t _batch_linger_ms;
+    size_t _batch_count;
+    z_reliability_t _batch_reliability;
+    volatile _Bool _batching;
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_condvar_t _cond_batch;  // Signaled when a batch opens, for the lease task to send it once it has lingered
+#endif
+#endif
+
 #if Z_FEATURE_MULTI_THREAD == 1
     z_task_t *_read_task;
     z_task_t *_lease_task;
+    z_task_t *_tx_task;
     volatile _Bool _read_task_running;
     volatile _Bool _lease_task_running;
+    volatile _Bool _tx_task_running;
+    // Network messages submitted to the TX task
+    _z_tx_queue_t *_tx_queue;
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
     volatile _Bool _received;
@@ -114,6 +178,8 @@ typedef struct _z_transport_multicast_t {
     // TX and RX mutexes
     z_mutex_t _mutex_rx;
     z_mutex_t _mutex_tx;
+    // Priority order of the network messages waiting for the TX mutex
+    _z_tx_gate_t _gate_tx;
 
     // Peer list mutex
     z_mutex_t _mutex_peer;
@@ -133,6 +199,17 @@ typedef struct _z_transport_multicast_t {
 
     // Known valid peers
     _z_transport_peer_entry_list_t *_peers;
+    _z_transport_peer_index_t _peer_index;
+    _z_transport_peer_lease_heap_t _peer_leases;
+    // Reference of the peer lease deadlines, and smallest lease among the local and the known peers ones
+    z_clock_t _lease_clock;
+    _z_zint_t _min_lease;
+
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_FRAGMENTATION == 1 && Z_FEATURE_TX_PREEMPTION == 1
+    // Fragmented messages interrupted by messages of a higher priority
+    _z_wbuf_t *_frag_suspended_reliable;
+    _z_wbuf_t *_frag_suspended_best_effort;
+#endif
 
     // T message send function
     _zp_f_send_tmsg _send_f;
@@ -140,8 +217,12 @@ typedef struct _z_transport_multicast_t {
 #if Z_FEATURE_MULTI_THREAD == 1
     z_task_t *_read_task;
     z_task_t *_lease_task;
+    z_task_t *_tx_task;
     volatile _Bool _read_task_running;
     volatile _Bool _lease_task_running;
+    volatile _Bool _tx_task_running;
+    // Network messages submitted to the TX task
+    _z_tx_queue_t *_tx_queue;
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
     volatile _Bool _transmitted;
@@ -22,4 +22,17 @@ int8_t _z_unicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *z_msg
                              z_congestion_control_t cong_ctrl);
 int8_t _z_unicast_send_t_msg(_z_transport_unicast_t *ztu, const _z_transport_message_t *t_msg);
 
+#if Z_FEATURE_BATCHING == 1
+int8_t _z_unicast_batch_start(_z_transport_unicast_t *ztu, uint32_t linger_ms);
+int8_t _z_unicast_batch_stop(_z_transport_unicast_t *ztu);
+int8_t _z_unicast_flush(_z_transport_unicast_t *ztu);
+int8_t _z_unicast_flush_expired(_z_transport_unicast_t *ztu);
+#endif
+
+#if Z_FEATURE_MULTI_THREAD == 1
+void *_zp_unicast_tx_task(void *ztu_arg);  // The argument is void* to avoid incompatible pointer types in tasks
+int8_t _zp_unicast_start_tx_task(_z_transport_t *zt, z_task_attr_t *attr, z_task_t *task, size_t queue_size);
+int8_t _zp_unicast_stop_tx_task(_z_transport_t *zt);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
 #endif /* ZENOH_PICO_TRANSPORT_LINK_TX_H */
@@ -17,8 +17,13 @@
 
 #include <stdbool.h>
 
+#include "zenoh-pico/collections/bytes.h"
+#include "zenoh-pico/collections/ring_mt.h"
+#include "zenoh-pico/config.h"
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/protocol/definitions/transport.h"
+#include "zenoh-pico/protocol/iobuf.h"
+#include "zenoh-pico/system/platform.h"
 
 /*------------------ SN helpers ------------------*/
 _z_zint_t _z_sn_max(uint8_t bits);
@@ -31,4 +36,122 @@ _z_zint_t _z_sn_decrement(const _z_zint_t sn_resolution, const _z_zint_t sn);
 void _z_conduit_sn_list_copy(_z_conduit_sn_list_t *dst, const _z_conduit_sn_list_t *src);
 void _z_conduit_sn_list_decrement(const _z_zint_t sn_resolution, _z_conduit_sn_list_t *sns);
 
+#if Z_FEATURE_FRAGMENTATION == 1
+/*------------------ Defragmentation helpers ------------------*/
+/**
+ * A contiguous buffer where the fragments of a network message are reassembled, so that the message can be decoded
+ * in place once its last fragment has been received. Each fragment is copied once, straight from the RX buffer.
+ *
+ * With dynamic memory allocation the buffer is sized from the first fragment, doubles when needed up to
+ * ``Z_FRAG_MAX_SIZE`` and keeps its capacity for the next messages. Otherwise, ``Z_FRAG_MAX_SIZE`` bytes are
+ * allocated once.
+ *
+ * Members:
+ *   _z_zbuf_t buf: the reassembled bytes, ready to be decoded after the last fragment.
+ *   _Bool drop: whether the message exceeds ``Z_FRAG_MAX_SIZE``, its remaining fragments are then discarded.
+ */
+typedef struct {
+    _z_zbuf_t _buf;
+    _Bool _drop;
+} _z_defrag_buf_t;
+
+int8_t _z_defrag_buf_init(_z_defrag_buf_t *dbuf);
+int8_t _z_defrag_buf_push(_z_defrag_buf_t *dbuf, const _z_bytes_t *fragment);
+void _z_defrag_buf_reset(_z_defrag_buf_t *dbuf);
+void _z_defrag_buf_clear(_z_defrag_buf_t *dbuf);
+void _z_defrag_buf_copy(_z_defrag_buf_t *dst, const _z_defrag_buf_t *src);
+#endif
+
+#if Z_FEATURE_MULTI_THREAD == 1
+/*------------------ TX priority helpers ------------------*/
+#define _Z_TX_GATE_PRIORITIES ((size_t)Z_PRIORITY_BACKGROUND + (size_t)1)
+
+/**
+ * Orders the senders of network messages contending for the TX mutex of a transport by priority. The gate is handed
+ * over to the highest waiting priority when released, so the pending messages are sent in priority order rather than
+ * in the order the TX mutex happens to be granted. A sender that yielded the gate between the fragments of a message
+ * takes it back before the other senders of its priority.
+ *
+ * Members:
+ *   z_mutex_t mutex: protects the gate state.
+ *   z_condvar_t cond: one condition per priority, signaled when a sender of that priority may take the gate.
+ *   z_condvar_t cond_yielded: the same, for the senders that yielded the gate.
+ *   size_t waiting: the number of senders waiting for the gate, per priority.
+ *   size_t yielded: the number of senders waiting to take the gate back, per priority.
+ *   _Bool busy: whether a sender owns the gate.
+ */
+typedef struct {
+    z_mutex_t _mutex;
+    z_condvar_t _cond[_Z_TX_GATE_PRIORITIES];
+    z_condvar_t _cond_yielded[_Z_TX_GATE_PRIORITIES];
+    size_t _waiting[_Z_TX_GATE_PRIORITIES];
+    size_t _yielded[_Z_TX_GATE_PRIORITIES];
+    _Bool _busy;
+} _z_tx_gate_t;
+
+int8_t _z_tx_gate_init(_z_tx_gate_t *gate);
+void _z_tx_gate_clear(_z_tx_gate_t *gate);
+void _z_tx_gate_lock(_z_tx_gate_t *gate, z_mutex_t *mutex_tx, z_priority_t priority);
+int8_t _z_tx_gate_trylock(_z_tx_gate_t *gate, z_mutex_t *mutex_tx, z_priority_t priority);
+void _z_tx_gate_unlock(_z_tx_gate_t *gate, z_mutex_t *mutex_tx);
+/**
+ * Hand the gate over to the waiting senders of a higher priority, if any, and take it back once they are done.
+ * Used between the fragments of a message. The TX mutex must be locked before calling this function.
+ *
+ * Returns:
+ *   ``true`` if the TX mutex has been released in the meantime, ``false`` otherwise.
+ */
+_Bool _z_tx_gate_yield(_z_tx_gate_t *gate, z_mutex_t *mutex_tx, z_priority_t priority);
+
+/*------------------ TX queue ------------------*/
+/**
+ * A network message submitted to a TX queue, encoded on its own buffer.
+ *
+ * Members:
+ *   _z_bytes_t msg: The encoded network message.
+ *   z_reliability_t reliability: The reliability of the channel to send the message on.
+ *   z_priority_t priority: The priority of the message.
+ */
+typedef struct {
+    _z_bytes_t _msg;
+    z_reliability_t _reliability;
+    z_priority_t _priority;
+} _z_tx_queue_entry_t;
+
+void _z_tx_queue_entry_free(_z_tx_queue_entry_t **entry);
+
+/**
+ * A bounded queue of network messages, submitted by any number of application threads and sent by a single TX task.
+ * It is a :c:type:`_z_ring_mt_t` of entries: submitting a message never takes a lock unless the TX task has to be woken
+ * up, or the queue is full and the submitter has to wait for some room.
+ */
+typedef _z_ring_mt_t _z_tx_queue_t;
+
+_z_tx_queue_t *_z_tx_queue_new(size_t capacity);
+void _z_tx_queue_free(_z_tx_queue_t **queue);
+size_t _z_tx_queue_capacity(const _z_tx_queue_t *queue);
+/**
+ * Encode a network message and submit it to the queue. When the queue is full, the message is dropped if the congestion
+ * control is :c:enum:`Z_CONGESTION_CONTROL_DROP`, otherwise the caller waits for some room.
+ *
+ * Returns:
+ *   ``0`` if the message has been submitted, :c:enum:`_Z_ERR_TRANSPORT_NO_SPACE` if it has been dropped or a
+ *   ``negative value`` if it could not be encoded.
+ */
+int8_t _z_tx_queue_push(_z_tx_queue_t *queue, const _z_network_message_t *n_msg, z_reliability_t reliability,
+                        z_congestion_control_t cong_ctrl);
+/**
+ * Take the oldest message out of the queue. Only the TX task may call this function.
+ *
+ * Parameters:
+ *   queue: The queue to take the message from.
+ *   wait: Whether to wait for a message while the queue is empty, until :c:func:`_z_tx_queue_wake` is called.
+ *
+ * Returns:
+ *   The entry of the message, to be freed with :c:func:`_z_tx_queue_entry_free`, or ``NULL`` if the queue is empty.
+ */
+_z_tx_queue_entry_t *_z_tx_queue_pop(_z_tx_queue_t *queue, _Bool wait);
+void _z_tx_queue_wake(_z_tx_queue_t *queue);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
 #endif /* ZENOH_PICO_TRANSPORT_UTILS_H */
@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_UTILS_ALLOCATOR_H
+#define ZENOH_PICO_UTILS_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*------------------ Allocator ------------------*/
+/**
+ * The functions serving ``z_malloc``, ``z_realloc`` and ``z_free``, each one called with the given context. By
+ * default, they are the ones of the platform, or the memory pools with ``Z_FEATURE_MEMORY_POOLS`` enabled.
+ *
+ * Members:
+ *   void *(*alloc_fn)(size_t size, void *ctx): Allocate ``size`` bytes, ``NULL`` if it fails.
+ *   void *(*realloc_fn)(void *ptr, size_t size, void *ctx): Resize an allocation, ``NULL`` if it fails.
+ *   void (*free_fn)(void *ptr, void *ctx): Release an allocation, or do nothing if ``ptr`` is ``NULL``.
+ *   void *ctx: The context passed to the functions.
+ */
+typedef struct {
+    void *(*alloc_fn)(size_t size, void *ctx);
+    void *(*realloc_fn)(void *ptr, size_t size, void *ctx);
+    void (*free_fn)(void *ptr, void *ctx);
+    void *ctx;
+} _z_allocator_t;
+
+/**
+ * Replace the allocator serving ``z_malloc``, ``z_realloc`` and ``z_free``, or restore the default one if
+ * ``allocator`` is ``NULL``. It must be done while nothing allocated by the previous allocator is alive.
+ *
+ * Returns:
+ *   ``0`` in case of success, or a ``negative value`` if one of the functions of ``allocator`` is missing.
+ */
+int8_t _z_allocator_set(const _z_allocator_t *allocator);
+
+/*------------------ Arena ------------------*/
+/**
+ * A bump arena for the allocations that all die together, e.g. while handling a transport message. Allocating only
+ * moves a cursor forward, and the whole arena is released at once by resetting it. The allocations that do not fit
+ * in it are served by ``z_malloc`` instead.
+ */
+typedef struct {
+    uint8_t *_start;
+    size_t _capacity;
+    size_t _len;
+} _z_arena_t;
+
+int8_t _z_arena_init(_z_arena_t *arena, size_t capacity);
+void _z_arena_clear(_z_arena_t *arena);
+static inline void _z_arena_reset(_z_arena_t *arena) { arena->_len = 0; }
+_Bool _z_arena_owns(const _z_arena_t *arena, const void *ptr);
+
+/**
+ * Allocate ``size`` bytes from the arena, or from ``z_malloc`` if they do not fit in it or ``arena`` is ``NULL``.
+ */
+void *_z_arena_alloc(_z_arena_t *arena, size_t size);
+/**
+ * Release an allocation of :c:func:`_z_arena_alloc`. It only frees the ones served by ``z_malloc``, the others live
+ * until the arena is reset.
+ */
+void _z_arena_free(_z_arena_t *arena, void *ptr);
+
+#endif /* ZENOH_PICO_UTILS_ALLOCATOR_H */
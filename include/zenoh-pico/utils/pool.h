@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_UTILS_POOL_H
+#define ZENOH_PICO_UTILS_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/config.h"
+
+/*------------------ Memory pools ------------------*/
+/**
+ * With ``Z_FEATURE_MEMORY_POOLS`` enabled, ``z_malloc``, ``z_realloc`` and ``z_free`` are served from fixed-size
+ * blocks reserved at compile time instead of the heap. Each pool holds the blocks of one size class, sized by the
+ * ``Z_MEMORY_POOL_*`` config macros: list nodes, reference counters and small strings go to the smallest pools,
+ * session entities and network messages to the middle ones, and the transport buffers to the large one.
+ *
+ * An allocation is served by the smallest pool its size fits in, and by the next larger ones while that pool is
+ * exhausted. It fails once all of them are, since there is no heap to fall back to.
+ */
+
+/**
+ * The usage of a memory pool.
+ *
+ * Members:
+ *   size_t block_size: The size in bytes of the blocks of the pool.
+ *   size_t blocks: The number of blocks of the pool.
+ *   size_t in_use: The number of blocks currently allocated.
+ *   size_t high_water: The highest number of blocks ever allocated at once.
+ *   size_t misses: The number of allocations fitting in the pool that it could not serve, because it was exhausted.
+ */
+typedef struct {
+    size_t block_size;
+    size_t blocks;
+    size_t in_use;
+    size_t high_water;
+    size_t misses;
+} _z_pool_stats_t;
+
+/**
+ * Reports the usage of the memory pools, from the smallest blocks to the largest ones.
+ *
+ * Parameters:
+ *   stats: The array where to write the usage of the pools.
+ *   len: The number of elements of ``stats``.
+ *
+ * Returns:
+ *   The number of memory pools, ``0`` if ``Z_FEATURE_MEMORY_POOLS`` is disabled. Only the first ``len`` pools are
+ *   reported if there are more of them.
+ */
+size_t _z_pool_stats(_z_pool_stats_t *stats, size_t len);
+
+#if Z_FEATURE_MEMORY_POOLS == 1
+// The default allocator behind z_malloc, z_realloc and z_free
+void *_z_pool_malloc(size_t size);
+void *_z_pool_realloc(void *ptr, size_t size);
+void _z_pool_free(void *ptr);
+#endif
+
+#endif /* ZENOH_PICO_UTILS_POOL_H */
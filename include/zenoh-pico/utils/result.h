@@ -66,6 +66,8 @@ typedef enum {
     _Z_ERR_SYSTEM_OUT_OF_MEMORY = -78,
 
     _Z_ERR_CONNECTION_CLOSED = -77,
+    _Z_ERR_CHANNEL_CLOSED = -76,
+    _Z_ERR_CHANNEL_EMPTY = -75,
 
     _Z_ERR_GENERIC = -128
 } _z_res_t;
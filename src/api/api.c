@@ -27,8 +27,10 @@
 #include "zenoh-pico/net/memory.h"
 #include "zenoh-pico/net/primitives.h"
 #include "zenoh-pico/net/session.h"
+#include "zenoh-pico/protocol/codec/core.h"
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/protocol/keyexpr.h"
+#include "zenoh-pico/session/interest.h"
 #include "zenoh-pico/session/queryable.h"
 #include "zenoh-pico/session/resource.h"
 #include "zenoh-pico/session/subscription.h"
@@ -421,6 +423,24 @@ OWNED_FUNCTIONS_PTR_DROP(z_scouting_config_t, z_owned_scouting_config_t, scoutin
 OWNED_FUNCTIONS_PTR_INTERNAL(z_keyexpr_t, z_owned_keyexpr_t, keyexpr, _z_keyexpr_free, _z_keyexpr_copy)
 OWNED_FUNCTIONS_PTR_INTERNAL(z_hello_t, z_owned_hello_t, hello, _z_hello_free, _z_owner_noop_copy)
 OWNED_FUNCTIONS_PTR_INTERNAL(z_str_array_t, z_owned_str_array_t, str_array, _z_str_array_free, _z_owner_noop_copy)
+OWNED_FUNCTIONS_PTR_INTERNAL(z_sample_t, z_owned_sample_t, sample, _z_sample_free, _z_sample_copy)
+
+_Bool z_query_check(const z_owned_query_t *val) { return val->_rc.in != NULL; }
+z_query_t z_query_loan(const z_owned_query_t *val) { return (z_query_t){._val = *val}; }
+z_owned_query_t z_query_null(void) { return (z_owned_query_t){._rc = {.in = NULL}}; }
+z_owned_query_t *z_query_move(z_owned_query_t *val) { return val; }
+z_owned_query_t z_query_clone(z_owned_query_t *val) {
+    z_owned_query_t ret = z_query_null();
+    if (val->_rc.in != NULL) {
+        ret._rc = _z_query_rc_clone(&val->_rc);
+    }
+    return ret;
+}
+// The final reply is sent once the last owner of the query drops it
+void z_query_drop(z_owned_query_t *val) {
+    _z_query_rc_drop(&val->_rc);
+    val->_rc.in = NULL;
+}
 
 _Bool z_session_check(const z_owned_session_t *val) { return val->_value.in != NULL; }
 z_session_t z_session_loan(const z_owned_session_t *val) { return (z_session_t){._val = val->_value}; }
@@ -647,6 +667,7 @@ int8_t z_put(z_session_t zs, z_keyexpr_t keyexpr, const uint8_t *payload, z_zint
 #endif
     );
 
+#if Z_FEATURE_SUBSCRIPTION == 1
     // Trigger local subscriptions
     _z_trigger_local_subscriptions(&zs._val.in->val, keyexpr, payload, payload_len,
                                    _z_n_qos_make(0, opt.congestion_control == Z_CONGESTION_CONTROL_BLOCK, opt.priority)
@@ -655,6 +676,7 @@ int8_t z_put(z_session_t zs, z_keyexpr_t keyexpr, const uint8_t *payload, z_zint
                                    opt.attachment
 #endif
     );
+#endif
 
     return ret;
 }
@@ -679,7 +701,12 @@ int8_t z_delete(z_session_t zs, z_keyexpr_t keyexpr, const z_delete_options_t *o
 }
 
 z_publisher_options_t z_publisher_options_default(void) {
-    return (z_publisher_options_t){.congestion_control = Z_CONGESTION_CONTROL_DEFAULT, .priority = Z_PRIORITY_DEFAULT};
+    return (z_publisher_options_t) {
+        .congestion_control = Z_CONGESTION_CONTROL_DEFAULT, .priority = Z_PRIORITY_DEFAULT,
+#if Z_FEATURE_INTEREST == 1
+        .skip_unmatched = false
+#endif
+    };
 }
 
 z_owned_publisher_t z_declare_publisher(z_session_t zs, z_keyexpr_t keyexpr, const z_publisher_options_t *options) {
@@ -700,9 +727,17 @@ z_owned_publisher_t z_declare_publisher(z_session_t zs, z_keyexpr_t keyexpr, con
     if (options != NULL) {
         opt.congestion_control = options->congestion_control;
         opt.priority = options->priority;
+#if Z_FEATURE_INTEREST == 1
+        opt.skip_unmatched = options->skip_unmatched;
+#endif
     }
+    _Bool skip_unmatched = false;
+#if Z_FEATURE_INTEREST == 1
+    skip_unmatched = opt.skip_unmatched;
+#endif
 
-    return (z_owned_publisher_t){._value = _z_declare_publisher(&zs._val, key, opt.congestion_control, opt.priority)};
+    return (z_owned_publisher_t){
+        ._value = _z_declare_publisher(&zs._val, key, opt.congestion_control, opt.priority, skip_unmatched)};
 }
 
 int8_t z_undeclare_publisher(z_owned_publisher_t *pub) {
@@ -714,6 +749,16 @@ int8_t z_undeclare_publisher(z_owned_publisher_t *pub) {
     return ret;
 }
 
+// Whether the samples of a publisher have to be sent to the remote nodes
+static _Bool _z_publisher_should_write(_z_publisher_t *pub) {
+#if Z_FEATURE_INTEREST == 1
+    return (pub->_skip_unmatched == false) || (_z_publisher_has_remote_subscribers(pub) == true);
+#else
+    _ZP_UNUSED(pub);
+    return true;
+#endif
+}
+
 z_publisher_put_options_t z_publisher_put_options_default(void) {
     return (z_publisher_put_options_t) {
         .encoding = z_encoding_default(),
@@ -739,27 +784,33 @@ int8_t z_publisher_put(const z_publisher_t pub, const uint8_t *payload, size_t l
 #endif
     }
 
-    ret = _z_write(&pub._val->_zn.in->val, pub._val->_key, payload, len, opt.encoding, Z_SAMPLE_KIND_PUT,
-                   pub._val->_congestion_control, pub._val->_priority
+    if (_z_publisher_should_write(pub._val) == true) {
+        ret = _z_publisher_write(pub._val, payload, len, opt.encoding
 #if Z_FEATURE_ATTACHMENT == 1
-                   ,
-                   opt.attachment
+                                 ,
+                                 opt.attachment
 #endif
-    );
+        );
+    }
 
+#if Z_FEATURE_SUBSCRIPTION == 1
     // Trigger local subscriptions
-    _z_trigger_local_subscriptions(&pub._val->_zn.in->val, pub._val->_key, payload, len, _Z_N_QOS_DEFAULT
+    _z_trigger_publisher_local_subscriptions(pub._val, payload, len, _Z_N_QOS_DEFAULT
 #if Z_FEATURE_ATTACHMENT == 1
-                                   ,
-                                   opt.attachment
+                                             ,
+                                             opt.attachment
 #endif
     );
+#endif
 
     return ret;
 }
 
 int8_t z_publisher_delete(const z_publisher_t pub, const z_publisher_delete_options_t *options) {
     (void)(options);
+    if (_z_publisher_should_write(pub._val) == false) {
+        return _Z_RES_OK;
+    }
     return _z_write(&pub._val->_zn.in->val, pub._val->_key, NULL, 0, z_encoding_default(), Z_SAMPLE_KIND_DELETE,
                     pub._val->_congestion_control, pub._val->_priority
 #if Z_FEATURE_ATTACHMENT == 1
@@ -769,6 +820,17 @@ int8_t z_publisher_delete(const z_publisher_t pub, const z_publisher_delete_opti
     );
 }
 
+_Bool zp_publisher_has_matching_subscribers(const z_publisher_t pub) {
+    _Bool ret = true;
+#if Z_FEATURE_INTEREST == 1
+    ret = _z_publisher_has_remote_subscribers(pub._val);
+#endif
+#if Z_FEATURE_SUBSCRIPTION == 1
+    ret = ret || _z_publisher_has_local_subscriptions(pub._val);
+#endif
+    return ret;
+}
+
 z_owned_keyexpr_t z_publisher_keyexpr(z_publisher_t publisher) {
     z_owned_keyexpr_t ret = {._value = z_malloc(sizeof(_z_keyexpr_t))};
     if (ret._value != NULL && publisher._val != NULL) {
@@ -1154,6 +1216,40 @@ int8_t zp_stop_lease_task(z_session_t zs) {
 #endif
 }
 
+zp_task_tx_options_t zp_task_tx_options_default(void) {
+    return (zp_task_tx_options_t) {
+#if Z_FEATURE_MULTI_THREAD == 1
+        .task_attributes = NULL, .queue_size = Z_TX_QUEUE_SIZE
+#else
+        .__dummy = 0
+#endif
+    };
+}
+
+int8_t zp_start_tx_task(z_session_t zs, const zp_task_tx_options_t *options) {
+    (void)(options);
+#if Z_FEATURE_MULTI_THREAD == 1
+    zp_task_tx_options_t opt = zp_task_tx_options_default();
+    if (options != NULL) {
+        opt.task_attributes = options->task_attributes;
+        opt.queue_size = options->queue_size;
+    }
+    return _zp_start_tx_task(&zs._val.in->val, opt.task_attributes, opt.queue_size);
+#else
+    (void)(zs);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+#endif
+}
+
+int8_t zp_stop_tx_task(z_session_t zs) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    return _zp_stop_tx_task(&zs._val.in->val);
+#else
+    (void)(zs);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+#endif
+}
+
 zp_read_options_t zp_read_options_default(void) { return (zp_read_options_t){.__dummy = 0}; }
 
 int8_t zp_read(z_session_t zs, const zp_read_options_t *options) {
@@ -1176,6 +1272,44 @@ int8_t zp_send_join(z_session_t zs, const zp_send_join_options_t *options) {
     (void)(options);
     return _zp_send_join(&zs._val.in->val);
 }
+
+zp_batch_options_t zp_batch_options_default(void) { return (zp_batch_options_t){.linger_ms = Z_BATCH_LINGER_MS}; }
+
+int8_t zp_batch_start(z_session_t zs, const zp_batch_options_t *options) {
+#if Z_FEATURE_BATCHING == 1
+    zp_batch_options_t opt = zp_batch_options_default();
+    if (options != NULL) {
+        opt.linger_ms = options->linger_ms;
+    }
+    return _zp_batch_start(&zs._val.in->val, opt.linger_ms);
+#else
+    (void)(zs);
+    (void)(options);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+#endif
+}
+
+int8_t zp_batch_stop(z_session_t zs) {
+#if Z_FEATURE_BATCHING == 1
+    return _zp_batch_stop(&zs._val.in->val);
+#else
+    (void)(zs);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+#endif
+}
+
+int8_t zp_flush(z_session_t zs) {
+#if Z_FEATURE_BATCHING == 1
+    return _zp_flush(&zs._val.in->val);
+#else
+    (void)(zs);
+    return _Z_RES_OK;
+#endif
+}
+
+size_t zp_memory_stats(zp_memory_pool_stats_t *stats, size_t len) { return _z_pool_stats(stats, len); }
+
+int8_t zp_set_allocator(const zp_allocator_t *allocator) { return _z_allocator_set(allocator); }
 #if Z_FEATURE_ATTACHMENT == 1
 void _z_bytes_pair_clear(struct _z_bytes_pair_t *this_) {
     _z_bytes_clear(&this_->key);
@@ -1222,6 +1356,7 @@ z_bytes_t z_bytes_map_get(const z_owned_bytes_map_t *this_, z_bytes_t key) {
         if (_z_bytes_eq(&key, &head->key)) {
             return _z_bytes_wrap(head->value.start, head->value.len);
         }
+        current = _z_bytes_pair_list_tail(current);
     }
     return z_bytes_null();
 }
@@ -1284,6 +1419,60 @@ int8_t z_bytes_map_iter(const z_owned_bytes_map_t *this_, z_attachment_iter_body
 }
 z_owned_bytes_map_t z_bytes_map_new(void) { return (z_owned_bytes_map_t){._inner = _z_bytes_pair_list_new()}; }
 z_owned_bytes_map_t z_bytes_map_null(void) { return (z_owned_bytes_map_t){._inner = NULL}; }
+
+z_owned_attachment_builder_t z_attachment_builder_new(size_t capacity) {
+    z_owned_attachment_builder_t builder = z_attachment_builder_null();
+    uint8_t *buf = (uint8_t *)z_malloc(capacity > (size_t)0 ? capacity : (size_t)1);
+    if (buf != NULL) {
+        builder._bytes = (_z_bytes_t){.start = buf, .len = 0, ._is_alloc = true};
+        builder._capacity = capacity;
+    }
+    return builder;
+}
+z_owned_attachment_builder_t z_attachment_builder_null(void) {
+    return (z_owned_attachment_builder_t){._bytes = _z_bytes_empty(), ._capacity = 0};
+}
+bool z_attachment_builder_check(const z_owned_attachment_builder_t *this_) { return this_->_bytes.start != NULL; }
+void z_attachment_builder_drop(z_owned_attachment_builder_t *this_) {
+    _z_bytes_clear(&this_->_bytes);
+    this_->_capacity = 0;
+}
+// Write the length of ``bs`` followed by its bytes, returning the end of what has been written
+static uint8_t *_z_attachment_builder_write(uint8_t *dst, z_bytes_t bs) {
+    dst = &dst[_z_zint_write(dst, bs.len)];
+    if (bs.len > (size_t)0) {
+        (void)memcpy(dst, bs.start, bs.len);
+    }
+    return &dst[bs.len];
+}
+int8_t z_attachment_builder_insert(z_owned_attachment_builder_t *this_, z_bytes_t key, z_bytes_t value) {
+    size_t len = this_->_bytes.len + _z_bytes_encode_len(&key) + _z_bytes_encode_len(&value);
+    if (len > this_->_capacity) {
+        size_t capacity = this_->_capacity * (size_t)2;
+        if (capacity < len) {
+            capacity = len;
+        }
+        uint8_t *buf = (uint8_t *)z_realloc((uint8_t *)this_->_bytes.start, capacity);
+        if (buf == NULL) {
+            return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+        this_->_bytes.start = buf;
+        this_->_capacity = capacity;
+    }
+
+    uint8_t *dst = (uint8_t *)&this_->_bytes.start[this_->_bytes.len];
+    dst = _z_attachment_builder_write(dst, key);
+    (void)_z_attachment_builder_write(dst, value);
+    this_->_bytes.len = len;
+    return _Z_RES_OK;
+}
+void z_attachment_builder_clear(z_owned_attachment_builder_t *this_) { this_->_bytes.len = 0; }
+z_attachment_t z_attachment_builder_as_attachment(const z_owned_attachment_builder_t *this_) {
+    if (!z_attachment_builder_check(this_)) {
+        return z_attachment_null();
+    }
+    return _z_encoded_attachment_wrap(&this_->_bytes);
+}
 z_bytes_t z_bytes_from_str(const char *str) { return z_bytes_wrap((const uint8_t *)str, strlen(str)); }
 z_bytes_t z_bytes_null(void) { return (z_bytes_t){.len = 0, ._is_alloc = false, .start = NULL}; }
 #endif
\ No newline at end of file
@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/api/handlers.h"
+
+#include <stddef.h>
+
+#include "zenoh-pico/api/primitives.h"
+#include "zenoh-pico/net/memory.h"
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/utils/result.h"
+
+#if Z_FEATURE_MULTI_THREAD == 1
+/*------------------ Channel elements ------------------*/
+// The sample is only borrowed for the time of the callback, so the channel holds a copy of it
+static void *_z_channel_sample_elem(const z_sample_t *sample) {
+    _z_sample_t *elem = (_z_sample_t *)z_malloc(sizeof(_z_sample_t));
+    if (elem != NULL) {
+        _z_sample_copy(elem, sample);
+    }
+    return elem;
+}
+
+static void _z_channel_sample_elem_free(void **elem) { _z_sample_free((_z_sample_t **)elem); }
+
+static void _z_channel_sample_elem_move(z_owned_sample_t *sample, void *elem) { sample->_value = (z_sample_t *)elem; }
+
+#if Z_FEATURE_QUERY == 1
+// The reply is owned by the callback, so the channel takes it over
+static void *_z_channel_reply_elem(z_owned_reply_t *reply) {
+    z_reply_t *elem = reply->_value;
+    reply->_value = NULL;
+    return elem;
+}
+
+static void _z_channel_reply_elem_free(void **elem) { _z_reply_free((_z_reply_t **)elem); }
+
+static void _z_channel_reply_elem_move(z_owned_reply_t *reply, void *elem) { reply->_value = (z_reply_t *)elem; }
+#endif
+
+#if Z_FEATURE_QUERYABLE == 1
+// The query is shared with the queryable, and its final reply is sent once the channel drops its own reference
+static void *_z_channel_query_elem(const z_query_t *query) {
+    return _z_query_rc_clone_as_ptr((_z_query_rc_t *)&query->_val._rc);
+}
+
+static void _z_channel_query_elem_free(void **elem) {
+    _z_query_rc_t *ptr = (_z_query_rc_t *)*elem;
+    if (ptr != NULL) {
+        _z_query_rc_drop(ptr);
+        z_free(ptr);
+        *elem = NULL;
+    }
+}
+
+static void _z_channel_query_elem_move(z_owned_query_t *query, void *elem) {
+    query->_rc = *(_z_query_rc_t *)elem;
+    z_free(elem);
+}
+#endif
+
+/*------------------ Channels ------------------*/
+// The context of the send closure is its own reference to the ring
+static void _z_channel_close(void *ctx) {
+    _z_ring_mt_t *ring = (_z_ring_mt_t *)ctx;
+    if (ring != NULL) {
+        _z_ring_mt_close(ring);
+        _z_ring_mt_free(&ring);
+    }
+}
+
+#define _Z_CHANNEL_DEFINE(kind, name, send_arg_t, f_push)                                                            \
+    static void _z_##kind##_channel_##name##_send(send_arg_t e, void *ctx) {                                         \
+        void *elem = _z_channel_##name##_elem(e);                                                                    \
+        if (elem != NULL) {                                                                                          \
+            (void)f_push((_z_ring_mt_t *)ctx, elem);                                                                 \
+        }                                                                                                            \
+    }                                                                                                                \
+                                                                                                                     \
+    z_owned_##kind##_channel_##name##_t z_##kind##_channel_##name##_new(size_t capacity) {                           \
+        z_owned_##kind##_channel_##name##_t ch = z_##kind##_channel_##name##_null();                                 \
+        ch._ring = _z_ring_mt_new(capacity, _z_channel_##name##_elem_free);                                          \
+        if (ch._ring != NULL) {                                                                                      \
+            ch.send = z_closure_##name(_z_##kind##_channel_##name##_send, _z_channel_close,                          \
+                                       _z_ring_mt_clone(ch._ring));                                                  \
+        }                                                                                                            \
+        return ch;                                                                                                   \
+    }                                                                                                                \
+                                                                                                                     \
+    int8_t z_##kind##_channel_##name##_recv(const z_owned_##kind##_channel_##name##_t *channel,                      \
+                                            z_owned_##name##_t *e) {                                                 \
+        *e = z_##name##_null();                                                                                      \
+        void *elem = _z_ring_mt_pull(channel->_ring);                                                                \
+        if (elem == NULL) {                                                                                          \
+            return _Z_ERR_CHANNEL_CLOSED;                                                                            \
+        }                                                                                                            \
+        _z_channel_##name##_elem_move(e, elem);                                                                      \
+        return _Z_RES_OK;                                                                                            \
+    }                                                                                                                \
+                                                                                                                     \
+    int8_t z_##kind##_channel_##name##_try_recv(const z_owned_##kind##_channel_##name##_t *channel,                  \
+                                                z_owned_##name##_t *e) {                                             \
+        *e = z_##name##_null();                                                                                      \
+        void *elem = _z_ring_mt_try_pull(channel->_ring);                                                            \
+        if (elem == NULL) {                                                                                          \
+            if (_z_ring_mt_is_closed(channel->_ring) == false) {                                                     \
+                return _Z_ERR_CHANNEL_EMPTY;                                                                         \
+            }                                                                                                        \
+            /* An element may have been pushed right before the channel got closed */                                \
+            elem = _z_ring_mt_try_pull(channel->_ring);                                                              \
+            if (elem == NULL) {                                                                                      \
+                return _Z_ERR_CHANNEL_CLOSED;                                                                        \
+            }                                                                                                        \
+        }                                                                                                            \
+        _z_channel_##name##_elem_move(e, elem);                                                                      \
+        return _Z_RES_OK;                                                                                            \
+    }                                                                                                                \
+                                                                                                                     \
+    _Bool z_##kind##_channel_##name##_check(const z_owned_##kind##_channel_##name##_t *channel) {                    \
+        return channel->_ring != NULL;                                                                               \
+    }                                                                                                                \
+                                                                                                                     \
+    z_owned_##kind##_channel_##name##_t *z_##kind##_channel_##name##_move(z_owned_##kind##_channel_##name##_t *ch) { \
+        return ch;                                                                                                   \
+    }                                                                                                                \
+                                                                                                                     \
+    void z_##kind##_channel_##name##_drop(z_owned_##kind##_channel_##name##_t *channel) {                            \
+        z_closure_##name##_drop(&channel->send);                                                                     \
+        if (channel->_ring != NULL) {                                                                                \
+            _z_channel_close(channel->_ring);                                                                        \
+            channel->_ring = NULL;                                                                                   \
+        }                                                                                                            \
+    }                                                                                                                \
+                                                                                                                     \
+    z_owned_##kind##_channel_##name##_t z_##kind##_channel_##name##_null(void) {                                     \
+        return (z_owned_##kind##_channel_##name##_t){.send = z_closure_##name##_null(), ._ring = NULL};              \
+    }
+
+_Z_CHANNEL_DEFINE(fifo, sample, const z_sample_t *, _z_ring_mt_push)
+_Z_CHANNEL_DEFINE(ring, sample, const z_sample_t *, _z_ring_mt_push_force)
+#if Z_FEATURE_QUERY == 1
+_Z_CHANNEL_DEFINE(fifo, reply, z_owned_reply_t *, _z_ring_mt_push)
+_Z_CHANNEL_DEFINE(ring, reply, z_owned_reply_t *, _z_ring_mt_push_force)
+#endif
+#if Z_FEATURE_QUERYABLE == 1
+_Z_CHANNEL_DEFINE(fifo, query, const z_query_t *, _z_ring_mt_push)
+_Z_CHANNEL_DEFINE(ring, query, const z_query_t *, _z_ring_mt_push_force)
+#endif
+#endif  // Z_FEATURE_MULTI_THREAD == 1
@@ -45,6 +45,19 @@ _z_bytes_t _z_bytes_make(size_t capacity) {
     return bs;
 }
 
+int8_t _z_bytes_reserve(_z_bytes_t *bs, size_t len) {
+    int8_t ret = _Z_RES_OK;
+
+    if ((bs->start != NULL) && (bs->len >= len)) {
+        bs->len = len;
+    } else {
+        _z_bytes_clear(bs);
+        ret = _z_bytes_init(bs, len);
+    }
+
+    return ret;
+}
+
 _z_bytes_t _z_bytes_wrap(const uint8_t *p, size_t len) {
     _z_bytes_t bs;
     bs.start = p;
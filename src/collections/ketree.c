@@ -0,0 +1,267 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/collections/ketree.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "zenoh-pico/collections/string.h"
+#include "zenoh-pico/protocol/keyexpr.h"
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/utils/result.h"
+
+/*-------- Key expression tree --------*/
+typedef struct {
+    const char *_key;
+    size_t _key_len;
+    size_t _epoch;
+    _z_ketree_visit_f _visit;
+    void *_arg;
+} _z_ketree_query_t;
+
+// Returns the end of the chunk starting at `chunk`, i.e. the next delimiter or the end of the string
+static inline const char *_z_ketree_chunk_end(const char *chunk) {
+    const char *end = strchr(chunk, '/');
+    return (end != NULL) ? end : &chunk[strlen(chunk)];
+}
+
+// Returns the start of the chunk following the one ending at `end`, or NULL if it was the last one
+static inline const char *_z_ketree_chunk_next(const char *end) { return (end[0] == '/') ? &end[1] : NULL; }
+
+static inline _Bool _z_ketree_is_superwild(const char *chunk, size_t len) {
+    return (len == (size_t)2) && (chunk[0] == '*') && (chunk[1] == '*');
+}
+
+static _z_ketree_node_t *_z_ketree_node_new(_z_ketree_node_t *parent, const char *chunk, size_t len) {
+    _z_ketree_node_t *node = (_z_ketree_node_t *)z_malloc(sizeof(_z_ketree_node_t));
+    if (node == NULL) {
+        return NULL;
+    }
+    (void)memset(node, 0, sizeof(_z_ketree_node_t));
+    node->_parent = parent;
+    if (chunk != NULL) {
+        node->_chunk = (char *)z_malloc(len + (size_t)1);
+        if (node->_chunk == NULL) {
+            z_free(node);
+            return NULL;
+        }
+        (void)memcpy(node->_chunk, chunk, len);
+        node->_chunk[len] = '\0';
+    }
+    return node;
+}
+
+static void _z_ketree_node_free(_z_ketree_node_t **node) {
+    _z_ketree_node_t *ptr = *node;
+    if (ptr != NULL) {
+        for (size_t i = 0; i < ptr->_children_len; i++) {
+            _z_ketree_node_free(&ptr->_children[i]);
+        }
+        z_free(ptr->_children);
+        _z_list_free(&ptr->_vals, _z_noop_free);
+        z_free(ptr->_key);
+        z_free(ptr->_chunk);
+        z_free(ptr);
+        *node = NULL;
+    }
+}
+
+static _z_ketree_node_t *_z_ketree_node_child(const _z_ketree_node_t *node, const char *chunk, size_t len) {
+    for (size_t i = 0; i < node->_children_len; i++) {
+        _z_ketree_node_t *child = node->_children[i];
+        if ((strncmp(child->_chunk, chunk, len) == 0) && (child->_chunk[len] == '\0')) {
+            return child;
+        }
+    }
+    return NULL;
+}
+
+static _z_ketree_node_t *_z_ketree_node_add_child(_z_ketree_node_t *node, const char *chunk, size_t len) {
+    if (node->_children_len == node->_children_capacity) {
+        size_t capacity = (node->_children_capacity == (size_t)0) ? (size_t)2 : node->_children_capacity * (size_t)2;
+        _z_ketree_node_t **children =
+            (_z_ketree_node_t **)z_realloc(node->_children, capacity * sizeof(_z_ketree_node_t *));
+        if (children == NULL) {
+            return NULL;
+        }
+        node->_children = children;
+        node->_children_capacity = capacity;
+    }
+    _z_ketree_node_t *child = _z_ketree_node_new(node, chunk, len);
+    if (child != NULL) {
+        node->_children[node->_children_len] = child;
+        node->_children_len++;
+    }
+    return child;
+}
+
+// Free the nodes that neither hold values nor lead to any, from `node` up to the root
+static void _z_ketree_prune(_z_ketree_t *tree, _z_ketree_node_t *node) {
+    while ((node != NULL) && (node->_vals == NULL) && (node->_children_len == (size_t)0)) {
+        _z_ketree_node_t *parent = node->_parent;
+        if (parent == NULL) {
+            tree->_root = NULL;
+        } else {
+            for (size_t i = 0; i < parent->_children_len; i++) {
+                if (parent->_children[i] == node) {
+                    parent->_children_len--;
+                    parent->_children[i] = parent->_children[parent->_children_len];
+                    break;
+                }
+            }
+        }
+        _z_ketree_node_free(&node);
+        node = parent;
+    }
+}
+
+void _z_ketree_init(_z_ketree_t *tree) {
+    tree->_root = NULL;
+    tree->_epoch = 0;
+}
+
+int8_t _z_ketree_insert(_z_ketree_t *tree, const char *key, void *val) {
+    if (tree->_root == NULL) {
+        tree->_root = _z_ketree_node_new(NULL, NULL, 0);
+        if (tree->_root == NULL) {
+            return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+    }
+
+    _z_ketree_node_t *node = tree->_root;
+    const char *chunk = key;
+    while ((chunk != NULL) && (node != NULL)) {
+        const char *end = _z_ketree_chunk_end(chunk);
+        size_t len = (size_t)(end - chunk);
+        _z_ketree_node_t *child = _z_ketree_node_child(node, chunk, len);
+        if (child == NULL) {
+            child = _z_ketree_node_add_child(node, chunk, len);
+            if (child == NULL) {
+                _z_ketree_prune(tree, node);
+            }
+        }
+        node = child;
+        chunk = _z_ketree_chunk_next(end);
+    }
+    if (node == NULL) {
+        return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    }
+
+    if (node->_key == NULL) {
+        node->_key = _z_str_clone(key);
+        if (node->_key == NULL) {
+            _z_ketree_prune(tree, node);
+            return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+        node->_key_len = strlen(key);
+    }
+    node->_vals = _z_list_push(node->_vals, val);
+    return _Z_RES_OK;
+}
+
+static _Bool _z_ketree_ptr_eq(const void *left, const void *right) { return left == right; }
+
+_Bool _z_ketree_remove(_z_ketree_t *tree, const char *key, const void *val) {
+    _z_ketree_node_t *node = tree->_root;
+    const char *chunk = key;
+    while ((chunk != NULL) && (node != NULL)) {
+        const char *end = _z_ketree_chunk_end(chunk);
+        node = _z_ketree_node_child(node, chunk, (size_t)(end - chunk));
+        chunk = _z_ketree_chunk_next(end);
+    }
+    if ((node == NULL) || (_z_list_find(node->_vals, _z_ketree_ptr_eq, (void *)val) == NULL)) {
+        return false;
+    }
+
+    node->_vals = _z_list_drop_filter(node->_vals, _z_noop_free, _z_ketree_ptr_eq, (void *)val);
+    if (node->_vals == NULL) {
+        z_free(node->_key);
+        node->_key = NULL;
+        node->_key_len = 0;
+    }
+    _z_ketree_prune(tree, node);
+    return true;
+}
+
+static void _z_ketree_report(_z_ketree_node_t *node, _z_ketree_query_t *query) {
+    if ((node->_vals == NULL) || (node->_mark == query->_epoch)) {
+        return;
+    }
+    node->_mark = query->_epoch;
+    // The walk only prunes on chunks, the full check keeps the semantics of _z_keyexpr_intersects (e.g. verbatim chunks)
+    if (_z_keyexpr_intersects(node->_key, node->_key_len, query->_key, query->_key_len) == true) {
+        _z_list_t *xs = node->_vals;
+        while (xs != NULL) {
+            query->_visit(_z_list_head(xs), query->_arg);
+            xs = _z_list_tail(xs);
+        }
+    }
+}
+
+// `chunk` is the next chunk of the queried key expression to match below `node`, NULL once it has been fully matched
+static void _z_ketree_match(_z_ketree_node_t *node, const char *chunk, _z_ketree_query_t *query) {
+    if (chunk == NULL) {
+        _z_ketree_report(node, query);
+        // A stored `**` may match no chunk at all
+        _z_ketree_node_t *superwild = _z_ketree_node_child(node, "**", 2);
+        if (superwild != NULL) {
+            _z_ketree_match(superwild, NULL, query);
+        }
+        return;
+    }
+
+    const char *end = _z_ketree_chunk_end(chunk);
+    size_t len = (size_t)(end - chunk);
+    const char *next = _z_ketree_chunk_next(end);
+    _Bool is_superwild = _z_ketree_is_superwild(chunk, len);
+
+    for (size_t i = 0; i < node->_children_len; i++) {
+        _z_ketree_node_t *child = node->_children[i];
+        size_t child_len = strlen(child->_chunk);
+        if (_z_ketree_is_superwild(child->_chunk, child_len) == true) {
+            // A stored `**` may match any number of the remaining chunks
+            for (const char *c = chunk; c != NULL; c = _z_ketree_chunk_next(_z_ketree_chunk_end(c))) {
+                _z_ketree_match(child, c, query);
+            }
+            _z_ketree_match(child, NULL, query);
+        } else if (is_superwild == true) {
+            // A queried `**` may match this chunk and any number of the following ones
+            _z_ketree_match(child, chunk, query);
+        } else if (_z_keyexpr_chunk_intersects(child->_chunk, child_len, chunk, len) == true) {
+            _z_ketree_match(child, next, query);
+        }
+    }
+    if (is_superwild == true) {
+        // A queried `**` may match no chunk at all
+        _z_ketree_match(node, next, query);
+    }
+}
+
+void _z_ketree_intersecting(_z_ketree_t *tree, const char *key, _z_ketree_visit_f visit, void *arg) {
+    if ((tree->_root == NULL) || (key == NULL)) {
+        return;
+    }
+    tree->_epoch++;
+    _z_ketree_query_t query = {
+        ._key = key, ._key_len = strlen(key), ._epoch = tree->_epoch, ._visit = visit, ._arg = arg};
+    _z_ketree_match(tree->_root, key, &query);
+}
+
+_Bool _z_ketree_is_empty(const _z_ketree_t *tree) { return tree->_root == NULL; }
+
+void _z_ketree_clear(_z_ketree_t *tree) {
+    _z_ketree_node_free(&tree->_root);
+    tree->_epoch = 0;
+}
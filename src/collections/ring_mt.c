@@ -0,0 +1,344 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/collections/ring_mt.h"
+
+#include <stddef.h>
+
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/utils/result.h"
+
+#if Z_FEATURE_MULTI_THREAD == 1
+
+#if ZENOH_C_STANDARD != 99
+#include <stdatomic.h>
+
+typedef atomic_size_t _z_ring_mt_pos_t;
+
+static inline size_t _z_ring_mt_load(const _z_ring_mt_pos_t *pos) {
+    return atomic_load_explicit((_z_ring_mt_pos_t *)pos, memory_order_acquire);
+}
+
+static inline void _z_ring_mt_store(_z_ring_mt_pos_t *pos, size_t val) {
+    atomic_store_explicit(pos, val, memory_order_release);
+}
+
+static inline _Bool _z_ring_mt_cas(_z_ring_mt_pos_t *pos, size_t expected, size_t desired) {
+    return atomic_compare_exchange_weak_explicit(pos, &expected, desired, memory_order_relaxed, memory_order_relaxed);
+}
+
+static inline size_t _z_ring_mt_fetch_add(_z_ring_mt_pos_t *pos, size_t val) {
+    return atomic_fetch_add_explicit(pos, val, memory_order_acq_rel);
+}
+
+static inline size_t _z_ring_mt_fetch_sub(_z_ring_mt_pos_t *pos, size_t val) {
+    return atomic_fetch_sub_explicit(pos, val, memory_order_acq_rel);
+}
+
+static inline void _z_ring_mt_fence(void) { atomic_thread_fence(memory_order_seq_cst); }
+#else  // ZENOH_C_STANDARD == 99
+#ifdef ZENOH_COMPILER_GCC
+typedef volatile size_t _z_ring_mt_pos_t;
+
+static inline size_t _z_ring_mt_load(const _z_ring_mt_pos_t *pos) {
+    size_t val = *pos;
+    __sync_synchronize();
+    return val;
+}
+
+static inline void _z_ring_mt_store(_z_ring_mt_pos_t *pos, size_t val) {
+    __sync_synchronize();
+    *pos = val;
+}
+
+static inline _Bool _z_ring_mt_cas(_z_ring_mt_pos_t *pos, size_t expected, size_t desired) {
+    return __sync_bool_compare_and_swap(pos, expected, desired);
+}
+
+static inline size_t _z_ring_mt_fetch_add(_z_ring_mt_pos_t *pos, size_t val) { return __sync_fetch_and_add(pos, val); }
+
+static inline size_t _z_ring_mt_fetch_sub(_z_ring_mt_pos_t *pos, size_t val) { return __sync_fetch_and_sub(pos, val); }
+
+static inline void _z_ring_mt_fence(void) { __sync_synchronize(); }
+#else  // !ZENOH_COMPILER_GCC
+#error "Multi-thread ring in C99 only exists for GCC, use GCC or C11 or deactivate multi-thread"
+#endif  // ZENOH_COMPILER_GCC
+#endif  // ZENOH_C_STANDARD != 99
+
+typedef struct {
+    _z_ring_mt_pos_t _seq;
+    void *_elem;
+} _z_ring_mt_slot_t;
+
+/**
+ * The slots are handed over between the producers and the consumers with a sequence number each: a slot is free for
+ * the producer reaching position ``pos`` when its sequence number is ``pos``, and holds an element for the consumer
+ * reaching position ``pos`` when its sequence number is ``pos + 1``.
+ */
+struct _z_ring_mt_t {
+    _z_ring_mt_slot_t *_slots;
+    size_t _mask;
+    _z_ring_mt_pos_t _push_pos;
+    _z_ring_mt_pos_t _pull_pos;
+    z_element_free_f _f_f;
+    _z_ring_mt_pos_t _owners;
+    _z_ring_mt_pos_t _closed;
+
+    // Only used to sleep when the ring is empty, or full
+    z_mutex_t _mutex;
+    z_condvar_t _cond_elem;
+    z_condvar_t _cond_room;
+    _z_ring_mt_pos_t _pullers_waiting;
+    _z_ring_mt_pos_t _pushers_waiting;
+    _Bool _woken;
+};
+
+_z_ring_mt_t *_z_ring_mt_new(size_t capacity, z_element_free_f f_f) {
+    size_t size = 1;
+    while (size < capacity) {
+        size = size << 1;
+    }
+
+    _z_ring_mt_t *ring = (_z_ring_mt_t *)z_malloc(sizeof(_z_ring_mt_t));
+    if (ring == NULL) {
+        return NULL;
+    }
+    ring->_slots = (_z_ring_mt_slot_t *)z_malloc(size * sizeof(_z_ring_mt_slot_t));
+    if (ring->_slots == NULL) {
+        z_free(ring);
+        return NULL;
+    }
+    if (z_mutex_init(&ring->_mutex) != _Z_RES_OK) {
+        z_free(ring->_slots);
+        z_free(ring);
+        return NULL;
+    }
+    if (z_condvar_init(&ring->_cond_elem) != _Z_RES_OK) {
+        z_mutex_free(&ring->_mutex);
+        z_free(ring->_slots);
+        z_free(ring);
+        return NULL;
+    }
+    if (z_condvar_init(&ring->_cond_room) != _Z_RES_OK) {
+        z_condvar_free(&ring->_cond_elem);
+        z_mutex_free(&ring->_mutex);
+        z_free(ring->_slots);
+        z_free(ring);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        _z_ring_mt_store(&ring->_slots[i]._seq, i);
+        ring->_slots[i]._elem = NULL;
+    }
+    ring->_mask = size - (size_t)1;
+    _z_ring_mt_store(&ring->_push_pos, 0);
+    _z_ring_mt_store(&ring->_pull_pos, 0);
+    ring->_f_f = f_f;
+    _z_ring_mt_store(&ring->_owners, 1);
+    _z_ring_mt_store(&ring->_closed, 0);
+    _z_ring_mt_store(&ring->_pullers_waiting, 0);
+    _z_ring_mt_store(&ring->_pushers_waiting, 0);
+    ring->_woken = false;
+    return ring;
+}
+
+_z_ring_mt_t *_z_ring_mt_clone(_z_ring_mt_t *ring) {
+    (void)_z_ring_mt_fetch_add(&ring->_owners, 1);
+    return ring;
+}
+
+void _z_ring_mt_free(_z_ring_mt_t **ring) {
+    _z_ring_mt_t *ptr = *ring;
+    if (ptr != NULL) {
+        if (_z_ring_mt_fetch_sub(&ptr->_owners, 1) == (size_t)1) {
+            void *elem = _z_ring_mt_try_pull(ptr);
+            while (elem != NULL) {
+                ptr->_f_f(&elem);
+                elem = _z_ring_mt_try_pull(ptr);
+            }
+            z_condvar_free(&ptr->_cond_room);
+            z_condvar_free(&ptr->_cond_elem);
+            z_mutex_free(&ptr->_mutex);
+            z_free(ptr->_slots);
+            z_free(ptr);
+        }
+        *ring = NULL;
+    }
+}
+
+size_t _z_ring_mt_capacity(const _z_ring_mt_t *ring) { return ring->_mask + (size_t)1; }
+
+void _z_ring_mt_close(_z_ring_mt_t *ring) {
+    z_mutex_lock(&ring->_mutex);
+    _z_ring_mt_store(&ring->_closed, 1);
+    // Each woken up thread wakes up the next one
+    z_condvar_signal(&ring->_cond_elem);
+    z_condvar_signal(&ring->_cond_room);
+    z_mutex_unlock(&ring->_mutex);
+}
+
+_Bool _z_ring_mt_is_closed(const _z_ring_mt_t *ring) { return _z_ring_mt_load(&ring->_closed) != (size_t)0; }
+
+static _Bool _z_ring_mt_put(_z_ring_mt_t *ring, void *elem) {
+    size_t pos = _z_ring_mt_load(&ring->_push_pos);
+    for (;;) {
+        _z_ring_mt_slot_t *slot = &ring->_slots[pos & ring->_mask];
+        ptrdiff_t diff = (ptrdiff_t)(_z_ring_mt_load(&slot->_seq) - pos);
+        if (diff == 0) {
+            if (_z_ring_mt_cas(&ring->_push_pos, pos, pos + (size_t)1) == true) {
+                slot->_elem = elem;
+                _z_ring_mt_store(&slot->_seq, pos + (size_t)1);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // The slot still holds the element pushed one lap before, the ring is full
+        }
+        pos = _z_ring_mt_load(&ring->_push_pos);
+    }
+}
+
+static void *_z_ring_mt_take(_z_ring_mt_t *ring) {
+    size_t pos = _z_ring_mt_load(&ring->_pull_pos);
+    for (;;) {
+        _z_ring_mt_slot_t *slot = &ring->_slots[pos & ring->_mask];
+        ptrdiff_t diff = (ptrdiff_t)(_z_ring_mt_load(&slot->_seq) - (pos + (size_t)1));
+        if (diff == 0) {
+            if (_z_ring_mt_cas(&ring->_pull_pos, pos, pos + (size_t)1) == true) {
+                void *elem = slot->_elem;
+                slot->_elem = NULL;
+                // Hand the slot over to the producer of the next lap
+                _z_ring_mt_store(&slot->_seq, pos + ring->_mask + (size_t)1);
+                return elem;
+            }
+        } else if (diff < 0) {
+            return NULL;  // The slot has not been filled yet, the ring is empty
+        }
+        pos = _z_ring_mt_load(&ring->_pull_pos);
+    }
+}
+
+// Pairs with the fence of the producers going to wait: either they see the room, or they are seen waiting
+static _Bool _z_ring_mt_has_pushers_waiting(_z_ring_mt_t *ring) {
+    _z_ring_mt_fence();
+    return _z_ring_mt_load(&ring->_pushers_waiting) != (size_t)0;
+}
+
+void *_z_ring_mt_try_pull(_z_ring_mt_t *ring) {
+    void *elem = _z_ring_mt_take(ring);
+    if ((elem != NULL) && (_z_ring_mt_has_pushers_waiting(ring) == true)) {
+        z_mutex_lock(&ring->_mutex);
+        z_condvar_signal(&ring->_cond_room);
+        z_mutex_unlock(&ring->_mutex);
+    }
+    return elem;
+}
+
+static void _z_ring_mt_notify_elem(_z_ring_mt_t *ring) {
+    // Pairs with the fence of the consumers going to sleep: either they see the element, or they are seen sleeping
+    _z_ring_mt_fence();
+    if (_z_ring_mt_load(&ring->_pullers_waiting) != (size_t)0) {
+        z_mutex_lock(&ring->_mutex);
+        z_condvar_signal(&ring->_cond_elem);
+        z_mutex_unlock(&ring->_mutex);
+    }
+}
+
+static _Bool _z_ring_mt_drop_if_closed(_z_ring_mt_t *ring, void *elem) {
+    if (_z_ring_mt_is_closed(ring) == true) {
+        ring->_f_f(&elem);
+        return true;
+    }
+    return false;
+}
+
+_Bool _z_ring_mt_push(_z_ring_mt_t *ring, void *elem) {
+    if (_z_ring_mt_drop_if_closed(ring, elem) == true) {
+        return false;
+    }
+    if (_z_ring_mt_put(ring, elem) == false) {
+        z_mutex_lock(&ring->_mutex);
+        (void)_z_ring_mt_fetch_add(&ring->_pushers_waiting, 1);
+        _z_ring_mt_fence();
+        _Bool pushed = _z_ring_mt_put(ring, elem);
+        while ((pushed == false) && (_z_ring_mt_is_closed(ring) == false)) {
+            z_condvar_wait(&ring->_cond_room, &ring->_mutex);
+            pushed = _z_ring_mt_put(ring, elem);
+        }
+        (void)_z_ring_mt_fetch_sub(&ring->_pushers_waiting, 1);
+        if (pushed == false) {
+            z_condvar_signal(&ring->_cond_room);
+        }
+        z_mutex_unlock(&ring->_mutex);
+        if (pushed == false) {
+            ring->_f_f(&elem);
+            return false;
+        }
+    }
+    _z_ring_mt_notify_elem(ring);
+    return true;
+}
+
+_Bool _z_ring_mt_push_force(_z_ring_mt_t *ring, void *elem) {
+    if (_z_ring_mt_drop_if_closed(ring, elem) == true) {
+        return false;
+    }
+    while (_z_ring_mt_put(ring, elem) == false) {
+        void *oldest = _z_ring_mt_try_pull(ring);
+        if (oldest != NULL) {
+            ring->_f_f(&oldest);
+        }
+    }
+    _z_ring_mt_notify_elem(ring);
+    return true;
+}
+
+_Bool _z_ring_mt_try_push(_z_ring_mt_t *ring, void *elem) {
+    if ((_z_ring_mt_is_closed(ring) == true) || (_z_ring_mt_put(ring, elem) == false)) {
+        return false;
+    }
+    _z_ring_mt_notify_elem(ring);
+    return true;
+}
+
+void *_z_ring_mt_pull(_z_ring_mt_t *ring) {
+    void *elem = _z_ring_mt_try_pull(ring);
+    if (elem == NULL) {
+        z_mutex_lock(&ring->_mutex);
+        (void)_z_ring_mt_fetch_add(&ring->_pullers_waiting, 1);
+        _z_ring_mt_fence();
+        elem = _z_ring_mt_take(ring);
+        while ((elem == NULL) && (_z_ring_mt_is_closed(ring) == false) && (ring->_woken == false)) {
+            z_condvar_wait(&ring->_cond_elem, &ring->_mutex);
+            elem = _z_ring_mt_take(ring);
+        }
+        (void)_z_ring_mt_fetch_sub(&ring->_pullers_waiting, 1);
+        ring->_woken = false;
+        if (elem == NULL) {
+            z_condvar_signal(&ring->_cond_elem);
+        } else if (_z_ring_mt_has_pushers_waiting(ring) == true) {
+            z_condvar_signal(&ring->_cond_room);
+        }
+        z_mutex_unlock(&ring->_mutex);
+    }
+    return elem;
+}
+
+void _z_ring_mt_wake(_z_ring_mt_t *ring) {
+    z_mutex_lock(&ring->_mutex);
+    ring->_woken = true;
+    z_condvar_signal(&ring->_cond_elem);
+    z_mutex_unlock(&ring->_mutex);
+}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
@@ -151,6 +151,25 @@ size_t _z_link_recv_exact_zbuf(const _z_link_t *link, _z_zbuf_t *zbf, size_t len
     return rb;
 }
 
+static int8_t __z_link_send_bytes(const _z_link_t *link, _z_bytes_t bs, _Bool link_is_streamed) {
+    int8_t ret = _Z_RES_OK;
+    size_t n = bs.len;
+    do {
+        size_t wb = link->_write_f(link, bs.start, n);
+        if (wb == SIZE_MAX) {
+            ret = _Z_ERR_TRANSPORT_TX_FAILED;
+            break;
+        }
+        if (link_is_streamed && wb != n) {
+            ret = _Z_ERR_TRANSPORT_TX_FAILED;
+            break;
+        }
+        n = n - wb;
+        bs.start = bs.start + (bs.len - n);
+    } while (n > (size_t)0);
+    return ret;
+}
+
 int8_t _z_link_send_wbuf(const _z_link_t *link, const _z_wbuf_t *wbf) {
     int8_t ret = _Z_RES_OK;
     _Bool link_is_streamed = false;
@@ -164,22 +183,32 @@ int8_t _z_link_send_wbuf(const _z_link_t *link, const _z_wbuf_t *wbf) {
             link_is_streamed = false;
             break;
     }
-    for (size_t i = 0; (i < _z_wbuf_len_iosli(wbf)) && (ret == _Z_RES_OK); i++) {
-        _z_bytes_t bs = _z_iosli_to_bytes(_z_wbuf_get_iosli(wbf, i));
-        size_t n = bs.len;
-        do {
-            size_t wb = link->_write_f(link, bs.start, n);
-            if (wb == SIZE_MAX) {
-                ret = _Z_ERR_TRANSPORT_TX_FAILED;
-                break;
-            }
-            if (link_is_streamed && wb != n) {
-                ret = _Z_ERR_TRANSPORT_TX_FAILED;
-                break;
-            }
-            n = n - wb;
-            bs.start = bs.start + (bs.len - n);
-        } while (n > (size_t)0);
+
+    size_t n_iosli = _z_wbuf_len_iosli(wbf);
+    if ((n_iosli > (size_t)1) && (n_iosli <= (size_t)_Z_LINK_WRITE_VEC_MAX) && (link->_write_vec_f != NULL)) {
+        // Send all the ioslices with a single call, e.g. a header and an aliased payload
+        _z_bytes_t bufs[_Z_LINK_WRITE_VEC_MAX];
+        size_t len = 0;
+        for (size_t i = 0; i < n_iosli; i++) {
+            bufs[i] = _z_iosli_to_bytes(_z_wbuf_get_iosli(wbf, i));
+            len = len + bufs[i].len;
+        }
+        if (link->_write_vec_f(link, bufs, n_iosli) != len) {
+            ret = _Z_ERR_TRANSPORT_TX_FAILED;
+        }
+    } else if ((n_iosli > (size_t)1) && (link_is_streamed == false)) {
+        // A datagram cannot be split over several writes, gather the ioslices first
+        _z_zbuf_t zbf = _z_wbuf_to_zbuf(wbf);
+        if (_z_zbuf_capacity(&zbf) == _z_wbuf_len(wbf)) {
+            ret = __z_link_send_bytes(link, _z_bytes_wrap(_z_zbuf_start(&zbf), _z_zbuf_len(&zbf)), false);
+        } else {
+            ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+        _z_zbuf_clear(&zbf);
+    } else {
+        for (size_t i = 0; (i < n_iosli) && (ret == _Z_RES_OK); i++) {
+            ret = __z_link_send_bytes(link, _z_iosli_to_bytes(_z_wbuf_get_iosli(wbf, i)), link_is_streamed);
+        }
     }
 
     return ret;
@@ -51,6 +51,68 @@ int8_t _z_endpoint_serial_valid(_z_endpoint_t *endpoint) {
     return ret;
 }
 
+/*------------------ Serial framing ------------------*/
+int8_t _z_serial_buffers_init(_z_serial_socket_t *sock) {
+    sock->_bufs = (_z_serial_buffers_t *)z_malloc(sizeof(_z_serial_buffers_t));
+    if (sock->_bufs == NULL) {
+        return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    }
+    sock->_bufs->_rx_pos = 0;
+    sock->_bufs->_rx_len = 0;
+    _z_serial_decoder_reset(&sock->_bufs->_dec);
+    return _Z_RES_OK;
+}
+
+void _z_serial_buffers_clear(_z_serial_socket_t *sock) {
+    z_free(sock->_bufs);
+    sock->_bufs = NULL;
+}
+
+size_t _z_read_serial(const _z_serial_socket_t *sock, uint8_t *ptr, size_t len) {
+    _z_serial_buffers_t *bufs = sock->_bufs;
+    for (;;) {
+        if (bufs->_rx_pos == bufs->_rx_len) {
+            size_t rb = _z_read_serial_internal(sock->_sock, bufs->_rx, sizeof(bufs->_rx));
+            if ((rb == SIZE_MAX) || (rb == (size_t)0)) {
+                return SIZE_MAX;  // The decoder keeps the frame in progress for the next read
+            }
+            bufs->_rx_pos = 0;
+            bufs->_rx_len = rb;
+        }
+
+        _Bool complete = false;
+        bufs->_rx_pos += _z_serial_decoder_feed(&bufs->_dec, &bufs->_rx[bufs->_rx_pos],
+                                                bufs->_rx_len - bufs->_rx_pos, &complete);
+        if (complete == true) {
+            return _z_serial_decoder_take(&bufs->_dec, ptr, len);
+        }
+    }
+}
+
+size_t _z_read_exact_serial(const _z_serial_socket_t *sock, uint8_t *ptr, size_t len) {
+    size_t n = 0;
+    do {
+        size_t rb = _z_read_serial(sock, &ptr[n], len - n);
+        if (rb == SIZE_MAX) {
+            return rb;
+        }
+        n = n + rb;
+    } while (n < len);
+
+    return len;
+}
+
+size_t _z_send_serial(const _z_serial_socket_t *sock, const uint8_t *ptr, size_t len) {
+    size_t twb = _z_serial_frame_encode(sock->_bufs->_tx, ptr, len);
+    if (twb == SIZE_MAX) {
+        return SIZE_MAX;
+    }
+    if (_z_send_serial_internal(sock->_sock, sock->_bufs->_tx, twb) != twb) {
+        return SIZE_MAX;
+    }
+    return len;
+}
+
 int8_t _z_f_link_open_serial(_z_link_t *self) {
     int8_t ret = _Z_RES_OK;
 
@@ -66,6 +128,12 @@ int8_t _z_f_link_open_serial(_z_link_t *self) {
     } else {
         ret = _z_open_serial_from_dev(&self->_socket._serial._sock, self->_endpoint._locator._address, baudrate);
     }
+    if (ret == _Z_RES_OK) {
+        ret = _z_serial_buffers_init(&self->_socket._serial);
+        if (ret != _Z_RES_OK) {
+            _z_close_serial(&self->_socket._serial._sock);
+        }
+    }
 
     return ret;
 }
@@ -85,30 +153,39 @@ int8_t _z_f_link_listen_serial(_z_link_t *self) {
     } else {
         ret = _z_listen_serial_from_dev(&self->_socket._serial._sock, self->_endpoint._locator._address, baudrate);
     }
+    if (ret == _Z_RES_OK) {
+        ret = _z_serial_buffers_init(&self->_socket._serial);
+        if (ret != _Z_RES_OK) {
+            _z_close_serial(&self->_socket._serial._sock);
+        }
+    }
 
     return ret;
 }
 
-void _z_f_link_close_serial(_z_link_t *self) { _z_close_serial(&self->_socket._serial._sock); }
+void _z_f_link_close_serial(_z_link_t *self) {
+    _z_close_serial(&self->_socket._serial._sock);
+    _z_serial_buffers_clear(&self->_socket._serial);
+}
 
 void _z_f_link_free_serial(_z_link_t *self) { (void)(self); }
 
 size_t _z_f_link_write_serial(const _z_link_t *self, const uint8_t *ptr, size_t len) {
-    return _z_send_serial(self->_socket._serial._sock, ptr, len);
+    return _z_send_serial(&self->_socket._serial, ptr, len);
 }
 
 size_t _z_f_link_write_all_serial(const _z_link_t *self, const uint8_t *ptr, size_t len) {
-    return _z_send_serial(self->_socket._serial._sock, ptr, len);
+    return _z_send_serial(&self->_socket._serial, ptr, len);
 }
 
 size_t _z_f_link_read_serial(const _z_link_t *self, uint8_t *ptr, size_t len, _z_bytes_t *addr) {
     (void)(addr);
-    return _z_read_serial(self->_socket._serial._sock, ptr, len);
+    return _z_read_serial(&self->_socket._serial, ptr, len);
 }
 
 size_t _z_f_link_read_exact_serial(const _z_link_t *self, uint8_t *ptr, size_t len, _z_bytes_t *addr) {
     (void)(addr);
-    return _z_read_exact_serial(self->_socket._serial._sock, ptr, len);
+    return _z_read_exact_serial(&self->_socket._serial, ptr, len);
 }
 
 uint16_t _z_get_link_mtu_serial(void) { return _Z_SERIAL_MTU_SIZE; }
@@ -123,6 +200,7 @@ int8_t _z_new_link_serial(_z_link_t *zl, _z_endpoint_t endpoint) {
     zl->_mtu = _z_get_link_mtu_serial();
 
     zl->_endpoint = endpoint;
+    zl->_socket._serial._bufs = NULL;
 
     zl->_open_f = _z_f_link_open_serial;
     zl->_listen_f = _z_f_link_listen_serial;
@@ -131,6 +209,7 @@ int8_t _z_new_link_serial(_z_link_t *zl, _z_endpoint_t endpoint) {
 
     zl->_write_f = _z_f_link_write_serial;
     zl->_write_all_f = _z_f_link_write_all_serial;
+    zl->_write_vec_f = NULL;
     zl->_read_f = _z_f_link_read_serial;
     zl->_read_exact_f = _z_f_link_read_exact_serial;
 
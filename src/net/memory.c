@@ -31,6 +31,25 @@ void _z_sample_move(_z_sample_t *dst, _z_sample_t *src) {
     dst->timestamp.id = src->timestamp.id;      // FIXME: call the z_timestamp_move
 }
 
+void _z_sample_copy(_z_sample_t *dst, const _z_sample_t *src) {
+    _z_keyexpr_copy(&dst->keyexpr, &src->keyexpr);
+    dst->payload = _z_bytes_empty();
+    if (src->payload.len > (size_t)0) {
+        _z_bytes_copy(&dst->payload, &src->payload);
+    }
+    dst->encoding.prefix = src->encoding.prefix;
+    dst->encoding.suffix = _z_bytes_empty();
+    if (src->encoding.suffix.len > (size_t)0) {
+        _z_bytes_copy(&dst->encoding.suffix, &src->encoding.suffix);
+    }
+    dst->timestamp = src->timestamp;
+    dst->kind = src->kind;
+    dst->qos = src->qos;
+#if Z_FEATURE_ATTACHMENT == 1
+    dst->attachment = z_attachment_null();
+#endif
+}
+
 void _z_sample_clear(_z_sample_t *sample) {
     _z_keyexpr_clear(&sample->keyexpr);
     _z_bytes_clear(&sample->payload);
@@ -22,6 +22,7 @@
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/net/logger.h"
 #include "zenoh-pico/net/memory.h"
+#include "zenoh-pico/protocol/codec/network.h"
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/protocol/definitions/declarations.h"
 #include "zenoh-pico/protocol/definitions/network.h"
@@ -99,7 +100,8 @@ int8_t _z_undeclare_resource(_z_session_t *zn, uint16_t rid) {
 #if Z_FEATURE_PUBLICATION == 1
 /*------------------  Publisher Declaration ------------------*/
 _z_publisher_t *_z_declare_publisher(_z_session_rc_t *zn, _z_keyexpr_t keyexpr,
-                                     z_congestion_control_t congestion_control, z_priority_t priority) {
+                                     z_congestion_control_t congestion_control, z_priority_t priority,
+                                     _Bool skip_unmatched) {
     // Allocate publisher
     _z_publisher_t *ret = (_z_publisher_t *)z_malloc(sizeof(_z_publisher_t));
     if (ret == NULL) {
@@ -110,6 +112,26 @@ _z_publisher_t *_z_declare_publisher(_z_session_rc_t *zn, _z_keyexpr_t keyexpr,
     ret->_id = _z_get_entity_id(&zn->in->val);
     ret->_congestion_control = congestion_control;
     ret->_priority = priority;
+    _z_n_msg_push_t push = {
+        ._key = ret->_key,
+        ._qos = _z_n_qos_make(0, congestion_control == Z_CONGESTION_CONTROL_BLOCK, priority),
+        ._timestamp = _z_timestamp_null(),
+        ._body._is_put = true,
+        ._body._body._put = {._commons = {._timestamp = _z_timestamp_null(), ._source_info = _z_source_info_null()},
+                             ._encoding = {.prefix = Z_ENCODING_PREFIX_DEFAULT}},
+    };
+    if (_z_push_header_make(&ret->_put_header, &push) != _Z_RES_OK) {
+        _Z_INFO("Publisher headers could not be pre-encoded, they will be encoded on each put");
+    }
+#if Z_FEATURE_SUBSCRIPTION == 1
+    _ZP_SHARED_SIZE_STORE(ret->_local_subscriptions_state, 0);
+#endif
+#if Z_FEATURE_INTEREST == 1
+    ret->_skip_unmatched = skip_unmatched;
+    _ZP_SHARED_SIZE_STORE(ret->_remote_subscribers_state, 0);
+#else
+    _ZP_UNUSED(skip_unmatched);
+#endif
     ret->_zn = _z_session_rc_clone(zn);
     return ret;
 }
@@ -181,6 +203,48 @@ int8_t _z_write(_z_session_t *zn, const _z_keyexpr_t keyexpr, const uint8_t *pay
 
     return ret;
 }
+
+int8_t _z_publisher_write(_z_publisher_t *pub, const uint8_t *payload, const size_t len, const _z_encoding_t encoding
+#if Z_FEATURE_ATTACHMENT == 1
+                          ,
+                          z_attachment_t attachment
+#endif
+) {
+    _Bool has_header = (pub->_put_header.len > (size_t)0) && (encoding.prefix == Z_ENCODING_PREFIX_DEFAULT) &&
+                       (_z_bytes_is_empty(&encoding.suffix) == true);
+#if Z_FEATURE_ATTACHMENT == 1
+    has_header = has_header && (z_attachment_check(&attachment) == false);
+#endif
+    if (has_header == false) {
+        return _z_write(&pub->_zn.in->val, pub->_key, payload, len, encoding, Z_SAMPLE_KIND_PUT,
+                        pub->_congestion_control, pub->_priority
+#if Z_FEATURE_ATTACHMENT == 1
+                        ,
+                        attachment
+#endif
+        );
+    }
+
+    int8_t ret = _Z_RES_OK;
+    _z_network_message_t msg = {
+        ._tag = _Z_N_PUSH,
+        ._body._push =
+            {
+                // The QoS is already encoded in the header, it is only set for the transport to schedule the message
+                ._qos = _z_n_qos_make(0, pub->_congestion_control == Z_CONGESTION_CONTROL_BLOCK, pub->_priority),
+                ._body = {._is_put = true, ._body._put._payload = _z_bytes_wrap(payload, len)},
+                ._header = pub->_put_header,
+            },
+    };
+
+    if (_z_send_n_msg(&pub->_zn.in->val, &msg, Z_RELIABILITY_RELIABLE, pub->_congestion_control) != _Z_RES_OK) {
+        ret = _Z_ERR_TRANSPORT_TX_FAILED;
+    }
+
+    // Freeing z_msg is unnecessary, as all of its components are aliased
+
+    return ret;
+}
 #endif
 
 #if Z_FEATURE_SUBSCRIPTION == 1
@@ -203,7 +267,7 @@ _z_subscriber_t *_z_declare_subscriber(_z_session_rc_t *zn, _z_keyexpr_t keyexpr
         return NULL;
     }
     // Register subscription, stored at session-level, do not drop it by the end of this function.
-    _z_subscription_rc_t *sp_s = _z_register_subscription(&zn->in->val, _Z_RESOURCE_IS_LOCAL, &s);
+    _z_subscription_rc_t *sp_s = _z_register_subscription(&zn->in->val, &s);
     if (sp_s == NULL) {
         _z_subscriber_free(&ret);
         return NULL;
@@ -213,7 +277,7 @@ _z_subscriber_t *_z_declare_subscriber(_z_session_rc_t *zn, _z_keyexpr_t keyexpr
         &keyexpr, s._id, sub_info.reliability == Z_RELIABILITY_RELIABLE, sub_info.mode == Z_SUBMODE_PULL);
     _z_network_message_t n_msg = _z_n_msg_make_declare(declaration);
     if (_z_send_n_msg(&zn->in->val, &n_msg, Z_RELIABILITY_RELIABLE, Z_CONGESTION_CONTROL_BLOCK) != _Z_RES_OK) {
-        _z_unregister_subscription(&zn->in->val, _Z_RESOURCE_IS_LOCAL, sp_s);
+        _z_unregister_subscription(&zn->in->val, sp_s);
         _z_subscriber_free(&ret);
         return NULL;
     }
@@ -229,7 +293,7 @@ int8_t _z_undeclare_subscriber(_z_subscriber_t *sub) {
         return _Z_ERR_ENTITY_UNKNOWN;
     }
     // Find subscription entry
-    _z_subscription_rc_t *s = _z_get_subscription_by_id(&sub->_zn.in->val, _Z_RESOURCE_IS_LOCAL, sub->_entity_id);
+    _z_subscription_rc_t *s = _z_get_subscription_by_id(&sub->_zn.in->val, sub->_entity_id);
     if (s == NULL) {
         return _Z_ERR_ENTITY_UNKNOWN;
     }
@@ -242,7 +306,7 @@ int8_t _z_undeclare_subscriber(_z_subscriber_t *sub) {
     _z_n_msg_clear(&n_msg);
     // Only if message is successfully send, local subscription state can be removed
     _z_undeclare_resource(&sub->_zn.in->val, s->in->val._key_id);
-    _z_unregister_subscription(&sub->_zn.in->val, _Z_RESOURCE_IS_LOCAL, s);
+    _z_unregister_subscription(&sub->_zn.in->val, s);
     _z_session_rc_drop(&sub->_zn);
     return _Z_RES_OK;
 }
@@ -251,7 +315,7 @@ int8_t _z_undeclare_subscriber(_z_subscriber_t *sub) {
 int8_t _z_subscriber_pull(const _z_subscriber_t *sub) {
     int8_t ret = _Z_RES_OK;
 
-    _z_subscription_rc_t *s = _z_get_subscription_by_id(&sub->_zn.in->val, _Z_RESOURCE_IS_LOCAL, sub->_entity_id);
+    _z_subscription_rc_t *s = _z_get_subscription_by_id(&sub->_zn.in->val, sub->_entity_id);
     if (s != NULL) {
         _z_zint_t pull_id = _z_get_pull_id(&sub->_zn.in->val);
         _z_zenoh_message_t z_msg = _z_msg_make_pull(_z_keyexpr_alias(s->in->val._key), pull_id);
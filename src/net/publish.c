@@ -17,7 +17,10 @@
 #include <stddef.h>
 
 #if Z_FEATURE_PUBLICATION == 1
-void _z_publisher_clear(_z_publisher_t *pub) { _z_keyexpr_clear(&pub->_key); }
+void _z_publisher_clear(_z_publisher_t *pub) {
+    _z_keyexpr_clear(&pub->_key);
+    _z_bytes_clear(&pub->_put_header);
+}
 
 void _z_publisher_free(_z_publisher_t **pub) {
     _z_publisher_t *ptr = *pub;
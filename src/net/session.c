@@ -29,11 +29,13 @@
 #include "zenoh-pico/transport/multicast.h"
 #include "zenoh-pico/transport/multicast/lease.h"
 #include "zenoh-pico/transport/multicast/read.h"
+#include "zenoh-pico/transport/multicast/tx.h"
 #include "zenoh-pico/transport/raweth/read.h"
 #include "zenoh-pico/transport/transport.h"
 #include "zenoh-pico/transport/unicast.h"
 #include "zenoh-pico/transport/unicast/lease.h"
 #include "zenoh-pico/transport/unicast/read.h"
+#include "zenoh-pico/transport/unicast/tx.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/uuid.h"
 
@@ -178,6 +180,50 @@ int8_t _zp_send_keep_alive(_z_session_t *zn) { return _z_send_keep_alive(&zn->_t
 
 int8_t _zp_send_join(_z_session_t *zn) { return _z_send_join(&zn->_tp); }
 
+#if Z_FEATURE_BATCHING == 1
+int8_t _zp_batch_start(_z_session_t *zn, uint32_t linger_ms) {
+    int8_t ret = _Z_RES_OK;
+    // Batching only applies to unicast transports
+    switch (zn->_tp._type) {
+        case _Z_TRANSPORT_UNICAST_TYPE:
+            ret = _z_unicast_batch_start(&zn->_tp._transport._unicast, linger_ms);
+            break;
+        default:
+            _ZP_UNUSED(linger_ms);
+            ret = _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+            break;
+    }
+    return ret;
+}
+
+int8_t _zp_batch_stop(_z_session_t *zn) {
+    int8_t ret = _Z_RES_OK;
+    // Batching only applies to unicast transports
+    switch (zn->_tp._type) {
+        case _Z_TRANSPORT_UNICAST_TYPE:
+            ret = _z_unicast_batch_stop(&zn->_tp._transport._unicast);
+            break;
+        default:
+            ret = _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+            break;
+    }
+    return ret;
+}
+
+int8_t _zp_flush(_z_session_t *zn) {
+    int8_t ret = _Z_RES_OK;
+    switch (zn->_tp._type) {
+        case _Z_TRANSPORT_UNICAST_TYPE:
+            ret = _z_unicast_flush(&zn->_tp._transport._unicast);
+            break;
+        default:
+            // Other transports send their messages right away, there is nothing to flush
+            break;
+    }
+    return ret;
+}
+#endif  // Z_FEATURE_BATCHING == 1
+
 #if Z_FEATURE_MULTI_THREAD == 1
 int8_t _zp_start_read_task(_z_session_t *zn, z_task_attr_t *attr) {
     int8_t ret = _Z_RES_OK;
@@ -237,6 +283,33 @@ int8_t _zp_start_lease_task(_z_session_t *zn, z_task_attr_t *attr) {
     return ret;
 }
 
+int8_t _zp_start_tx_task(_z_session_t *zn, z_task_attr_t *attr, size_t queue_size) {
+    int8_t ret = _Z_RES_OK;
+    // Allocate task
+    z_task_t *task = (z_task_t *)z_malloc(sizeof(z_task_t));
+    if (task == NULL) {
+        return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    }
+    // Call transport function
+    switch (zn->_tp._type) {
+        case _Z_TRANSPORT_UNICAST_TYPE:
+            ret = _zp_unicast_start_tx_task(&zn->_tp, attr, task, queue_size);
+            break;
+        case _Z_TRANSPORT_MULTICAST_TYPE:
+            ret = _zp_multicast_start_tx_task(&zn->_tp._transport._multicast, attr, task, queue_size);
+            break;
+        default:
+            // The raw ethernet transport sends its messages directly
+            ret = _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+            break;
+    }
+    // Free task if operation failed
+    if (ret != _Z_RES_OK) {
+        z_free(task);
+    }
+    return ret;
+}
+
 int8_t _zp_stop_read_task(_z_session_t *zn) {
     int8_t ret = _Z_RES_OK;
     // Call transport function
@@ -276,4 +349,21 @@ int8_t _zp_stop_lease_task(_z_session_t *zn) {
     }
     return ret;
 }
+
+int8_t _zp_stop_tx_task(_z_session_t *zn) {
+    int8_t ret = _Z_RES_OK;
+    // Call transport function
+    switch (zn->_tp._type) {
+        case _Z_TRANSPORT_UNICAST_TYPE:
+            ret = _zp_unicast_stop_tx_task(&zn->_tp);
+            break;
+        case _Z_TRANSPORT_MULTICAST_TYPE:
+            ret = _zp_multicast_stop_tx_task(&zn->_tp._transport._multicast);
+            break;
+        default:
+            ret = _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+            break;
+    }
+    return ret;
+}
 #endif  // Z_FEATURE_MULTI_THREAD == 1
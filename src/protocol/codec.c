@@ -15,6 +15,7 @@
 #include "zenoh-pico/protocol/codec.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/utils/logging.h"
@@ -101,34 +102,69 @@ int8_t _z_whatami_decode(z_whatami_t *en, _z_zbuf_t *zbf) {
     return ret;
 }
 
-int8_t _z_uint_encode(_z_wbuf_t *wbf, unsigned int uint) {
-    unsigned int lv = uint;
+/*------------------ varint ------------------*/
+#define _Z_VARINT_MAX_LEN 10  // Length of the longest encoded 64 bits integer
 
-    while (lv > (unsigned int)0x7f) {
-        uint8_t c = (uint8_t)(lv & (unsigned int)0x7f) | (uint8_t)0x80;
-        _Z_RETURN_IF_ERR(_z_wbuf_write(wbf, c))
-        lv = lv >> (unsigned int)7;
+/**
+ * Write a varint on ``dst``, which must have room for ``_Z_VARINT_MAX_LEN`` bytes. Returns the number of bytes written.
+ */
+static inline uint8_t __z_varint_write(uint8_t *dst, uint64_t v) {
+    uint8_t len = 0;
+    while (v > (uint64_t)0x7f) {
+        dst[len] = (uint8_t)((uint8_t)(v & (uint64_t)0x7f) | (uint8_t)0x80);
+        len++;
+        v = v >> (uint64_t)7;
     }
+    dst[len] = (uint8_t)v;
+    return len + (uint8_t)1;
+}
 
-    uint8_t c = (uint8_t)(lv & (unsigned int)0xff);
-    return _z_wbuf_write(wbf, c);
+static int8_t __z_varint_encode(_z_wbuf_t *wbf, uint64_t v) {
+    _z_iosli_t *ios = _z_wbuf_get_iosli(wbf, wbf->_w_idx);
+    if ((ios->_capacity - ios->_w_pos) >= (size_t)_Z_VARINT_MAX_LEN) {
+        // Fast path: any varint fits in the current slice, write it in place
+        ios->_w_pos += __z_varint_write(&ios->_buf[ios->_w_pos], v);
+        return _Z_RES_OK;
+    }
+
+    // Slow path: the varint may span several slices or not fit at all
+    uint8_t buf[_Z_VARINT_MAX_LEN];
+    uint8_t len = __z_varint_write(buf, v);
+    for (uint8_t i = 0; i < len; i++) {
+        _Z_RETURN_IF_ERR(_z_wbuf_write(wbf, buf[i]))
+    }
+    return _Z_RES_OK;
 }
 
-int8_t _z_uint_decode(unsigned int *uint, _z_zbuf_t *zbf) {
-    int8_t ret = _Z_RES_OK;
-    *uint = 0;
-
-    uint8_t i = 0;
-    uint8_t u8 = 0;
-    do {
-        if (_z_uint8_decode(&u8, zbf) == _Z_RES_OK) {
-            *uint = *uint | (((unsigned int)u8 & (unsigned int)0x7f) << (unsigned int)i);
-            i = i + (uint8_t)7;
-        } else {
-            ret |= _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
+static int8_t __z_varint_decode(uint64_t *v, _z_zbuf_t *zbf) {
+    // A zbuf is always contiguous, decode straight from its read pointer
+    const uint8_t *src = &zbf->_ios._buf[zbf->_ios._r_pos];
+    size_t len = zbf->_ios._w_pos - zbf->_ios._r_pos;
+    if (len > (size_t)_Z_VARINT_MAX_LEN) {
+        len = _Z_VARINT_MAX_LEN;
+    }
+
+    uint64_t val = 0;
+    for (size_t i = 0; i < len; i++) {
+        val |= (uint64_t)(src[i] & (uint8_t)0x7f) << (7 * i);
+        if (src[i] < (uint8_t)0x80) {
+            zbf->_ios._r_pos += i + (size_t)1;
+            *v = val;
+            return _Z_RES_OK;
         }
-    } while (u8 > (uint8_t)0x7f);
+    }
+
+    _Z_DEBUG("WARNING: Not enough bytes to read or malformed varint");
+    *v = 0;
+    return _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
+}
+
+int8_t _z_uint_encode(_z_wbuf_t *wbf, unsigned int uint) { return __z_varint_encode(wbf, uint); }
 
+int8_t _z_uint_decode(unsigned int *uint, _z_zbuf_t *zbf) {
+    uint64_t v;
+    int8_t ret = __z_varint_decode(&v, zbf);
+    *uint = (unsigned int)v;
     return ret;
 }
 
@@ -170,36 +206,9 @@ int8_t _z_uint16_decode(uint16_t *u16, _z_zbuf_t *zbf) {
     return ret;
 }
 
-int8_t _z_uint64_encode(_z_wbuf_t *wbf, uint64_t u64) {
-    uint64_t lv = u64;
+int8_t _z_uint64_encode(_z_wbuf_t *wbf, uint64_t u64) { return __z_varint_encode(wbf, u64); }
 
-    while (lv > (uint64_t)0x7f) {
-        uint8_t c = (uint8_t)(lv & (uint64_t)0x7f) | (uint8_t)0x80;
-        _Z_RETURN_IF_ERR(_z_wbuf_write(wbf, c))
-        lv = lv >> (_z_zint_t)7;
-    }
-
-    uint8_t c = lv & (uint64_t)0xff;
-    return _z_wbuf_write(wbf, c);
-}
-
-int8_t _z_uint64_decode(uint64_t *u64, _z_zbuf_t *zbf) {
-    int8_t ret = _Z_RES_OK;
-    *u64 = 0;
-
-    uint8_t i = 0;
-    uint8_t u8 = 0;
-    do {
-        if (_z_uint8_decode(&u8, zbf) == _Z_RES_OK) {
-            *u64 = *u64 | (((_z_zint_t)u8 & 0x7f) << i);
-            i = i + (uint8_t)7;
-        } else {
-            ret |= _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
-        }
-    } while (u8 > (uint8_t)0x7f);
-
-    return ret;
-}
+int8_t _z_uint64_decode(uint64_t *u64, _z_zbuf_t *zbf) { return __z_varint_decode(u64, zbf); }
 
 /*------------------ z_zint ------------------*/
 uint8_t _z_zint_len(_z_zint_t v) {
@@ -210,30 +219,9 @@ uint8_t _z_zint_len(_z_zint_t v) {
     }
     return len;
 }
-int8_t _z_zint_encode(_z_wbuf_t *wbf, _z_zint_t v) {
-    _z_zint_t lv = v;
-
-    while (lv > 0x7f) {
-        uint8_t c = (lv & 0x7f) | 0x80;
-        _Z_RETURN_IF_ERR(_z_wbuf_write(wbf, c))
-        lv = lv >> (_z_zint_t)7;
-    }
-
-    uint8_t c = lv & 0xff;
-    return _z_wbuf_write(wbf, c);
-}
-int8_t _z_zint64_encode(_z_wbuf_t *wbf, uint64_t v) {
-    uint64_t lv = v;
-
-    while (lv > 0x7f) {
-        uint8_t c = (lv & 0x7f) | 0x80;
-        _Z_RETURN_IF_ERR(_z_wbuf_write(wbf, c))
-        lv = lv >> (uint64_t)7;
-    }
-
-    uint8_t c = lv & 0xff;
-    return _z_wbuf_write(wbf, c);
-}
+uint8_t _z_zint_write(uint8_t *dst, _z_zint_t v) { return __z_varint_write(dst, (uint64_t)v); }
+int8_t _z_zint_encode(_z_wbuf_t *wbf, _z_zint_t v) { return __z_varint_encode(wbf, (uint64_t)v); }
+int8_t _z_zint64_encode(_z_wbuf_t *wbf, uint64_t v) { return __z_varint_encode(wbf, v); }
 int8_t _z_zint16_decode(uint16_t *zint, _z_zbuf_t *zbf) {
     int8_t ret = _Z_RES_OK;
     _z_zint_t buf;
@@ -257,39 +245,12 @@ int8_t _z_zint32_decode(uint32_t *zint, _z_zbuf_t *zbf) {
     return ret;
 }
 int8_t _z_zint_decode(_z_zint_t *zint, _z_zbuf_t *zbf) {
-    int8_t ret = _Z_RES_OK;
-    *zint = 0;
-
-    uint8_t i = 0;
-    uint8_t u8 = 0;
-    do {
-        if (_z_uint8_decode(&u8, zbf) == _Z_RES_OK) {
-            *zint = *zint | (((_z_zint_t)u8 & 0x7f) << i);
-            i = i + (uint8_t)7;
-        } else {
-            ret |= _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
-        }
-    } while (u8 > (uint8_t)0x7f);
-
-    return ret;
-}
-int8_t _z_zint64_decode(uint64_t *zint, _z_zbuf_t *zbf) {
-    int8_t ret = _Z_RES_OK;
-    *zint = 0;
-
-    uint8_t i = 0;
-    uint8_t u8 = 0;
-    do {
-        if (_z_uint8_decode(&u8, zbf) == _Z_RES_OK) {
-            *zint = *zint | (((uint64_t)u8 & 0x7f) << i);
-            i = i + (uint8_t)7;
-        } else {
-            ret |= _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
-        }
-    } while (u8 > (uint8_t)0x7f);
-
+    uint64_t v;
+    int8_t ret = __z_varint_decode(&v, zbf);
+    *zint = (_z_zint_t)v;
     return ret;
 }
+int8_t _z_zint64_decode(uint64_t *zint, _z_zbuf_t *zbf) { return __z_varint_decode(zint, zbf); }
 
 /*------------------ uint8_array ------------------*/
 int8_t _z_bytes_val_encode(_z_wbuf_t *wbf, const _z_bytes_t *bs) {
@@ -297,6 +258,9 @@ int8_t _z_bytes_val_encode(_z_wbuf_t *wbf, const _z_bytes_t *bs) {
 
     if ((wbf->_expansion_step != 0) && (bs->len > Z_TSID_LENGTH)) {
         ret |= _z_wbuf_wrap_bytes(wbf, bs->start, 0, bs->len);
+    } else if ((wbf->_alias_bytes == true) && (bs->len >= _Z_WBUF_ALIAS_MIN_SIZE) &&
+               (bs->len <= _z_wbuf_space_left(wbf))) {
+        ret |= _z_wbuf_wrap_bytes(wbf, bs->start, 0, bs->len);
     } else {
         ret |= _z_wbuf_write_bytes(wbf, bs->start, 0, bs->len);
     }
@@ -383,3 +347,28 @@ int8_t _z_str_decode(char **str, _z_zbuf_t *zbf) {
 
     return ret;
 }
+
+int8_t _z_str_decode_na(char **str, _z_zbuf_t *zbf) {
+    int8_t ret = _Z_RES_OK;
+    *str = NULL;
+
+    _z_zint_t len = 0;
+    ret |= _z_zint_decode(&len, zbf);
+    if (ret == _Z_RES_OK) {
+        if (_z_zbuf_len(zbf) >= len) {  // Check if we have enough bytes to read
+            // The length takes at least one byte: slide the string over it to make room for the terminator
+            char *tmp = (char *)_z_zbuf_get_rptr(zbf) - 1;
+            (void)memmove(tmp, &tmp[1], len);
+            tmp[len] = '\0';
+            _z_zbuf_set_rpos(zbf, _z_zbuf_get_rpos(zbf) + len);  // Move the read position
+            *str = tmp;
+        } else {
+            _Z_DEBUG("WARNING: Not enough bytes to read");
+            ret |= _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
+        }
+    } else {
+        ret |= _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
+    }
+
+    return ret;
+}
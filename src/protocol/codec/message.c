@@ -126,11 +126,12 @@ int8_t _z_keyexpr_decode(_z_keyexpr_t *ke, _z_zbuf_t *zbf, _Bool has_suffix) {
 
     ret |= _z_zint16_decode(&ke->_id, zbf);
     if (has_suffix == true) {
+        // The suffix is borrowed from the buffer, the owners of a declaration take a copy of it
         char *str = NULL;
-        ret |= _z_str_decode(&str, zbf);
+        ret |= _z_str_decode_na(&str, zbf);
         if (ret == _Z_RES_OK) {
             ke->_suffix = str;
-            ke->_mapping = _z_keyexpr_mapping(0, true);
+            ke->_mapping = _z_keyexpr_mapping(0, false);
         } else {
             ke->_suffix = NULL;
             ke->_mapping = _z_keyexpr_mapping(0, false);
@@ -250,6 +251,11 @@ int8_t _z_attachment_encode_ext_kv(_z_bytes_t key, _z_bytes_t value, void *ctx)
     return 0;
 }
 int8_t _z_attachment_encode_ext(_z_wbuf_t *wbf, z_attachment_t att) {
+    const _z_bytes_t *encoded = _z_attachment_as_encoded(att);
+    if (encoded != NULL) {
+        // Already laid out in its wire format
+        return _z_bytes_encode(wbf, encoded);
+    }
     size_t len = _z_attachment_estimate_length(att);
     _Z_RETURN_IF_ERR(_z_zint_encode(wbf, len));
     _Z_RETURN_IF_ERR(z_attachment_iterate(att, _z_attachment_encode_ext_kv, wbf));
@@ -327,9 +333,8 @@ int8_t _z_push_body_decode_extensions(_z_msg_ext_t *extension, void *ctx) {
 #if Z_FEATURE_ATTACHMENT == 1
         case _Z_MSG_EXT_ENC_ZBUF | 0x03: {
             pshb->_body._put._attachment.is_encoded = true;
-            pshb->_body._put._attachment.body.encoded = extension->_body._zbuf._val._is_alloc
-                                                            ? _z_bytes_steal(&extension->_body._zbuf._val)
-                                                            : _z_bytes_duplicate(&extension->_body._zbuf._val);
+            // Owned if the extension owns it, otherwise aliasing the received buffer like the payload
+            pshb->_body._put._attachment.body.encoded = _z_bytes_steal(&extension->_body._zbuf._val);
             break;
         }
 #endif
@@ -490,9 +495,8 @@ int8_t _z_query_decode_extensions(_z_msg_ext_t *extension, void *ctx) {
 #if Z_FEATURE_ATTACHMENT == 1
         case _Z_MSG_EXT_ENC_ZBUF | 0x05: {
             msg->_ext_attachment.is_encoded = true;
-            msg->_ext_attachment.body.encoded = extension->_body._zbuf._val._is_alloc
-                                                    ? _z_bytes_steal(&extension->_body._zbuf._val)
-                                                    : _z_bytes_duplicate(&extension->_body._zbuf._val);
+            // Owned if the extension owns it, otherwise aliasing the received buffer like the payload
+            msg->_ext_attachment.body.encoded = _z_bytes_steal(&extension->_body._zbuf._val);
             break;
         }
 #endif
@@ -595,9 +599,8 @@ int8_t _z_reply_decode_extension(_z_msg_ext_t *extension, void *ctx) {
 #if Z_FEATURE_ATTACHMENT == 1
         case _Z_MSG_EXT_ENC_ZBUF | 0x04: {
             reply->_ext_attachment.is_encoded = true;
-            reply->_ext_attachment.body.encoded = extension->_body._zbuf._val._is_alloc
-                                                      ? _z_bytes_steal(&extension->_body._zbuf._val)
-                                                      : _z_bytes_duplicate(&extension->_body._zbuf._val);
+            // Owned if the extension owns it, otherwise aliasing the received buffer like the payload
+            reply->_ext_attachment.body.encoded = _z_bytes_steal(&extension->_body._zbuf._val);
             break;
         }
 #endif
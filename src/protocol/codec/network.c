@@ -17,6 +17,7 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "zenoh-pico/api/constants.h"
 #include "zenoh-pico/api/types.h"
@@ -37,6 +38,11 @@
 /*------------------ Push Message ------------------*/
 
 int8_t _z_push_encode(_z_wbuf_t *wbf, const _z_n_msg_push_t *msg) {
+    if ((msg->_header.len > (size_t)0) && (msg->_body._is_put == true)) {
+        _Z_RETURN_IF_ERR(_z_wbuf_write_bytes(wbf, msg->_header.start, 0, msg->_header.len));
+        return _z_bytes_encode(wbf, &msg->_body._body._put._payload);
+    }
+
     uint8_t header = _Z_MID_N_PUSH | (_z_keyexpr_is_local(&msg->_key) ? _Z_FLAG_N_REQUEST_M : 0);
     _Bool has_suffix = _z_keyexpr_has_suffix(msg->_key);
     _Bool has_qos_ext = msg->_qos._val != _Z_N_QOS_DEFAULT._val;
@@ -65,6 +71,31 @@ int8_t _z_push_encode(_z_wbuf_t *wbf, const _z_n_msg_push_t *msg) {
     return _Z_RES_OK;
 }
 
+int8_t _z_push_header_make(_z_bytes_t *header, const _z_n_msg_push_t *msg) {
+    *header = _z_bytes_empty();
+    if (msg->_body._is_put == false) {
+        return _Z_ERR_GENERIC;
+    }
+    _z_n_msg_push_t push = *msg;
+    push._header = _z_bytes_empty();
+    push._body._body._put._payload = _z_bytes_empty();
+
+    _z_wbuf_t wbf = _z_wbuf_make(Z_IOSLICE_SIZE, true);
+    int8_t ret = _z_push_encode(&wbf, &push);
+    if (ret == _Z_RES_OK) {
+        // Drop the empty payload length, a single byte
+        _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+        size_t len = _z_zbuf_len(&zbf) - (size_t)1;
+        ret = _z_bytes_init(header, len);
+        if (ret == _Z_RES_OK) {
+            (void)memcpy((uint8_t *)header->start, _z_zbuf_get_rptr(&zbf), len);
+        }
+        _z_zbuf_clear(&zbf);
+    }
+    _z_wbuf_clear(&wbf);
+    return ret;
+}
+
 int8_t _z_push_decode_ext_cb(_z_msg_ext_t *extension, void *ctx) {
     int8_t ret = _Z_RES_OK;
     _z_n_msg_push_t *msg = (_z_n_msg_push_t *)ctx;
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/protocol/codec/serial.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "zenoh-pico/utils/checksum.h"
+
+#define _Z_SERIAL_LEN_SIZE 2
+#define _Z_SERIAL_CRC_SIZE 4
+
+/*------------------ Encoding ------------------*/
+typedef struct {
+    uint8_t *_out;
+    size_t _pos;
+    size_t _code_pos;
+    uint8_t _code;
+} _z_serial_cobs_encoder_t;
+
+static void _z_serial_cobs_close_block(_z_serial_cobs_encoder_t *enc) {
+    enc->_out[enc->_code_pos] = enc->_code;
+    enc->_code_pos = enc->_pos;
+    enc->_pos = enc->_pos + (size_t)1;
+    enc->_code = 1;
+}
+
+static void _z_serial_cobs_write(_z_serial_cobs_encoder_t *enc, const uint8_t *bytes, size_t len) {
+    while (len > (size_t)0) {
+        // Copy the run of non-zero bytes the current block can still hold at once
+        size_t run = (size_t)(0xFF - enc->_code);
+        if (run > len) {
+            run = len;
+        }
+        const uint8_t *zero = (const uint8_t *)memchr(bytes, 0x00, run);
+        if (zero != NULL) {
+            run = (size_t)(zero - bytes);
+        }
+        (void)memcpy(&enc->_out[enc->_pos], bytes, run);
+        enc->_pos = enc->_pos + run;
+        enc->_code = (uint8_t)(enc->_code + run);
+        bytes = &bytes[run];
+        len = len - run;
+
+        if (zero != NULL) {
+            // The zero byte is encoded by the code closing the block
+            _z_serial_cobs_close_block(enc);
+            bytes = &bytes[1];
+            len = len - (size_t)1;
+        } else if (enc->_code == (uint8_t)0xFF) {
+            _z_serial_cobs_close_block(enc);
+        }
+    }
+}
+
+size_t _z_serial_frame_encode(uint8_t *out, const uint8_t *ptr, size_t len) {
+    if (len > (size_t)_Z_SERIAL_MTU_SIZE) {
+        return SIZE_MAX;
+    }
+
+    uint8_t header[_Z_SERIAL_LEN_SIZE];
+    for (size_t i = 0; i < sizeof(header); i++) {
+        header[i] = (uint8_t)((len >> (i * (size_t)8)) & (size_t)0xFF);
+    }
+    uint8_t trailer[_Z_SERIAL_CRC_SIZE];
+    uint32_t crc = _z_crc32(ptr, len);
+    for (size_t i = 0; i < sizeof(trailer); i++) {
+        trailer[i] = (uint8_t)((crc >> (i * (size_t)8)) & (uint32_t)0xFF);
+    }
+
+    _z_serial_cobs_encoder_t enc = {._out = out, ._pos = 1, ._code_pos = 0, ._code = 1};
+    _z_serial_cobs_write(&enc, header, sizeof(header));
+    _z_serial_cobs_write(&enc, ptr, len);
+    _z_serial_cobs_write(&enc, trailer, sizeof(trailer));
+    out[enc._code_pos] = enc._code;
+    out[enc._pos] = 0x00;  // COBS delimiter
+    return enc._pos + (size_t)1;
+}
+
+/*------------------ Decoding ------------------*/
+void _z_serial_decoder_reset(_z_serial_decoder_t *dec) {
+    dec->_len = 0;
+    dec->_code = 0xFF;
+    dec->_block = 0;
+    dec->_invalid = false;
+}
+
+static void _z_serial_decoder_append(_z_serial_decoder_t *dec, const uint8_t *bytes, size_t len) {
+    if ((dec->_invalid == false) && (len <= (sizeof(dec->_frame) - dec->_len))) {
+        (void)memcpy(&dec->_frame[dec->_len], bytes, len);
+        dec->_len = dec->_len + len;
+    } else {
+        dec->_invalid = true;
+    }
+}
+
+size_t _z_serial_decoder_feed(_z_serial_decoder_t *dec, const uint8_t *raw, size_t len, _Bool *complete) {
+    *complete = false;
+    size_t i = 0;
+    while (i < len) {
+        if (raw[i] == (uint8_t)0x00) {
+            i = i + (size_t)1;
+            if ((dec->_len == (size_t)0) && (dec->_code == (uint8_t)0xFF) && (dec->_invalid == false)) {
+                continue;  // Nothing since the last delimiter
+            }
+            if (dec->_block != (uint8_t)0) {
+                dec->_invalid = true;  // The frame has been cut in the middle of a block
+            }
+            *complete = true;
+            break;
+        } else if (dec->_block == (uint8_t)0) {
+            if (dec->_code != (uint8_t)0xFF) {
+                const uint8_t zero = 0x00;
+                _z_serial_decoder_append(dec, &zero, 1);
+            }
+            dec->_code = raw[i];
+            dec->_block = (uint8_t)(raw[i] - (uint8_t)1);
+            i = i + (size_t)1;
+        } else {
+            // Copy the data bytes of the current block at once, up to a delimiter if the frame has been cut
+            size_t run = len - i;
+            if (run > (size_t)dec->_block) {
+                run = dec->_block;
+            }
+            const uint8_t *zero = (const uint8_t *)memchr(&raw[i], 0x00, run);
+            if (zero != NULL) {
+                run = (size_t)(zero - &raw[i]);
+            }
+            _z_serial_decoder_append(dec, &raw[i], run);
+            dec->_block = (uint8_t)(dec->_block - run);
+            i = i + run;
+        }
+    }
+    return i;
+}
+
+size_t _z_serial_decoder_take(_z_serial_decoder_t *dec, uint8_t *ptr, size_t len) {
+    size_t ret = SIZE_MAX;
+    if ((dec->_invalid == false) && (dec->_len >= (size_t)(_Z_SERIAL_LEN_SIZE + _Z_SERIAL_CRC_SIZE))) {
+        size_t payload_len = (size_t)dec->_frame[0] | ((size_t)dec->_frame[1] << 8);
+        if ((dec->_len == (payload_len + (size_t)(_Z_SERIAL_LEN_SIZE + _Z_SERIAL_CRC_SIZE))) && (payload_len <= len)) {
+            const uint8_t *payload = &dec->_frame[_Z_SERIAL_LEN_SIZE];
+            uint32_t crc = 0;
+            for (size_t i = 0; i < (size_t)_Z_SERIAL_CRC_SIZE; i++) {
+                crc |= (uint32_t)payload[payload_len + i] << (i * (size_t)8);
+            }
+            if (_z_crc32(payload, payload_len) == crc) {
+                (void)memcpy(ptr, payload, payload_len);
+                ret = payload_len;
+            }
+        }
+    }
+    _z_serial_decoder_reset(dec);
+    return ret;
+}
@@ -327,11 +327,9 @@ int8_t _z_frame_encode(_z_wbuf_t *wbf, uint8_t header, const _z_t_msg_frame_t *m
     if (_Z_HAS_FLAG(header, _Z_FLAG_T_Z)) {
         ret = _Z_ERR_MESSAGE_SERIALIZATION_FAILED;
     }
-    if (ret == _Z_RES_OK) {
-        size_t len = _z_network_message_vec_len(&msg->_messages);
-        for (size_t i = 0; i < len; i++) {
-            _Z_RETURN_IF_ERR(_z_network_message_encode(wbf, _z_network_message_vec_get(&msg->_messages, i)))
-        }
+    if ((ret == _Z_RES_OK) && (_z_zbuf_len(&msg->_payload) > (size_t)0)) {
+        _Z_RETURN_IF_ERR(
+            _z_wbuf_write_bytes(wbf, _z_zbuf_get_rptr(&msg->_payload), 0, _z_zbuf_len(&msg->_payload)))
     }
 
     return ret;
@@ -346,29 +344,30 @@ int8_t _z_frame_decode(_z_t_msg_frame_t *msg, _z_zbuf_t *zbf, uint8_t header) {
         ret |= _z_msg_ext_skip_non_mandatories(zbf, 0x04);
     }
     if (ret == _Z_RES_OK) {
-        msg->_messages = _z_network_message_vec_make(_ZENOH_PICO_FRAME_MESSAGES_VEC_SIZE);
-        while (_z_zbuf_len(zbf) > 0) {
-            // Mark the reading position of the iobfer
-            size_t r_pos = _z_zbuf_get_rpos(zbf);
-            _z_network_message_t *nm = (_z_network_message_t *)z_malloc(sizeof(_z_network_message_t));
-            memset(nm, 0, sizeof(_z_network_message_t));
-            ret |= _z_network_message_decode(nm, zbf);
-            if (ret == _Z_RES_OK) {
-                _z_network_message_vec_append(&msg->_messages, nm);
-            } else {
-                _z_n_msg_free(&nm);
-
-                _z_zbuf_set_rpos(zbf, r_pos);  // Restore the reading position of the iobfer
-
-                // FIXME: Check for the return error, since not all of them means a decoding error
-                //        in this particular case. As of now, we roll-back the reading position
-                //        and return to the Zenoh transport-level decoder.
-                //        https://github.com/eclipse-zenoh/zenoh-pico/pull/132#discussion_r1045593602
-                if ((ret & _Z_ERR_MESSAGE_ZENOH_UNKNOWN) == _Z_ERR_MESSAGE_ZENOH_UNKNOWN) {
-                    ret = _Z_RES_OK;
-                }
-                break;
-            }
+        // The network messages span until the end of the batch, they are left to be decoded one by one
+        size_t len = _z_zbuf_len(zbf);
+        msg->_payload = _z_zbuf_view(zbf, len);
+        _z_zbuf_set_rpos(zbf, _z_zbuf_get_rpos(zbf) + len);
+    }
+    return ret;
+}
+
+/**
+ * Decode the next network message of a frame payload, to be cleared by the caller with :c:func:`_z_msg_clear`.
+ * The messages that cannot be decoded are dropped along with the rest of the payload, and
+ * ``_Z_ERR_MESSAGE_ZENOH_UNKNOWN`` is returned if they are not known to this implementation.
+ */
+int8_t _z_frame_decode_message(_z_t_msg_frame_t *msg, _z_network_message_t *nm) {
+    (void)memset(nm, 0, sizeof(_z_network_message_t));
+    int8_t ret = _z_network_message_decode(nm, &msg->_payload);
+    if (ret != _Z_RES_OK) {
+        _z_msg_clear(nm);
+        _z_zbuf_set_rpos(&msg->_payload, _z_zbuf_get_wpos(&msg->_payload));
+        // FIXME: Check for the return error, since not all of them means a decoding error
+        //        in this particular case.
+        //        https://github.com/eclipse-zenoh/zenoh-pico/pull/132#discussion_r1045593602
+        if ((ret & _Z_ERR_MESSAGE_ZENOH_UNKNOWN) == _Z_ERR_MESSAGE_ZENOH_UNKNOWN) {
+            ret = _Z_ERR_MESSAGE_ZENOH_UNKNOWN;
         }
     }
     return ret;
@@ -400,8 +399,8 @@ int8_t _z_fragment_decode(_z_t_msg_fragment_t *msg, _z_zbuf_t *zbf, uint8_t head
         ret |= _z_msg_ext_skip_non_mandatories(zbf, 0x05);
     }
 
-    _z_bytes_t bytes = _z_bytes_wrap((uint8_t *)_z_zbuf_start(zbf), _z_zbuf_len(zbf));
-    _z_bytes_copy(&msg->_payload, &bytes);
+    // The payload borrows the decoding buffer, it is only copied once into the defragmentation buffer
+    msg->_payload = _z_bytes_wrap(_z_zbuf_start(zbf), _z_zbuf_len(zbf));
     zbf->_ios._r_pos = zbf->_ios._w_pos;
 
     return ret;
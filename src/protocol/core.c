@@ -85,8 +85,7 @@ struct _z_seeker_t {
 };
 int8_t _z_attachment_get_seeker(_z_bytes_t key, _z_bytes_t value, void *ctx) {
     struct _z_seeker_t *seeker = (struct _z_seeker_t *)ctx;
-    _z_bytes_t seeked = seeker->key;
-    if (key.len == seeked.len && memcmp(key.start, seeked.start, seeked.len)) {
+    if (_z_bytes_eq(&key, &seeker->key)) {
         seeker->value = (_z_bytes_t){.start = value.start, .len = value.len, ._is_alloc = false};
         return 1;
     }
@@ -103,18 +102,23 @@ int8_t _z_attachment_estimate_length_body(_z_bytes_t key, _z_bytes_t value, void
     return 0;
 }
 size_t _z_attachment_estimate_length(z_attachment_t att) {
+    const _z_bytes_t *encoded = _z_attachment_as_encoded(att);
+    if (encoded != NULL) {
+        return encoded->len;
+    }
     size_t len = 0;
     z_attachment_iterate(att, _z_attachment_estimate_length_body, &len);
     return len;
 }
 
-int8_t _z_encoded_attachment_iteration_driver(const void *this_, z_attachment_iter_body_t body, void *ctx) {
+// Walks the pairs in place: the keys and values given to the body alias the encoded attachment
+static int8_t _z_encoded_attachment_iteration_driver(const void *this_, z_attachment_iter_body_t body, void *ctx) {
     _z_zbuf_t data = _z_zbytes_as_zbuf(*(_z_bytes_t *)this_);
     while (_z_zbuf_can_read(&data)) {
         _z_bytes_t key = _z_bytes_empty();
         _z_bytes_t value = _z_bytes_empty();
-        _z_bytes_decode(&key, &data);
-        _z_bytes_decode(&value, &data);
+        _Z_RETURN_IF_ERR(_z_bytes_decode(&key, &data));
+        _Z_RETURN_IF_ERR(_z_bytes_decode(&value, &data));
         int8_t ret = body(key, value, ctx);
         if (ret != 0) {
             return ret;
@@ -123,9 +127,18 @@ int8_t _z_encoded_attachment_iteration_driver(const void *this_, z_attachment_it
     return 0;
 }
 
+z_attachment_t _z_encoded_attachment_wrap(const _z_bytes_t *encoded) {
+    return (z_attachment_t){.data = encoded, .iteration_driver = _z_encoded_attachment_iteration_driver};
+}
+const _z_bytes_t *_z_attachment_as_encoded(z_attachment_t att) {
+    if (att.iteration_driver == _z_encoded_attachment_iteration_driver) {
+        return (const _z_bytes_t *)att.data;
+    }
+    return NULL;
+}
 z_attachment_t _z_encoded_as_attachment(const _z_owned_encoded_attachment_t *att) {
     if (att->is_encoded) {
-        return (z_attachment_t){.data = &att->body.encoded, .iteration_driver = _z_encoded_attachment_iteration_driver};
+        return _z_encoded_attachment_wrap(&att->body.encoded);
     } else {
         return att->body.decoded;
     }
@@ -133,6 +133,28 @@ void _z_n_msg_clear(_z_network_message_t *msg) {
     }
 }
 
+z_priority_t _z_n_msg_get_priority(const _z_network_message_t *msg) {
+    _z_n_qos_t qos = _Z_N_QOS_DEFAULT;
+    switch (msg->_tag) {
+        case _Z_N_PUSH:
+            qos = msg->_body._push._qos;
+            break;
+        case _Z_N_REQUEST:
+            qos = msg->_body._request._ext_qos;
+            break;
+        case _Z_N_RESPONSE:
+            qos = msg->_body._response._ext_qos;
+            break;
+        case _Z_N_DECLARE:
+            qos = msg->_body._declare._ext_qos;
+            break;
+        case _Z_N_RESPONSE_FINAL:
+        default:
+            break;
+    }
+    return _z_n_qos_get_priority(qos);
+}
+
 void _z_n_msg_free(_z_network_message_t **msg) {
     _z_network_message_t *ptr = *msg;
 
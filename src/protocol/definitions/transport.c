@@ -34,7 +34,7 @@ void _z_t_msg_close_clear(_z_t_msg_close_t *msg) { (void)(msg); }
 
 void _z_t_msg_keep_alive_clear(_z_t_msg_keep_alive_t *msg) { (void)(msg); }
 
-void _z_t_msg_frame_clear(_z_t_msg_frame_t *msg) { _z_network_message_vec_clear(&msg->_messages); }
+void _z_t_msg_frame_clear(_z_t_msg_frame_t *msg) { msg->_payload = (_z_zbuf_t){0}; }
 
 void _z_t_msg_fragment_clear(_z_t_msg_fragment_t *msg) { _z_bytes_clear(&msg->_payload); }
 
@@ -203,7 +203,7 @@ _z_transport_message_t _z_t_msg_make_keep_alive(void) {
     return msg;
 }
 
-_z_transport_message_t _z_t_msg_make_frame(_z_zint_t sn, _z_network_message_vec_t messages, _Bool is_reliable) {
+_z_transport_message_t _z_t_msg_make_frame(_z_zint_t sn, _z_zbuf_t payload, _Bool is_reliable) {
     _z_transport_message_t msg;
     msg._header = _Z_MID_T_FRAME;
 
@@ -212,7 +212,7 @@ _z_transport_message_t _z_t_msg_make_frame(_z_zint_t sn, _z_network_message_vec_
         _Z_SET_FLAG(msg._header, _Z_FLAG_T_FRAME_R);
     }
 
-    msg._body._frame._messages = messages;
+    msg._body._frame._payload = payload;
 
     return msg;
 }
@@ -227,7 +227,7 @@ _z_transport_message_t _z_t_msg_make_frame_header(_z_zint_t sn, _Bool is_reliabl
         _Z_SET_FLAG(msg._header, _Z_FLAG_T_FRAME_R);
     }
 
-    msg._body._frame._messages = _z_network_message_vec_make(0);
+    msg._body._frame._payload = (_z_zbuf_t){0};
 
     return msg;
 }
@@ -292,7 +292,8 @@ void _z_t_msg_copy_keep_alive(_z_t_msg_keep_alive_t *clone, _z_t_msg_keep_alive_
 
 void _z_t_msg_copy_frame(_z_t_msg_frame_t *clone, _z_t_msg_frame_t *msg) {
     clone->_sn = msg->_sn;
-    _z_network_message_vec_copy(&clone->_messages, &msg->_messages);
+    // The payload is a view on the buffer the frame has been decoded from, it is not carried over to the clone
+    clone->_payload = (_z_zbuf_t){0};
 }
 
 /*------------------ Transport Message ------------------*/
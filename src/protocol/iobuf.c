@@ -271,6 +271,7 @@ _z_wbuf_t _z_wbuf_make(size_t capacity, _Bool is_expandable) {
     wbf._r_idx = 0;
     wbf._expansion_step = is_expandable ? capacity : 0;
     wbf._capacity = capacity;
+    wbf._alias_bytes = false;
 
     return wbf;
 }
@@ -413,12 +414,33 @@ int8_t _z_wbuf_wrap_bytes(_z_wbuf_t *wbf, const uint8_t *bs, size_t offset, size
 
     _z_iosli_t *ios = _z_wbuf_get_iosli(wbf, wbf->_w_idx);
     size_t writable = _z_iosli_writable(ios);
-    ios->_capacity = ios->_w_pos;  // Block writing on this ioslice
-                                   // The remaining space is allocated in a new ioslice
+    if (wbf->_expansion_step == (size_t)0) {
+        // The wrapped bytes count in the capacity of a non-expandable buffer
+        if (length > writable) {
+            return _Z_ERR_TRANSPORT_NO_SPACE;
+        }
+        writable = writable - length;
+    }
+
+    // Block writing on this ioslice, the remaining space is aliased by a new ioslice after the wrapped one.
+    // The capacity is restored by _z_wbuf_reset.
+    size_t capacity = ios->_capacity;
+    uint8_t *tail = _z_ptr_u8_offset(ios->_buf, (ptrdiff_t)ios->_w_pos);
+    ios->_capacity = ios->_w_pos;
 
     _z_iosli_t wios = _z_iosli_wrap(bs, length, offset, offset + length);
-    _z_wbuf_add_iosli(wbf, _z_iosli_clone(&wios));
-    _z_wbuf_add_iosli(wbf, __z_wbuf_new_iosli(writable));
+    _z_iosli_t *pwios = _z_iosli_clone(&wios);
+    _z_iosli_t tios = _z_iosli_wrap(tail, writable, 0, 0);
+    _z_iosli_t *ptios = _z_iosli_clone(&tios);
+    if ((pwios != NULL) && (ptios != NULL)) {
+        _z_wbuf_add_iosli(wbf, pwios);
+        _z_wbuf_add_iosli(wbf, ptios);
+    } else {
+        ios->_capacity = capacity;
+        z_free(pwios);
+        z_free(ptios);
+        ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    }
 
     return ret;
 }
@@ -518,11 +540,70 @@ _z_zbuf_t _z_wbuf_to_zbuf(const _z_wbuf_t *wbf) {
 int8_t _z_wbuf_siphon(_z_wbuf_t *dst, _z_wbuf_t *src, size_t length) {
     int8_t ret = _Z_RES_OK;
 
-    for (size_t i = 0; i < length; i++) {
-        ret = _z_wbuf_write(dst, _z_wbuf_read(src));
-        if (ret != _Z_RES_OK) {
+    size_t llength = length;
+    while (llength > (size_t)0) {
+        assert(src->_r_idx <= src->_w_idx);
+        _z_iosli_t *sios = _z_wbuf_get_iosli(src, src->_r_idx);
+        size_t readable = _z_iosli_readable(sios);
+        if (readable == (size_t)0) {
+            src->_r_idx = src->_r_idx + (size_t)1;
+            continue;
+        }
+
+        _z_iosli_t *dios = _z_wbuf_get_iosli(dst, dst->_w_idx);
+        size_t writable = _z_iosli_writable(dios);
+        if (writable == (size_t)0) {
+            // Move to the next ioslice, expanding the buffer if needed and allowed
+            if (_z_wbuf_len_iosli(dst) <= (dst->_w_idx + (size_t)1)) {
+                if (dst->_expansion_step == (size_t)0) {
+                    ret = _Z_ERR_TRANSPORT_NO_SPACE;
+                    break;
+                }
+                dios = __z_wbuf_new_iosli(dst->_expansion_step);
+                if (dios == NULL) {
+                    ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+                    break;
+                }
+                _z_iosli_vec_append(&dst->_ioss, dios);
+            }
+            dst->_w_idx = dst->_w_idx + (size_t)1;
+            continue;
+        }
+
+        size_t to_copy = (readable < writable) ? readable : writable;
+        to_copy = (to_copy < llength) ? to_copy : llength;
+        _z_iosli_write_bytes(dios, sios->_buf, sios->_r_pos, to_copy);
+        sios->_r_pos = sios->_r_pos + to_copy;
+        llength = llength - to_copy;
+    }
+
+    return ret;
+}
+
+int8_t _z_wbuf_siphon_view(_z_wbuf_t *dst, _z_wbuf_t *src, size_t length) {
+    int8_t ret = _Z_RES_OK;
+    assert(dst->_w_idx + (size_t)1 == _z_wbuf_len_iosli(dst));
+
+    size_t llength = length;
+    while (llength > (size_t)0) {
+        assert(src->_r_idx <= src->_w_idx);
+        _z_iosli_t *sios = _z_wbuf_get_iosli(src, src->_r_idx);
+        size_t readable = _z_iosli_readable(sios);
+        if (readable == (size_t)0) {
+            src->_r_idx = src->_r_idx + (size_t)1;
+            continue;
+        }
+
+        size_t to_alias = (readable < llength) ? readable : llength;
+        _z_iosli_t view = _z_iosli_wrap(sios->_buf, sios->_capacity, sios->_r_pos, sios->_r_pos + to_alias);
+        _z_iosli_t *ios = _z_iosli_clone(&view);
+        if (ios == NULL) {
+            ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
             break;
         }
+        _z_wbuf_add_iosli(dst, ios);
+        sios->_r_pos = sios->_r_pos + to_alias;
+        llength = llength - to_alias;
     }
 
     return ret;
@@ -533,6 +614,7 @@ void _z_wbuf_copy(_z_wbuf_t *dst, const _z_wbuf_t *src) {
     dst->_r_idx = src->_r_idx;
     dst->_w_idx = src->_w_idx;
     dst->_expansion_step = src->_expansion_step;
+    dst->_alias_bytes = src->_alias_bytes;
     _z_iosli_vec_copy(&dst->_ioss, &src->_ioss);
 }
 
@@ -541,12 +623,15 @@ void _z_wbuf_reset(_z_wbuf_t *wbf) {
     wbf->_w_idx = 0;
 
     // Reset to default iosli allocation
-    for (size_t i = 0; i < _z_iosli_vec_len(&wbf->_ioss); i++) {
+    size_t i = 0;
+    while (i < _z_iosli_vec_len(&wbf->_ioss)) {
         _z_iosli_t *ios = _z_wbuf_get_iosli(wbf, i);
         if (ios->_is_alloc == false) {
-            _z_iosli_vec_remove(&wbf->_ioss, i);
+            _z_iosli_vec_remove(&wbf->_ioss, i);  // The next ioslice is shifted at this index
         } else {
             _z_iosli_reset(ios);
+            ios->_capacity = wbf->_capacity;  // Undo the blocking of _z_wbuf_wrap_bytes
+            i = i + (size_t)1;
         }
     }
 }
@@ -627,6 +627,13 @@ _Bool _z_keyexpr_intersect_bothsuper(_z_str_se_t l, _z_str_se_t r, _z_ke_chunk_m
            (_z_splitstr_is_empty(&it2) || _z_keyexpr_is_superwild_chunk(it2.s));
 }
 
+_Bool _z_keyexpr_chunk_intersects(const char *lstart, const size_t llen, const char *rstart, const size_t rlen) {
+    _z_str_se_t l = {.start = lstart, .end = _z_cptr_char_offset(lstart, llen)};
+    _z_str_se_t r = {.start = rstart, .end = _z_cptr_char_offset(rstart, rlen)};
+    _Bool has_dsl = (memchr(lstart, '$', llen) != NULL) || (memchr(rstart, '$', rlen) != NULL);
+    return has_dsl ? _z_ke_chunk_intersect_stardsl(l, r) : _z_ke_chunk_intersect_nodsl(l, r);
+}
+
 _Bool _z_keyexpr_intersects(const char *lstart, const size_t llen, const char *rstart, const size_t rlen) {
     _Bool result = ((llen == rlen) && (strncmp(lstart, rstart, llen) == 0));
     if (result == false) {
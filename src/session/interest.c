@@ -0,0 +1,250 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/session/interest.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/protocol/core.h"
+#include "zenoh-pico/protocol/definitions/network.h"
+#include "zenoh-pico/protocol/keyexpr.h"
+#include "zenoh-pico/session/resource.h"
+#include "zenoh-pico/session/session.h"
+#include "zenoh-pico/session/subscription.h"
+#include "zenoh-pico/session/utils.h"
+#include "zenoh-pico/utils/logging.h"
+
+#if Z_FEATURE_INTEREST == 1
+_Bool _z_remote_subscriber_eq(const _z_remote_subscriber_t *other, const _z_remote_subscriber_t *this_) {
+    return (this_->_id == other->_id) && (this_->_mapping == other->_mapping);
+}
+
+void _z_remote_subscriber_clear(_z_remote_subscriber_t *sub) { _z_keyexpr_clear(&sub->_key); }
+
+/*------------------ Remote subscribers ------------------*/
+int8_t _z_register_remote_subscriber(_z_session_t *zn, const _z_decl_subscriber_t *decl, uint16_t mapping) {
+    int8_t ret = _Z_RES_OK;
+    _Z_DEBUG(">>> Allocating remote sub decl for (%ju:%s)", (uintmax_t)decl->_keyexpr._id, decl->_keyexpr._suffix);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    _z_remote_subscriber_t key = {._id = decl->_id, ._mapping = mapping};
+    if (_z_remote_subscriber_list_find(zn->_remote_subscribers, _z_remote_subscriber_eq, &key) == NULL) {
+        _z_remote_subscriber_t *sub = (_z_remote_subscriber_t *)z_malloc(sizeof(_z_remote_subscriber_t));
+        if (sub != NULL) {
+            *sub = key;
+            sub->_key = __unsafe_z_get_expanded_key_from_key(zn, &decl->_keyexpr);
+            if (sub->_key._suffix == NULL) {
+                z_free(sub);
+                ret = _Z_ERR_KEYEXPR_UNKNOWN;
+            } else if (_z_ketree_insert(&zn->_remote_subscribers_ketree, sub->_key._suffix, sub) != _Z_RES_OK) {
+                _z_remote_subscriber_clear(sub);
+                z_free(sub);
+                ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+            } else {
+                zn->_remote_subscribers = _z_remote_subscriber_list_push(zn->_remote_subscribers, sub);
+                _ZP_SHARED_SIZE_INCR(zn->_remote_subscribers_generation);
+            }
+        } else {
+            ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+    }
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    return ret;
+}
+
+void _z_unregister_remote_subscriber(_z_session_t *zn, uint32_t id, uint16_t mapping) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    _z_remote_subscriber_t key = {._id = id, ._mapping = mapping};
+    _z_remote_subscriber_list_t *xs =
+        _z_remote_subscriber_list_find(zn->_remote_subscribers, _z_remote_subscriber_eq, &key);
+    if (xs != NULL) {
+        _z_remote_subscriber_t *sub = _z_remote_subscriber_list_head(xs);
+        (void)_z_ketree_remove(&zn->_remote_subscribers_ketree, sub->_key._suffix, sub);
+        zn->_remote_subscribers =
+            _z_remote_subscriber_list_drop_filter(zn->_remote_subscribers, _z_remote_subscriber_eq, &key);
+        _ZP_SHARED_SIZE_INCR(zn->_remote_subscribers_generation);
+    }
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+}
+
+static _Bool __z_remote_subscriber_mapping_eq(const _z_remote_subscriber_t *other, const _z_remote_subscriber_t *this_) {
+    return this_->_mapping == other->_mapping;
+}
+
+void _z_unregister_remote_subscribers_for_peer(_z_session_t *zn, uint16_t mapping) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    _z_remote_subscriber_t key = {._mapping = mapping};
+    _z_remote_subscriber_list_t *xs =
+        _z_remote_subscriber_list_find(zn->_remote_subscribers, __z_remote_subscriber_mapping_eq, &key);
+    while (xs != NULL) {
+        _z_remote_subscriber_t *sub = _z_remote_subscriber_list_head(xs);
+        (void)_z_ketree_remove(&zn->_remote_subscribers_ketree, sub->_key._suffix, sub);
+        zn->_remote_subscribers =
+            _z_remote_subscriber_list_drop_filter(zn->_remote_subscribers, __z_remote_subscriber_mapping_eq, &key);
+        _ZP_SHARED_SIZE_INCR(zn->_remote_subscribers_generation);
+        xs = _z_remote_subscriber_list_find(zn->_remote_subscribers, __z_remote_subscriber_mapping_eq, &key);
+    }
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+}
+
+void _z_flush_remote_subscribers(_z_session_t *zn) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    _z_ketree_clear(&zn->_remote_subscribers_ketree);
+    _z_remote_subscriber_list_free(&zn->_remote_subscribers);
+    _ZP_SHARED_SIZE_INCR(zn->_remote_subscribers_generation);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+}
+
+/*------------------ Interest ------------------*/
+int8_t _z_declare_subscribers_interest(_z_session_t *zn, const _z_keyexpr_t *keyexpr) {
+    _z_keyexpr_t key = _z_get_expanded_key_from_key(zn, keyexpr);
+    if (key._suffix == NULL) {
+        return _Z_ERR_KEYEXPR_UNKNOWN;
+    }
+    // Only the current subscribers are asked for, the future ones are declared anyway
+    _z_declaration_t declaration = _z_make_decl_interest(
+        &key, (uint32_t)zn->_interest_id++, _Z_INTEREST_FLAG_SUBSCRIBERS | _Z_INTEREST_FLAG_CURRENT);
+    _z_network_message_t n_msg = _z_n_msg_make_declare(declaration);
+    int8_t ret = _z_send_n_msg(zn, &n_msg, Z_RELIABILITY_RELIABLE, Z_CONGESTION_CONTROL_BLOCK);
+    _z_n_msg_clear(&n_msg);
+    return ret;
+}
+
+#if Z_FEATURE_SUBSCRIPTION == 1
+static int8_t __z_declare_subscribers(_z_session_t *zn, const _z_keyexpr_t *key) {
+    int8_t ret = _Z_RES_OK;
+    _z_subscription_rc_list_t *subs = _z_get_subscriptions_by_key(zn, key);
+    _z_subscription_rc_list_t *xs = subs;
+    while ((ret == _Z_RES_OK) && (xs != NULL)) {
+        _z_subscription_t *sub = &_z_subscription_rc_list_head(xs)->in->val;
+        _z_keyexpr_t sub_key = _z_keyexpr_duplicate(sub->_key);
+        _z_declaration_t declaration = _z_make_decl_subscriber(
+            &sub_key, sub->_id, sub->_info.reliability == Z_RELIABILITY_RELIABLE, sub->_info.mode == Z_SUBMODE_PULL);
+        _z_network_message_t n_msg = _z_n_msg_make_declare(declaration);
+        ret = _z_send_n_msg(zn, &n_msg, Z_RELIABILITY_RELIABLE, Z_CONGESTION_CONTROL_BLOCK);
+        _z_n_msg_clear(&n_msg);
+        xs = _z_subscription_rc_list_tail(xs);
+    }
+    _z_subscription_rc_list_free(&subs);
+    return ret;
+}
+#endif
+
+int8_t _z_declare_current_subscribers(_z_session_t *zn) {
+    int8_t ret = _Z_RES_OK;
+#if Z_FEATURE_SUBSCRIPTION == 1
+    _z_keyexpr_t all = _z_rname("**");
+    ret = __z_declare_subscribers(zn, &all);
+#else
+    _ZP_UNUSED(zn);
+#endif
+    return ret;
+}
+
+int8_t _z_handle_interest(_z_session_t *zn, const _z_decl_interest_t *interest) {
+    int8_t ret = _Z_RES_OK;
+#if Z_FEATURE_SUBSCRIPTION == 1
+    if (((interest->interest_flags & _Z_INTEREST_FLAG_SUBSCRIBERS) != 0) &&
+        ((interest->interest_flags & _Z_INTEREST_FLAG_CURRENT) != 0)) {
+        _z_keyexpr_t key = _z_get_expanded_key_from_key(zn, &interest->_keyexpr);
+        if (key._suffix == NULL) {
+            return _Z_ERR_KEYEXPR_UNKNOWN;
+        }
+        ret = __z_declare_subscribers(zn, &key);
+        _z_keyexpr_clear(&key);
+    }
+#endif
+    if (ret == _Z_RES_OK) {
+        _z_network_message_t n_msg = _z_n_msg_make_declare(_z_make_final_decl(interest->_id));
+        ret = _z_send_n_msg(zn, &n_msg, Z_RELIABILITY_RELIABLE, Z_CONGESTION_CONTROL_BLOCK);
+        _z_n_msg_clear(&n_msg);
+    }
+    return ret;
+}
+
+#if Z_FEATURE_PUBLICATION == 1
+static void __z_flag_remote_subscriber(void *val, void *arg) {
+    _ZP_UNUSED(val);
+    *(_Bool *)arg = true;
+}
+
+/**
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - zn->_mutex_inner
+ */
+static _Bool __unsafe_z_has_remote_subscribers(_z_session_t *zn, const _z_keyexpr_t *keyexpr) {
+    _Bool ret = true;  // In doubt, the sample is sent
+    _z_string_rc_t shared_key;
+    _z_keyexpr_t key = __unsafe_z_get_shared_expanded_key_from_key(zn, keyexpr, &shared_key, NULL);
+    if (key._suffix != NULL) {
+        ret = false;
+        _z_ketree_intersecting(&zn->_remote_subscribers_ketree, key._suffix, __z_flag_remote_subscriber, &ret);
+    }
+    _z_keyexpr_clear(&key);
+    _z_string_rc_drop(&shared_key);
+    return ret;
+}
+
+_Bool _z_publisher_has_remote_subscribers(_z_publisher_t *pub) {
+    _z_session_t *zn = &pub->_zn.in->val;
+    size_t generation = _ZP_SHARED_SIZE_LOAD(zn->_remote_subscribers_generation);
+    size_t state = _ZP_SHARED_SIZE_LOAD(pub->_remote_subscribers_state);
+    if ((state >> 1) == (generation & (SIZE_MAX >> 1))) {
+        return (state & (size_t)1) == (size_t)0;
+    }
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    generation = _ZP_SHARED_SIZE_LOAD(zn->_remote_subscribers_generation);
+    _Bool ret = __unsafe_z_has_remote_subscribers(zn, &pub->_key);
+    _ZP_SHARED_SIZE_STORE(pub->_remote_subscribers_state, (generation << 1) | ((ret == true) ? (size_t)0 : (size_t)1));
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    return ret;
+}
+#endif
+#endif
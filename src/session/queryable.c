@@ -56,21 +56,15 @@ _z_session_queryable_rc_t *__z_get_session_queryable_by_id(_z_session_queryable_
     return ret;
 }
 
-_z_session_queryable_rc_list_t *__z_get_session_queryable_by_key(_z_session_queryable_rc_list_t *qles,
-                                                                 const _z_keyexpr_t key) {
-    _z_session_queryable_rc_list_t *ret = NULL;
-
-    _z_session_queryable_rc_list_t *xs = qles;
-    while (xs != NULL) {
-        _z_session_queryable_rc_t *qle = _z_session_queryable_rc_list_head(xs);
-        if (_z_keyexpr_intersects(qle->in->val._key._suffix, strlen(qle->in->val._key._suffix), key._suffix,
-                                  strlen(key._suffix)) == true) {
-            ret = _z_session_queryable_rc_list_push(ret, _z_session_queryable_rc_clone_as_ptr(qle));
-        }
-
-        xs = _z_session_queryable_rc_list_tail(xs);
-    }
+static void __z_push_session_queryable_clone(void *val, void *arg) {
+    _z_session_queryable_rc_list_t **qles = (_z_session_queryable_rc_list_t **)arg;
+    *qles = _z_session_queryable_rc_list_push(*qles,
+                                              _z_session_queryable_rc_clone_as_ptr((_z_session_queryable_rc_t *)val));
+}
 
+_z_session_queryable_rc_list_t *__z_get_session_queryable_by_key(_z_ketree_t *qles, const _z_keyexpr_t key) {
+    _z_session_queryable_rc_list_t *ret = NULL;
+    _z_ketree_intersecting(qles, key._suffix, __z_push_session_queryable_clone, &ret);
     return ret;
 }
 
@@ -90,8 +84,7 @@ _z_session_queryable_rc_t *__unsafe_z_get_session_queryable_by_id(_z_session_t *
  *  - zn->_mutex_inner
  */
 _z_session_queryable_rc_list_t *__unsafe_z_get_session_queryable_by_key(_z_session_t *zn, const _z_keyexpr_t key) {
-    _z_session_queryable_rc_list_t *qles = zn->_local_queryable;
-    return __z_get_session_queryable_by_key(qles, key);
+    return __z_get_session_queryable_by_key(&zn->_local_queryable_ketree, key);
 }
 
 _z_session_queryable_rc_t *_z_get_session_queryable_by_id(_z_session_t *zn, const _z_zint_t id) {
@@ -113,8 +106,11 @@ _z_session_queryable_rc_list_t *_z_get_session_queryable_by_key(_z_session_t *zn
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    _z_keyexpr_t key = __unsafe_z_get_expanded_key_from_key(zn, keyexpr);
+    _z_string_rc_t shared_key;
+    _z_keyexpr_t key = __unsafe_z_get_shared_expanded_key_from_key(zn, keyexpr, &shared_key, NULL);
     _z_session_queryable_rc_list_t *qles = __unsafe_z_get_session_queryable_by_key(zn, key);
+    _z_keyexpr_clear(&key);
+    _z_string_rc_drop(&shared_key);
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_unlock(&zn->_mutex_inner);
@@ -134,7 +130,15 @@ _z_session_queryable_rc_t *_z_register_session_queryable(_z_session_t *zn, _z_se
     ret = (_z_session_queryable_rc_t *)z_malloc(sizeof(_z_session_queryable_rc_t));
     if (ret != NULL) {
         *ret = _z_session_queryable_rc_new_from_val(*q);
-        zn->_local_queryable = _z_session_queryable_rc_list_push(zn->_local_queryable, ret);
+        if ((ret->in == NULL) ||
+            (_z_ketree_insert(&zn->_local_queryable_ketree, ret->in->val._key._suffix, ret) != _Z_RES_OK)) {
+            // Not registered: the queryable content is left untouched to the caller
+            z_free(ret->in);
+            z_free(ret);
+            ret = NULL;
+        } else {
+            zn->_local_queryable = _z_session_queryable_rc_list_push(zn->_local_queryable, ret);
+        }
     }
 
 #if Z_FEATURE_MULTI_THREAD == 1
@@ -151,7 +155,8 @@ int8_t _z_trigger_queryables(_z_session_t *zn, const _z_msg_query_t *msgq, const
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    _z_keyexpr_t key = __unsafe_z_get_expanded_key_from_key(zn, &q_key);
+    _z_string_rc_t shared_key;
+    _z_keyexpr_t key = __unsafe_z_get_shared_expanded_key_from_key(zn, &q_key, &shared_key, NULL);
     if (key._suffix != NULL) {
         _z_session_queryable_rc_list_t *qles = __unsafe_z_get_session_queryable_by_key(zn, key);
 
@@ -172,6 +177,7 @@ int8_t _z_trigger_queryables(_z_session_t *zn, const _z_msg_query_t *msgq, const
         // Clean up
         _z_query_rc_drop(&query._val._rc);
         _z_keyexpr_clear(&key);
+        _z_string_rc_drop(&shared_key);
         _z_session_queryable_rc_list_free(&qles);
     } else {
 #if Z_FEATURE_MULTI_THREAD == 1
@@ -189,8 +195,14 @@ void _z_unregister_session_queryable(_z_session_t *zn, _z_session_queryable_rc_t
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    zn->_local_queryable =
-        _z_session_queryable_rc_list_drop_filter(zn->_local_queryable, _z_session_queryable_rc_eq, qle);
+    _z_session_queryable_rc_list_t *xs =
+        _z_session_queryable_rc_list_find(zn->_local_queryable, _z_session_queryable_rc_eq, qle);
+    if (xs != NULL) {
+        _z_session_queryable_rc_t *registered = _z_session_queryable_rc_list_head(xs);
+        (void)_z_ketree_remove(&zn->_local_queryable_ketree, registered->in->val._key._suffix, registered);
+        zn->_local_queryable =
+            _z_session_queryable_rc_list_drop_filter(zn->_local_queryable, _z_session_queryable_rc_eq, qle);
+    }
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_unlock(&zn->_mutex_inner);
@@ -202,6 +214,7 @@ void _z_flush_session_queryable(_z_session_t *zn) {
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
+    _z_ketree_clear(&zn->_local_queryable_ketree);
     _z_session_queryable_rc_list_free(&zn->_local_queryable);
 
 #if Z_FEATURE_MULTI_THREAD == 1
@@ -16,6 +16,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "zenoh-pico/api/types.h"
 #include "zenoh-pico/config.h"
@@ -27,7 +28,15 @@
 
 _Bool _z_resource_eq(const _z_resource_t *other, const _z_resource_t *this_) { return this_->_id == other->_id; }
 
-void _z_resource_clear(_z_resource_t *res) { _z_keyexpr_clear(&res->_key); }
+void _z_resource_clear(_z_resource_t *res) {
+    _z_keyexpr_clear(&res->_key);
+    _z_string_rc_drop(&res->_expanded);
+    res->_expanded.in = NULL;
+#if Z_FEATURE_SUBSCRIPTION == 1
+    _z_subscription_cache_rc_drop(&res->_subscriptions);
+    res->_subscriptions.in = NULL;
+#endif
+}
 
 void _z_resource_free(_z_resource_t **res) {
     _z_resource_t *ptr = *res;
@@ -45,100 +54,256 @@ uint32_t _z_get_entity_id(_z_session_t *zn) { return zn->_entity_id++; }
 
 uint16_t _z_get_resource_id(_z_session_t *zn) { return zn->_resource_id++; }
 
-/*------------------ Resource ------------------*/
-_z_resource_t *__z_get_resource_by_id(_z_resource_list_t *rl, uint16_t mapping, const _z_zint_t id) {
-    _z_resource_t *ret = NULL;
-
-    _z_resource_list_t *xs = rl;
-    while (xs != NULL) {
-        _z_resource_t *r = _z_resource_list_head(xs);
-        if (r->_id == id && _z_keyexpr_mapping_id(&r->_key) == mapping) {
-            ret = r;
-            break;
-        }
+/*------------------ Resource table ------------------*/
+#define _Z_RESOURCE_TABLE_MIN_CAPACITY 16
+
+typedef size_t (*_z_resource_hash_f)(const _z_resource_t *res);
 
-        xs = _z_resource_list_tail(xs);
+static inline size_t _z_resource_hash_id(uint16_t mapping, uint16_t id) {
+    uint32_t h = ((uint32_t)mapping << 16) | (uint32_t)id;
+    h = h * (uint32_t)0x9E3779B1;  // Fibonacci hashing
+    return (size_t)(h ^ (h >> 15));
+}
+
+static inline size_t _z_resource_hash_key(uint16_t mapping, uint16_t parent, const char *suffix) {
+    // FNV-1a, seeded with the (mapping, parent id) pair
+    uint32_t h = (uint32_t)2166136261U ^ (uint32_t)_z_resource_hash_id(mapping, parent);
+    if (suffix != NULL) {
+        for (const char *c = suffix; *c != '\0'; c++) {
+            h = (h ^ (uint8_t)*c) * (uint32_t)16777619U;
+        }
     }
+    return (size_t)h;
+}
 
-    return ret;
+static size_t _z_resource_hash_by_id(const _z_resource_t *res) {
+    return _z_resource_hash_id(_z_keyexpr_mapping_id(&res->_key), res->_id);
 }
 
-_z_resource_t *__z_get_resource_by_key(_z_resource_list_t *rl, const _z_keyexpr_t *keyexpr) {
-    _z_resource_t *ret = NULL;
-    uint16_t mapping = _z_keyexpr_mapping_id(keyexpr);
+static size_t _z_resource_hash_by_key(const _z_resource_t *res) {
+    return _z_resource_hash_key(_z_keyexpr_mapping_id(&res->_key), res->_key._id, res->_key._suffix);
+}
+
+static void __z_resource_slots_insert(_z_resource_t **slots, size_t capacity, _z_resource_t *res, size_t hash) {
+    size_t mask = capacity - (size_t)1;
+    size_t i = hash & mask;
+    while (slots[i] != NULL) {
+        i = (i + (size_t)1) & mask;
+    }
+    slots[i] = res;
+}
 
-    _z_resource_list_t *xs = rl;
-    while (xs != NULL) {
-        _z_resource_t *r = _z_resource_list_head(xs);
-        if ((r->_key._id == keyexpr->_id) && _z_keyexpr_mapping_id(&r->_key) == mapping &&
-            (_z_str_eq(r->_key._suffix, keyexpr->_suffix) == true)) {
-            ret = r;
+static void __z_resource_slots_remove(_z_resource_t **slots, size_t capacity, const _z_resource_t *res,
+                                      _z_resource_hash_f hash_f) {
+    size_t mask = capacity - (size_t)1;
+    size_t i = hash_f(res) & mask;
+    while (slots[i] != res) {
+        if (slots[i] == NULL) {
+            return;
+        }
+        i = (i + (size_t)1) & mask;
+    }
+
+    // Backward shift deletion: move up any entry of the probe chain that would become unreachable
+    size_t j = i;
+    for (;;) {
+        j = (j + (size_t)1) & mask;
+        if (slots[j] == NULL) {
             break;
         }
+        size_t k = hash_f(slots[j]) & mask;
+        _Bool reachable = (i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j));
+        if (reachable == false) {
+            slots[i] = slots[j];
+            i = j;
+        }
+    }
+    slots[i] = NULL;
+}
 
-        xs = _z_resource_list_tail(xs);
+static int8_t __z_resource_table_resize(_z_resource_table_t *table, size_t capacity) {
+    _z_resource_t **slots = (_z_resource_t **)z_malloc((size_t)2 * capacity * sizeof(_z_resource_t *));
+    if (slots == NULL) {
+        return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
     }
+    (void)memset(slots, 0, (size_t)2 * capacity * sizeof(_z_resource_t *));
 
-    return ret;
+    for (size_t i = 0; i < table->_capacity; i++) {
+        _z_resource_t *res = table->_by_id[i];
+        if (res != NULL) {
+            __z_resource_slots_insert(slots, capacity, res, _z_resource_hash_by_id(res));
+            __z_resource_slots_insert(&slots[capacity], capacity, res, _z_resource_hash_by_key(res));
+        }
+    }
+
+    z_free(table->_by_id);
+    table->_by_id = slots;
+    table->_by_key = &slots[capacity];
+    table->_capacity = capacity;
+    return _Z_RES_OK;
 }
 
-_z_keyexpr_t __z_get_expanded_key_from_key(_z_resource_list_t *xs, const _z_keyexpr_t *keyexpr) {
-    _z_keyexpr_t ret = {._id = Z_RESOURCE_ID_NONE, ._suffix = NULL, ._mapping = _z_keyexpr_mapping(0, true)};
+void _z_resource_table_init(_z_resource_table_t *table) {
+    table->_by_id = NULL;
+    table->_by_key = NULL;
+    table->_capacity = 0;
+    table->_len = 0;
+}
+
+int8_t _z_resource_table_insert(_z_resource_table_t *table, _z_resource_t *res) {
+    // Keep the load factor below 1/2 to bound the probe sequences
+    if (((table->_len + (size_t)1) * (size_t)2) > table->_capacity) {
+        size_t capacity = (table->_capacity == (size_t)0) ? _Z_RESOURCE_TABLE_MIN_CAPACITY : table->_capacity * 2;
+        int8_t ret = __z_resource_table_resize(table, capacity);
+        if (ret != _Z_RES_OK) {
+            return ret;
+        }
+    }
+
+    __z_resource_slots_insert(table->_by_id, table->_capacity, res, _z_resource_hash_by_id(res));
+    __z_resource_slots_insert(table->_by_key, table->_capacity, res, _z_resource_hash_by_key(res));
+    table->_len++;
+    return _Z_RES_OK;
+}
+
+_z_resource_t *_z_resource_table_get_by_id(const _z_resource_table_t *table, uint16_t mapping, _z_zint_t id) {
+    if ((table->_len == (size_t)0) || (id > (_z_zint_t)UINT16_MAX)) {
+        return NULL;
+    }
+
+    size_t mask = table->_capacity - (size_t)1;
+    size_t i = _z_resource_hash_id(mapping, (uint16_t)id) & mask;
+    _z_resource_t *res = table->_by_id[i];
+    while (res != NULL) {
+        if ((res->_id == id) && (_z_keyexpr_mapping_id(&res->_key) == mapping)) {
+            return res;
+        }
+        i = (i + (size_t)1) & mask;
+        res = table->_by_id[i];
+    }
+    return NULL;
+}
 
-    // Need to build the complete resource name, by recursively look at RIDs
-    // Resource names are looked up from right to left
-    _z_str_list_t *strs = NULL;
-    size_t len = 1;  // Start with space for the null-terminator
-
-    // Append suffix as the right-most segment
-    if (keyexpr->_suffix != NULL) {
-        len = len + strlen(keyexpr->_suffix);
-        strs = _z_str_list_push(strs, (char *)keyexpr->_suffix);  // Warning: list must be release with
-                                                                  //   _z_list_free(&strs, _z_noop_free);
-                                                                  //   or will release the suffix as well
+_z_resource_t *_z_resource_table_get_by_key(const _z_resource_table_t *table, const _z_keyexpr_t *keyexpr) {
+    if ((table->_len == (size_t)0) || (keyexpr->_suffix == NULL)) {
+        return NULL;
     }
 
-    // Recursively go through all the RIDs
-    _z_zint_t id = keyexpr->_id;
     uint16_t mapping = _z_keyexpr_mapping_id(keyexpr);
-    while (id != Z_RESOURCE_ID_NONE) {
-        _z_resource_t *res = __z_get_resource_by_id(xs, mapping, id);
+    size_t mask = table->_capacity - (size_t)1;
+    size_t i = _z_resource_hash_key(mapping, keyexpr->_id, keyexpr->_suffix) & mask;
+    _z_resource_t *res = table->_by_key[i];
+    while (res != NULL) {
+        if ((res->_key._id == keyexpr->_id) && (_z_keyexpr_mapping_id(&res->_key) == mapping) &&
+            (res->_key._suffix != NULL) && (_z_str_eq(res->_key._suffix, keyexpr->_suffix) == true)) {
+            return res;
+        }
+        i = (i + (size_t)1) & mask;
+        res = table->_by_key[i];
+    }
+    return NULL;
+}
+
+void _z_resource_table_remove(_z_resource_table_t *table, const _z_resource_t *res) {
+    if (table->_len == (size_t)0) {
+        return;
+    }
+    __z_resource_slots_remove(table->_by_id, table->_capacity, res, _z_resource_hash_by_id);
+    __z_resource_slots_remove(table->_by_key, table->_capacity, res, _z_resource_hash_by_key);
+    table->_len--;
+}
+
+void _z_resource_table_drop_mapping(_z_resource_table_t *table, uint16_t mapping) {
+    // Rebuild the indexes in place with the resources that are kept
+    size_t capacity = table->_capacity;
+    _z_resource_t **old = table->_by_id;
+    if (old == NULL) {
+        return;
+    }
+    _z_resource_t **kept = (_z_resource_t **)z_malloc(capacity * sizeof(_z_resource_t *));
+    if (kept == NULL) {
+        // Fall back to removing the entries one by one
+        for (size_t i = 0; i < capacity;) {
+            _z_resource_t *res = table->_by_id[i];
+            if ((res != NULL) && (_z_keyexpr_mapping_id(&res->_key) == mapping)) {
+                _z_resource_table_remove(table, res);
+                _z_resource_free(&res);
+            } else {
+                i++;
+            }
+        }
+        return;
+    }
+
+    size_t len = 0;
+    for (size_t i = 0; i < capacity; i++) {
+        _z_resource_t *res = old[i];
         if (res == NULL) {
-            len = 0;
-            break;
+            continue;
         }
+        if (_z_keyexpr_mapping_id(&res->_key) == mapping) {
+            _z_resource_free(&res);
+        } else {
+            kept[len] = res;
+            len++;
+        }
+    }
 
-        if (res->_key._suffix != NULL) {
-            len = len + strlen(res->_key._suffix);
-            strs = _z_str_list_push(strs, (char *)res->_key._suffix);  // Warning: list must be release with
-                                                                       //   _z_list_free(&strs, _z_noop_free);
-                                                                       //   or will release the suffix as well
+    (void)memset(old, 0, (size_t)2 * capacity * sizeof(_z_resource_t *));
+    for (size_t i = 0; i < len; i++) {
+        __z_resource_slots_insert(table->_by_id, capacity, kept[i], _z_resource_hash_by_id(kept[i]));
+        __z_resource_slots_insert(table->_by_key, capacity, kept[i], _z_resource_hash_by_key(kept[i]));
+    }
+    table->_len = len;
+    z_free(kept);
+}
+
+size_t _z_resource_table_len(const _z_resource_table_t *table) { return table->_len; }
+
+void _z_resource_table_clear(_z_resource_table_t *table) {
+    for (size_t i = 0; i < table->_capacity; i++) {
+        _z_resource_t *res = table->_by_id[i];
+        if (res != NULL) {
+            _z_resource_free(&res);
         }
-        id = res->_key._id;
     }
+    z_free(table->_by_id);
+    _z_resource_table_init(table);
+}
 
-    if (len != (size_t)0) {
-        char *rname = NULL;
-        rname = (char *)z_malloc(len);
-        if (rname != NULL) {
-            rname[0] = '\0';  // NULL terminator must be set (required to strcat)
-            len = len - (size_t)1;
-
-            // Concatenate all the partial resource names
-            _z_str_list_t *xstr = strs;
-            while (xstr != NULL) {
-                char *s = _z_str_list_head(xstr);
-                if (len > (size_t)0) {
-                    (void)strncat(rname, s, len);
-                    len = len - strlen(s);
-                }
-                xstr = _z_str_list_tail(xstr);
-            }
-            ret._suffix = rname;
+/*------------------ Resource ------------------*/
+// With an arena, the expanded key is allocated from it and only owned by the returned keyexpr if it did not fit
+_z_keyexpr_t __z_get_expanded_key_from_key(const _z_resource_table_t *table, const _z_keyexpr_t *keyexpr,
+                                           _z_arena_t *arena) {
+    _z_keyexpr_t ret = {._id = Z_RESOURCE_ID_NONE, ._suffix = NULL, ._mapping = _z_keyexpr_mapping(0, true)};
+
+    // The prefix designated by the RID is already expanded on the resource itself
+    const char *prefix = NULL;
+    size_t prefix_len = 0;
+    if (keyexpr->_id != Z_RESOURCE_ID_NONE) {
+        _z_resource_t *res = _z_resource_table_get_by_id(table, _z_keyexpr_mapping_id(keyexpr), keyexpr->_id);
+        if ((res == NULL) || (res->_expanded.in == NULL)) {
+            return ret;
         }
+        prefix = res->_expanded.in->val.val;
+        prefix_len = res->_expanded.in->val.len;
     }
+    size_t suffix_len = (keyexpr->_suffix != NULL) ? strlen(keyexpr->_suffix) : (size_t)0;
 
-    _z_list_free(&strs, _z_noop_free);
+    char *rname = (char *)_z_arena_alloc(arena, prefix_len + suffix_len + (size_t)1);
+    if (rname != NULL) {
+        if (prefix_len > (size_t)0) {
+            (void)memcpy(rname, prefix, prefix_len);
+        }
+        if (suffix_len > (size_t)0) {
+            (void)memcpy(&rname[prefix_len], keyexpr->_suffix, suffix_len);
+        }
+        rname[prefix_len + suffix_len] = '\0';
+        ret._suffix = rname;
+        if ((arena != NULL) && (_z_arena_owns(arena, rname) == true)) {
+            _z_keyexpr_set_owns_suffix(&ret, false);
+        }
+    }
 
     return ret;
 }
@@ -149,8 +314,9 @@ _z_keyexpr_t __z_get_expanded_key_from_key(_z_resource_list_t *xs, const _z_keye
  *  - zn->_mutex_inner
  */
 _z_resource_t *__unsafe_z_get_resource_by_id(_z_session_t *zn, uint16_t mapping, _z_zint_t id) {
-    _z_resource_list_t *decls = (mapping == _Z_KEYEXPR_MAPPING_LOCAL) ? zn->_local_resources : zn->_remote_resources;
-    return __z_get_resource_by_id(decls, mapping, id);
+    _z_resource_table_t *decls =
+        (mapping == _Z_KEYEXPR_MAPPING_LOCAL) ? &zn->_local_resources : &zn->_remote_resources;
+    return _z_resource_table_get_by_id(decls, mapping, id);
 }
 
 /**
@@ -159,8 +325,8 @@ _z_resource_t *__unsafe_z_get_resource_by_id(_z_session_t *zn, uint16_t mapping,
  *  - zn->_mutex_inner
  */
 _z_resource_t *__unsafe_z_get_resource_by_key(_z_session_t *zn, const _z_keyexpr_t *keyexpr) {
-    _z_resource_list_t *decls = _z_keyexpr_is_local(keyexpr) ? zn->_local_resources : zn->_remote_resources;
-    return __z_get_resource_by_key(decls, keyexpr);
+    _z_resource_table_t *decls = _z_keyexpr_is_local(keyexpr) ? &zn->_local_resources : &zn->_remote_resources;
+    return _z_resource_table_get_by_key(decls, keyexpr);
 }
 
 /**
@@ -169,8 +335,35 @@ _z_resource_t *__unsafe_z_get_resource_by_key(_z_session_t *zn, const _z_keyexpr
  *  - zn->_mutex_inner
  */
 _z_keyexpr_t __unsafe_z_get_expanded_key_from_key(_z_session_t *zn, const _z_keyexpr_t *keyexpr) {
-    _z_resource_list_t *decls = _z_keyexpr_is_local(keyexpr) ? zn->_local_resources : zn->_remote_resources;
-    return __z_get_expanded_key_from_key(decls, keyexpr);
+    _z_resource_table_t *decls = _z_keyexpr_is_local(keyexpr) ? &zn->_local_resources : &zn->_remote_resources;
+    return __z_get_expanded_key_from_key(decls, keyexpr, NULL);
+}
+
+/**
+ * Same as :c:func:`__unsafe_z_get_expanded_key_from_key`, but if the keyexpr is a bare resource ID the key expanded at
+ * declaration time is shared through ``shared`` instead of being copied, so that no allocation takes place.
+ * Otherwise, the key is expanded in ``arena`` if it is not ``NULL``, and is then only valid until the arena is reset.
+ * In any case, the returned keyexpr must be released with :c:func:`_z_keyexpr_clear` and ``shared`` with
+ * :c:func:`_z_string_rc_drop`, which keeps the shared key valid even if the resource is undeclared in between.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - zn->_mutex_inner
+ */
+_z_keyexpr_t __unsafe_z_get_shared_expanded_key_from_key(_z_session_t *zn, const _z_keyexpr_t *keyexpr,
+                                                         _z_string_rc_t *shared, _z_arena_t *arena) {
+    shared->in = NULL;
+    if ((keyexpr->_suffix == NULL) && (keyexpr->_id != Z_RESOURCE_ID_NONE)) {
+        _z_resource_t *res = __unsafe_z_get_resource_by_id(zn, _z_keyexpr_mapping_id(keyexpr), keyexpr->_id);
+        if ((res != NULL) && (res->_expanded.in != NULL)) {
+            *shared = _z_string_rc_clone(&res->_expanded);
+            _z_keyexpr_t ret = {
+                ._id = Z_RESOURCE_ID_NONE, ._suffix = shared->in->val.val, ._mapping = _z_keyexpr_mapping(0, false)};
+            return ret;
+        }
+    }
+    _z_resource_table_t *decls = _z_keyexpr_is_local(keyexpr) ? &zn->_local_resources : &zn->_remote_resources;
+    return __z_get_expanded_key_from_key(decls, keyexpr, arena);
 }
 
 _z_resource_t *_z_get_resource_by_id(_z_session_t *zn, uint16_t mapping, _z_zint_t rid) {
@@ -242,15 +435,30 @@ int16_t _z_register_resource(_z_session_t *zn, _z_keyexpr_t key, uint16_t id, ui
         if (res == NULL) {
             ret = Z_RESOURCE_ID_NONE;
         } else {
+            _z_resource_table_t *decls =
+                (mapping == _Z_KEYEXPR_MAPPING_LOCAL) ? &zn->_local_resources : &zn->_remote_resources;
             res->_refcount = 1;
             res->_key = _z_keyexpr_to_owned(key);
             ret = id == Z_RESOURCE_ID_NONE ? _z_get_resource_id(zn) : id;
             res->_id = ret;
+            // Expand the key once, so that it can be shared with every sample that refers to this resource
+            res->_expanded.in = NULL;
+#if Z_FEATURE_SUBSCRIPTION == 1
+            res->_subscriptions.in = NULL;
+            res->_subscriptions_generation = 0;
+#endif
+            _z_keyexpr_t expanded = __z_get_expanded_key_from_key(decls, &res->_key, NULL);
+            if (expanded._suffix != NULL) {
+                _z_string_t str = {.len = strlen(expanded._suffix), .val = (char *)expanded._suffix};
+                res->_expanded = _z_string_rc_new_from_val(str);
+                if (res->_expanded.in == NULL) {
+                    _z_keyexpr_clear(&expanded);
+                }
+            }
             // Register the resource
-            if (mapping == _Z_KEYEXPR_MAPPING_LOCAL) {
-                zn->_local_resources = _z_resource_list_push(zn->_local_resources, res);
-            } else {
-                zn->_remote_resources = _z_resource_list_push(zn->_remote_resources, res);
+            if (_z_resource_table_insert(decls, res) != _Z_RES_OK) {
+                _z_resource_free(&res);
+                ret = Z_RESOURCE_ID_NONE;
             }
         }
     }
@@ -268,25 +476,20 @@ void _z_unregister_resource(_z_session_t *zn, uint16_t id, uint16_t mapping) {
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
-    _z_resource_list_t **parent_mut = is_local ? &zn->_local_resources : &zn->_remote_resources;
+    _z_resource_table_t *decls = is_local ? &zn->_local_resources : &zn->_remote_resources;
     while (id != 0) {
-        _z_resource_list_t *parent = *parent_mut;
-        while (parent != NULL) {
-            _z_resource_t *head = _z_resource_list_head(parent);
-            if (head && head->_id == id && _z_keyexpr_mapping_id(&head->_key) == mapping) {
-                head->_refcount--;
-                if (head->_refcount == 0) {
-                    *parent_mut = _z_resource_list_pop(parent, &head);
-                    id = head->_key._id;
-                    mapping = _z_keyexpr_mapping_id(&head->_key);
-                    _z_resource_free(&head);
-                } else {
-                    id = 0;
-                }
-                break;
-            }
-            parent_mut = &parent->_tail;
-            parent = *parent_mut;
+        _z_resource_t *res = _z_resource_table_get_by_id(decls, mapping, id);
+        if (res == NULL) {
+            break;
+        }
+        res->_refcount--;
+        if (res->_refcount == 0) {
+            _z_resource_table_remove(decls, res);
+            id = res->_key._id;
+            mapping = _z_keyexpr_mapping_id(&res->_key);
+            _z_resource_free(&res);
+        } else {
+            id = 0;
         }
     }
 #if Z_FEATURE_MULTI_THREAD == 1
@@ -294,17 +497,11 @@ void _z_unregister_resource(_z_session_t *zn, uint16_t id, uint16_t mapping) {
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 }
 
-_Bool _z_unregister_resource_for_peer_filter(const _z_resource_t *candidate, const _z_resource_t *ctx) {
-    uint16_t mapping = ctx->_id;
-    return _z_keyexpr_mapping_id(&candidate->_key) == mapping;
-}
 void _z_unregister_resources_for_peer(_z_session_t *zn, uint16_t mapping) {
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
-    _z_resource_t ctx = {._id = mapping, ._refcount = 0, ._key = {0}};
-    zn->_remote_resources =
-        _z_resource_list_drop_filter(zn->_remote_resources, _z_unregister_resource_for_peer_filter, &ctx);
+    _z_resource_table_drop_mapping(&zn->_remote_resources, mapping);
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_unlock(&zn->_mutex_inner);
@@ -316,8 +513,8 @@ void _z_flush_resources(_z_session_t *zn) {
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    _z_resource_list_free(&zn->_local_resources);
-    _z_resource_list_free(&zn->_remote_resources);
+    _z_resource_table_clear(&zn->_local_resources);
+    _z_resource_table_clear(&zn->_remote_resources);
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_unlock(&zn->_mutex_inner);
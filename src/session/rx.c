@@ -24,6 +24,7 @@
 #include "zenoh-pico/protocol/definitions/message.h"
 #include "zenoh-pico/protocol/definitions/network.h"
 #include "zenoh-pico/protocol/keyexpr.h"
+#include "zenoh-pico/session/interest.h"
 #include "zenoh-pico/session/push.h"
 #include "zenoh-pico/session/queryable.h"
 #include "zenoh-pico/session/reply.h"
@@ -52,10 +53,14 @@ int8_t _z_handle_network_message(_z_session_t *zn, _z_zenoh_message_t *msg, uint
                     _z_unregister_resource(zn, decl._decl._body._undecl_kexpr._id, local_peer_id);
                 } break;
                 case _Z_DECL_SUBSCRIBER: {
-                    // TODO: add support or explicitly discard
+#if Z_FEATURE_INTEREST == 1
+                    ret = _z_register_remote_subscriber(zn, &decl._decl._body._decl_subscriber, local_peer_id);
+#endif
                 } break;
                 case _Z_UNDECL_SUBSCRIBER: {
-                    // TODO: add support or explicitly discard
+#if Z_FEATURE_INTEREST == 1
+                    _z_unregister_remote_subscriber(zn, decl._decl._body._undecl_subscriber._id, local_peer_id);
+#endif
                 } break;
                 case _Z_DECL_QUERYABLE: {
                     // TODO: add support or explicitly discard
@@ -70,7 +75,9 @@ int8_t _z_handle_network_message(_z_session_t *zn, _z_zenoh_message_t *msg, uint
                     // TODO: add support or explicitly discard
                 } break;
                 case _Z_DECL_INTEREST: {
-                    // TODO: add support or explicitly discard
+#if Z_FEATURE_INTEREST == 1
+                    ret = _z_handle_interest(zn, &decl._decl._body._decl_interest);
+#endif
                 } break;
                 case _Z_FINAL_INTEREST: {
                     // TODO: add support or explicitly discard
@@ -194,5 +201,7 @@ int8_t _z_handle_network_message(_z_session_t *zn, _z_zenoh_message_t *msg, uint
         } break;
     }
     _z_msg_clear(msg);
+    // Nothing allocated from the arena outlives the message, so the next one of the frame reuses it from the start
+    _z_arena_reset(&zn->_rx_arena);
     return ret;
 }
@@ -37,6 +37,10 @@ void _z_subscription_clear(_z_subscription_t *sub) {
     _z_keyexpr_clear(&sub->_key);
 }
 
+void _z_subscription_cache_clear(_z_subscription_cache_t *cache) {
+    _z_subscription_rc_list_free(&cache->_subscriptions);
+}
+
 /*------------------ Pull ------------------*/
 _z_zint_t _z_get_pull_id(_z_session_t *zn) { return zn->_pull_id++; }
 
@@ -57,21 +61,80 @@ _z_subscription_rc_t *__z_get_subscription_by_id(_z_subscription_rc_list_t *subs
     return ret;
 }
 
-_z_subscription_rc_list_t *__z_get_subscriptions_by_key(_z_subscription_rc_list_t *subs, const _z_keyexpr_t key) {
+static void __z_push_subscription_clone(void *val, void *arg) {
+    _z_subscription_rc_list_t **subs = (_z_subscription_rc_list_t **)arg;
+    *subs = _z_subscription_rc_list_push(*subs, _z_subscription_rc_clone_as_ptr((_z_subscription_rc_t *)val));
+}
+
+_z_subscription_rc_list_t *__z_get_subscriptions_by_key(_z_ketree_t *subs, const _z_keyexpr_t key) {
     _z_subscription_rc_list_t *ret = NULL;
+    _z_ketree_intersecting(subs, key._suffix, __z_push_subscription_clone, &ret);
+    return ret;
+}
 
-    _z_subscription_rc_list_t *xs = subs;
+// The subscriptions matching a sample, only alive while it is dispatched: with an arena, the list and its elements are
+// allocated from it rather than from the heap
+typedef struct {
+    _z_subscription_rc_list_t *_list;
+    _z_arena_t *_arena;
+} __z_subscription_matches_t;
+
+static void __z_push_subscription_match(void *val, void *arg) {
+    __z_subscription_matches_t *matches = (__z_subscription_matches_t *)arg;
+    _z_subscription_rc_list_t *node =
+        (_z_subscription_rc_list_t *)_z_arena_alloc(matches->_arena, sizeof(_z_subscription_rc_list_t));
+    _z_subscription_rc_t *sub = (_z_subscription_rc_t *)_z_arena_alloc(matches->_arena, sizeof(_z_subscription_rc_t));
+    if ((node == NULL) || (sub == NULL)) {
+        _z_arena_free(matches->_arena, node);
+        _z_arena_free(matches->_arena, sub);
+        return;
+    }
+    *sub = _z_subscription_rc_clone((_z_subscription_rc_t *)val);
+    node->_val = sub;
+    node->_tail = matches->_list;
+    matches->_list = node;
+}
+
+static void __z_subscription_matches_clear(__z_subscription_matches_t *matches) {
+    _z_subscription_rc_list_t *xs = matches->_list;
     while (xs != NULL) {
-        _z_subscription_rc_t *sub = _z_subscription_rc_list_head(xs);
-        if (_z_keyexpr_intersects(sub->in->val._key._suffix, strlen(sub->in->val._key._suffix), key._suffix,
-                                  strlen(key._suffix)) == true) {
-            ret = _z_subscription_rc_list_push(ret, _z_subscription_rc_clone_as_ptr(sub));
-        }
+        _z_subscription_rc_list_t *tail = xs->_tail;
+        _z_subscription_rc_t *sub = (_z_subscription_rc_t *)xs->_val;
+        _z_subscription_rc_drop(sub);
+        _z_arena_free(matches->_arena, sub);
+        _z_arena_free(matches->_arena, xs);
+        xs = tail;
+    }
+    matches->_list = NULL;
+}
 
-        xs = _z_subscription_rc_list_tail(xs);
+static int8_t __z_trigger_subscriptions(_z_session_t *zn, _z_arena_t *arena, const _z_keyexpr_t keyexpr,
+                                        const _z_bytes_t payload, const _z_encoding_t encoding, const _z_zint_t kind,
+                                        const _z_timestamp_t timestamp, const _z_n_qos_t qos
+#if Z_FEATURE_ATTACHMENT == 1
+                                        ,
+                                        z_attachment_t att
+#endif
+);
+
+// Release the subscriptions cached on the resources, so that they do not outlive their undeclaration
+static void __z_drop_subscription_caches(_z_resource_table_t *table) {
+    for (size_t i = 0; i < table->_capacity; i++) {
+        _z_resource_t *res = table->_by_id[i];
+        if (res != NULL) {
+            _z_subscription_cache_rc_drop(&res->_subscriptions);
+            res->_subscriptions.in = NULL;
+        }
     }
+}
 
-    return ret;
+/**
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - zn->_mutex_inner
+ */
+_z_subscription_rc_t *__unsafe_z_get_subscription_by_id(_z_session_t *zn, const _z_zint_t id) {
+    return __z_get_subscription_by_id(zn->_local_subscriptions, id);
 }
 
 /**
@@ -79,30 +142,43 @@ _z_subscription_rc_list_t *__z_get_subscriptions_by_key(_z_subscription_rc_list_
  * Make sure that the following mutexes are locked before calling this function:
  *  - zn->_mutex_inner
  */
-_z_subscription_rc_t *__unsafe_z_get_subscription_by_id(_z_session_t *zn, uint8_t is_local, const _z_zint_t id) {
-    _z_subscription_rc_list_t *subs =
-        (is_local == _Z_RESOURCE_IS_LOCAL) ? zn->_local_subscriptions : zn->_remote_subscriptions;
-    return __z_get_subscription_by_id(subs, id);
+_z_subscription_rc_list_t *__unsafe_z_get_subscriptions_by_key(_z_session_t *zn, const _z_keyexpr_t key) {
+    return __z_get_subscriptions_by_key(&zn->_local_subscriptions_ketree, key);
 }
 
 /**
+ * Get the local subscriptions matching the resource designated by a bare resource ID. They are memoized on the
+ * resource and only computed again once the local subscriptions have changed, so that no matching nor allocation takes
+ * place on the steady state. The returned cache must be released with :c:func:`_z_subscription_cache_rc_drop`, which
+ * keeps it valid even if the resource is undeclared or the cache is rebuilt in between.
+ *
  * This function is unsafe because it operates in potentially concurrent data.
  * Make sure that the following mutexes are locked before calling this function:
  *  - zn->_mutex_inner
  */
-_z_subscription_rc_list_t *__unsafe_z_get_subscriptions_by_key(_z_session_t *zn, uint8_t is_local,
-                                                               const _z_keyexpr_t key) {
-    _z_subscription_rc_list_t *subs =
-        (is_local == _Z_RESOURCE_IS_LOCAL) ? zn->_local_subscriptions : zn->_remote_subscriptions;
-    return __z_get_subscriptions_by_key(subs, key);
+static _z_subscription_cache_rc_t __unsafe_z_get_subscription_cache(_z_session_t *zn, _z_resource_t *res,
+                                                                    const _z_keyexpr_t key) {
+    size_t generation = _ZP_SHARED_SIZE_LOAD(zn->_subscriptions_generation);
+    if ((res->_subscriptions.in == NULL) || (res->_subscriptions_generation != generation)) {
+        _z_subscription_cache_t cache = {._subscriptions = __unsafe_z_get_subscriptions_by_key(zn, key)};
+        _z_subscription_cache_rc_t rc = _z_subscription_cache_rc_new_from_val(cache);
+        if (rc.in == NULL) {
+            _z_subscription_cache_clear(&cache);
+            return rc;
+        }
+        _z_subscription_cache_rc_drop(&res->_subscriptions);
+        res->_subscriptions = rc;
+        res->_subscriptions_generation = generation;
+    }
+    return _z_subscription_cache_rc_clone(&res->_subscriptions);
 }
 
-_z_subscription_rc_t *_z_get_subscription_by_id(_z_session_t *zn, uint8_t is_local, const _z_zint_t id) {
+_z_subscription_rc_t *_z_get_subscription_by_id(_z_session_t *zn, const _z_zint_t id) {
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    _z_subscription_rc_t *sub = __unsafe_z_get_subscription_by_id(zn, is_local, id);
+    _z_subscription_rc_t *sub = __unsafe_z_get_subscription_by_id(zn, id);
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_unlock(&zn->_mutex_inner);
@@ -111,12 +187,12 @@ _z_subscription_rc_t *_z_get_subscription_by_id(_z_session_t *zn, uint8_t is_loc
     return sub;
 }
 
-_z_subscription_rc_list_t *_z_get_subscriptions_by_key(_z_session_t *zn, uint8_t is_local, const _z_keyexpr_t *key) {
+_z_subscription_rc_list_t *_z_get_subscriptions_by_key(_z_session_t *zn, const _z_keyexpr_t *key) {
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    _z_subscription_rc_list_t *subs = __unsafe_z_get_subscriptions_by_key(zn, is_local, *key);
+    _z_subscription_rc_list_t *subs = __unsafe_z_get_subscriptions_by_key(zn, *key);
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_unlock(&zn->_mutex_inner);
@@ -125,7 +201,7 @@ _z_subscription_rc_list_t *_z_get_subscriptions_by_key(_z_session_t *zn, uint8_t
     return subs;
 }
 
-_z_subscription_rc_t *_z_register_subscription(_z_session_t *zn, uint8_t is_local, _z_subscription_t *s) {
+_z_subscription_rc_t *_z_register_subscription(_z_session_t *zn, _z_subscription_t *s) {
     _Z_DEBUG(">>> Allocating sub decl for (%ju:%s)", (uintmax_t)s->_key._id, s->_key._suffix);
     _z_subscription_rc_t *ret = NULL;
 
@@ -133,18 +209,24 @@ _z_subscription_rc_t *_z_register_subscription(_z_session_t *zn, uint8_t is_loca
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    _z_subscription_rc_list_t *subs = __unsafe_z_get_subscriptions_by_key(zn, is_local, s->_key);
+    _z_subscription_rc_list_t *subs = __unsafe_z_get_subscriptions_by_key(zn, s->_key);
     if (subs == NULL) {  // A subscription for this name does not yet exists
         ret = (_z_subscription_rc_t *)z_malloc(sizeof(_z_subscription_rc_t));
         if (ret != NULL) {
             *ret = _z_subscription_rc_new_from_val(*s);
-            if (is_local == _Z_RESOURCE_IS_LOCAL) {
-                zn->_local_subscriptions = _z_subscription_rc_list_push(zn->_local_subscriptions, ret);
+            if ((ret->in == NULL) ||
+                (_z_ketree_insert(&zn->_local_subscriptions_ketree, ret->in->val._key._suffix, ret) != _Z_RES_OK)) {
+                // Not registered: the subscription content is left untouched to the caller
+                z_free(ret->in);
+                z_free(ret);
+                ret = NULL;
             } else {
-                zn->_remote_subscriptions = _z_subscription_rc_list_push(zn->_remote_subscriptions, ret);
+                zn->_local_subscriptions = _z_subscription_rc_list_push(zn->_local_subscriptions, ret);
+                _ZP_SHARED_SIZE_INCR(zn->_subscriptions_generation);
             }
         }
     }
+    _z_subscription_rc_list_free(&subs);
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_unlock(&zn->_mutex_inner);
@@ -161,22 +243,89 @@ void _z_trigger_local_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr
 #endif
 ) {
     _z_encoding_t encoding = {.prefix = Z_ENCODING_PREFIX_DEFAULT, .suffix = _z_bytes_wrap(NULL, 0)};
-    int8_t ret = _z_trigger_subscriptions(zn, keyexpr, _z_bytes_wrap(payload, payload_len), encoding, Z_SAMPLE_KIND_PUT,
-                                          _z_timestamp_null(), qos
+    // Not on the RX path, so the RX arena is not to be used
+    int8_t ret = __z_trigger_subscriptions(zn, NULL, keyexpr, _z_bytes_wrap(payload, payload_len), encoding,
+                                           Z_SAMPLE_KIND_PUT, _z_timestamp_null(), qos
 #if Z_FEATURE_ATTACHMENT == 1
-                                          ,
-                                          att
+                                           ,
+                                           att
 #endif
     );
     (void)ret;
 }
 
-int8_t _z_trigger_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, const _z_bytes_t payload,
-                                const _z_encoding_t encoding, const _z_zint_t kind, const _z_timestamp_t timestamp,
-                                const _z_n_qos_t qos
+static void __z_flag_subscription(void *val, void *arg) {
+    _ZP_UNUSED(val);
+    *(_Bool *)arg = true;
+}
+
+/**
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - zn->_mutex_inner
+ */
+static _Bool __unsafe_z_has_local_subscriptions(_z_session_t *zn, const _z_keyexpr_t *keyexpr) {
+    _Bool ret = true;  // In doubt, the sample goes through the regular local delivery
+    _z_string_rc_t shared_key;
+    _z_keyexpr_t key = __unsafe_z_get_shared_expanded_key_from_key(zn, keyexpr, &shared_key, NULL);
+    if (key._suffix != NULL) {
+        ret = false;
+        _z_ketree_intersecting(&zn->_local_subscriptions_ketree, key._suffix, __z_flag_subscription, &ret);
+    }
+    _z_keyexpr_clear(&key);
+    _z_string_rc_drop(&shared_key);
+    return ret;
+}
+
+_Bool _z_publisher_has_local_subscriptions(_z_publisher_t *pub) {
+    _z_session_t *zn = &pub->_zn.in->val;
+    size_t generation = _ZP_SHARED_SIZE_LOAD(zn->_subscriptions_generation);
+    size_t state = _ZP_SHARED_SIZE_LOAD(pub->_local_subscriptions_state);
+    if ((state >> 1) == (generation & (SIZE_MAX >> 1))) {
+        return (state & (size_t)1) == (size_t)0;
+    }
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    generation = _ZP_SHARED_SIZE_LOAD(zn->_subscriptions_generation);
+    _Bool ret = __unsafe_z_has_local_subscriptions(zn, &pub->_key);
+    state = (generation << 1) | ((ret == true) ? (size_t)0 : (size_t)1);
+    _ZP_SHARED_SIZE_STORE(pub->_local_subscriptions_state, state);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&zn->_mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    return ret;
+}
+
+void _z_trigger_publisher_local_subscriptions(_z_publisher_t *pub, const uint8_t *payload, _z_zint_t payload_len,
+                                              _z_n_qos_t qos
 #if Z_FEATURE_ATTACHMENT == 1
-                                ,
-                                z_attachment_t att
+                                              ,
+                                              z_attachment_t att
+#endif
+) {
+    if (_z_publisher_has_local_subscriptions(pub) == false) {
+        return;
+    }
+
+    _z_trigger_local_subscriptions(&pub->_zn.in->val, pub->_key, payload, payload_len, qos
+#if Z_FEATURE_ATTACHMENT == 1
+                                   ,
+                                   att
+#endif
+    );
+}
+
+static int8_t __z_trigger_subscriptions(_z_session_t *zn, _z_arena_t *arena, const _z_keyexpr_t keyexpr,
+                                        const _z_bytes_t payload, const _z_encoding_t encoding, const _z_zint_t kind,
+                                        const _z_timestamp_t timestamp, const _z_n_qos_t qos
+#if Z_FEATURE_ATTACHMENT == 1
+                                        ,
+                                        z_attachment_t att
 #endif
 ) {
     int8_t ret = _Z_RES_OK;
@@ -186,10 +335,21 @@ int8_t _z_trigger_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, co
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
     _Z_DEBUG("Resolving %d - %s on mapping 0x%x", keyexpr._id, keyexpr._suffix, _z_keyexpr_mapping_id(&keyexpr));
-    _z_keyexpr_t key = __unsafe_z_get_expanded_key_from_key(zn, &keyexpr);
+    _z_string_rc_t shared_key;
+    _z_keyexpr_t key = __unsafe_z_get_shared_expanded_key_from_key(zn, &keyexpr, &shared_key, arena);
     _Z_DEBUG("Triggering subs for %d - %s", key._id, key._suffix);
     if (key._suffix != NULL) {
-        _z_subscription_rc_list_t *subs = __unsafe_z_get_subscriptions_by_key(zn, _Z_RESOURCE_IS_LOCAL, key);
+        // Samples on a declared resource are dispatched to the subscriptions cached on it
+        _z_subscription_cache_rc_t cache = {.in = NULL};
+        __z_subscription_matches_t matches = {._list = NULL, ._arena = arena};
+        if (shared_key.in != NULL) {
+            _z_resource_t *res = __unsafe_z_get_resource_by_id(zn, _z_keyexpr_mapping_id(&keyexpr), keyexpr._id);
+            cache = __unsafe_z_get_subscription_cache(zn, res, key);
+        }
+        if (cache.in == NULL) {
+            _z_ketree_intersecting(&zn->_local_subscriptions_ketree, key._suffix, __z_push_subscription_match,
+                                   &matches);
+        }
 
 #if Z_FEATURE_MULTI_THREAD == 1
         z_mutex_unlock(&zn->_mutex_inner);
@@ -206,7 +366,7 @@ int8_t _z_trigger_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, co
 #if Z_FEATURE_ATTACHMENT == 1
         s.attachment = att;
 #endif
-        _z_subscription_rc_list_t *xs = subs;
+        _z_subscription_rc_list_t *xs = (cache.in != NULL) ? cache.in->val._subscriptions : matches._list;
         _Z_DEBUG("Triggering %ju subs", (uintmax_t)_z_subscription_rc_list_len(xs));
         while (xs != NULL) {
             _z_subscription_rc_t *sub = _z_subscription_rc_list_head(xs);
@@ -215,7 +375,9 @@ int8_t _z_trigger_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, co
         }
 
         _z_keyexpr_clear(&key);
-        _z_subscription_rc_list_free(&subs);
+        _z_string_rc_drop(&shared_key);
+        _z_subscription_cache_rc_drop(&cache);
+        __z_subscription_matches_clear(&matches);
     } else {
 #if Z_FEATURE_MULTI_THREAD == 1
         z_mutex_unlock(&zn->_mutex_inner);
@@ -226,17 +388,36 @@ int8_t _z_trigger_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, co
     return ret;
 }
 
-void _z_unregister_subscription(_z_session_t *zn, uint8_t is_local, _z_subscription_rc_t *sub) {
+int8_t _z_trigger_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr, const _z_bytes_t payload,
+                                const _z_encoding_t encoding, const _z_zint_t kind, const _z_timestamp_t timestamp,
+                                const _z_n_qos_t qos
+#if Z_FEATURE_ATTACHMENT == 1
+                                ,
+                                z_attachment_t att
+#endif
+) {
+    return __z_trigger_subscriptions(zn, &zn->_rx_arena, keyexpr, payload, encoding, kind, timestamp, qos
+#if Z_FEATURE_ATTACHMENT == 1
+                                     ,
+                                     att
+#endif
+    );
+}
+
+void _z_unregister_subscription(_z_session_t *zn, _z_subscription_rc_t *sub) {
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    if (is_local == _Z_RESOURCE_IS_LOCAL) {
+    _z_subscription_rc_list_t *xs = _z_subscription_rc_list_find(zn->_local_subscriptions, _z_subscription_rc_eq, sub);
+    if (xs != NULL) {
+        _z_subscription_rc_t *registered = _z_subscription_rc_list_head(xs);
+        (void)_z_ketree_remove(&zn->_local_subscriptions_ketree, registered->in->val._key._suffix, registered);
         zn->_local_subscriptions =
             _z_subscription_rc_list_drop_filter(zn->_local_subscriptions, _z_subscription_rc_eq, sub);
-    } else {
-        zn->_remote_subscriptions =
-            _z_subscription_rc_list_drop_filter(zn->_remote_subscriptions, _z_subscription_rc_eq, sub);
+        _ZP_SHARED_SIZE_INCR(zn->_subscriptions_generation);
+        __z_drop_subscription_caches(&zn->_local_resources);
+        __z_drop_subscription_caches(&zn->_remote_resources);
     }
 
 #if Z_FEATURE_MULTI_THREAD == 1
@@ -249,8 +430,11 @@ void _z_flush_subscriptions(_z_session_t *zn) {
     z_mutex_lock(&zn->_mutex_inner);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
+    __z_drop_subscription_caches(&zn->_local_resources);
+    __z_drop_subscription_caches(&zn->_remote_resources);
+    _ZP_SHARED_SIZE_INCR(zn->_subscriptions_generation);
+    _z_ketree_clear(&zn->_local_subscriptions_ketree);
     _z_subscription_rc_list_free(&zn->_local_subscriptions);
-    _z_subscription_rc_list_free(&zn->_remote_subscriptions);
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_unlock(&zn->_mutex_inner);
@@ -267,4 +451,12 @@ void _z_trigger_local_subscriptions(_z_session_t *zn, const _z_keyexpr_t keyexpr
     _ZP_UNUSED(qos);
 }
 
+void _z_trigger_publisher_local_subscriptions(_z_publisher_t *pub, const uint8_t *payload, _z_zint_t payload_len,
+                                              _z_n_qos_t qos) {
+    _ZP_UNUSED(pub);
+    _ZP_UNUSED(payload);
+    _ZP_UNUSED(payload_len);
+    _ZP_UNUSED(qos);
+}
+
 #endif  // Z_FEATURE_SUBSCRIPTION == 1
@@ -18,6 +18,7 @@
 
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/protocol/core.h"
+#include "zenoh-pico/session/interest.h"
 #include "zenoh-pico/session/query.h"
 #include "zenoh-pico/session/queryable.h"
 #include "zenoh-pico/session/resource.h"
@@ -57,24 +58,39 @@ int8_t _z_session_init(_z_session_t *zn, _z_id_t *zid) {
     zn->_resource_id = 1;
     zn->_query_id = 1;
     zn->_pull_id = 1;
+    zn->_interest_id = 1;
 
     // Initialize the data structs
-    zn->_local_resources = NULL;
-    zn->_remote_resources = NULL;
+    _z_resource_table_init(&zn->_local_resources);
+    _z_resource_table_init(&zn->_remote_resources);
 #if Z_FEATURE_SUBSCRIPTION == 1
     zn->_local_subscriptions = NULL;
-    zn->_remote_subscriptions = NULL;
+    _z_ketree_init(&zn->_local_subscriptions_ketree);
+    _ZP_SHARED_SIZE_STORE(zn->_subscriptions_generation, 1);
+#endif
+#if Z_FEATURE_INTEREST == 1
+    zn->_remote_subscribers = NULL;
+    _z_ketree_init(&zn->_remote_subscribers_ketree);
+    _ZP_SHARED_SIZE_STORE(zn->_remote_subscribers_generation, 1);
 #endif
 #if Z_FEATURE_QUERYABLE == 1
     zn->_local_queryable = NULL;
+    _z_ketree_init(&zn->_local_queryable_ketree);
 #endif
 #if Z_FEATURE_QUERY == 1
     zn->_pending_queries = NULL;
 #endif
 
+    ret = _z_arena_init(&zn->_rx_arena, Z_RX_ARENA_SIZE);
+    if (ret != _Z_RES_OK) {
+        _z_transport_clear(&zn->_tp);
+        return ret;
+    }
+
 #if Z_FEATURE_MULTI_THREAD == 1
     ret = z_mutex_init(&zn->_mutex_inner);
     if (ret != _Z_RES_OK) {
+        _z_arena_clear(&zn->_rx_arena);
         _z_transport_clear(&zn->_tp);
         return ret;
     }
@@ -109,12 +125,16 @@ void _z_session_clear(_z_session_t *zn) {
 #if Z_FEATURE_SUBSCRIPTION == 1
     _z_flush_subscriptions(zn);
 #endif
+#if Z_FEATURE_INTEREST == 1
+    _z_flush_remote_subscribers(zn);
+#endif
 #if Z_FEATURE_QUERYABLE == 1
     _z_flush_session_queryable(zn);
 #endif
 #if Z_FEATURE_QUERY == 1
     _z_flush_pending_queries(zn);
 #endif
+    _z_arena_clear(&zn->_rx_arena);
 
 #if Z_FEATURE_MULTI_THREAD == 1
     z_mutex_free(&zn->_mutex_inner);
@@ -27,8 +27,6 @@ extern "C" {
 #include "zenoh-pico/system/link/bt.h"
 #include "zenoh-pico/system/link/serial.h"
 #include "zenoh-pico/system/platform.h"
-#include "zenoh-pico/utils/checksum.h"
-#include "zenoh-pico/utils/encoding.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
@@ -492,8 +490,7 @@ size_t _z_read_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_
             struct sockaddr_in *b = ((struct sockaddr_in *)&raddr);
             if (!((a->sin_port == b->sin_port) && (a->sin_addr.s_addr == b->sin_addr.s_addr))) {
                 // If addr is not NULL, it means that the raddr was requested by the upper-layers
-                if (addr != NULL) {
-                    *addr = _z_bytes_make(sizeof(in_addr_t) + sizeof(in_port_t));
+                if ((addr != NULL) && (_z_bytes_reserve(addr, sizeof(in_addr_t) + sizeof(in_port_t)) == _Z_RES_OK)) {
                     (void)memcpy((uint8_t *)addr->start, &b->sin_addr.s_addr, sizeof(in_addr_t));
                     (void)memcpy((uint8_t *)(addr->start + sizeof(in_addr_t)), &b->sin_port, sizeof(in_port_t));
                 }
@@ -505,8 +502,8 @@ size_t _z_read_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_
             if ((a->sin6_port != b->sin6_port) ||
                 (memcmp(&a->sin6_addr, &b->sin6_addr, sizeof(struct in6_addr)) != 0)) {
                 // If addr is not NULL, it means that the raddr was requested by the upper-layers
-                if (addr != NULL) {
-                    *addr = _z_bytes_make(sizeof(struct in6_addr) + sizeof(in_port_t));
+                if ((addr != NULL) &&
+                    (_z_bytes_reserve(addr, sizeof(struct in6_addr) + sizeof(in_port_t)) == _Z_RES_OK)) {
                     (void)memcpy((uint8_t *)addr->start, &b->sin6_addr.s6_addr, sizeof(struct in6_addr));
                     (void)memcpy((uint8_t *)(addr->start + sizeof(struct in6_addr)), &b->sin6_port, sizeof(in_port_t));
                 }
@@ -752,110 +749,29 @@ void _z_close_serial(_z_sys_net_socket_t *sock) {
     delete sock->_serial;
 }
 
-size_t _z_read_serial(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
-    int8_t ret = _Z_RES_OK;
-
-    uint8_t *before_cobs = new uint8_t[_Z_SERIAL_MAX_COBS_BUF_SIZE]();
-    size_t rb = 0;
-    for (size_t i = 0; i < _Z_SERIAL_MAX_COBS_BUF_SIZE; i++) {
-        while (sock._serial->available() < 1) {
-            z_sleep_ms(1);  // FIXME: Yield by sleeping.
-        }
-        before_cobs[i] = sock._serial->read();
-        rb = rb + (size_t)1;
-        if (before_cobs[i] == (uint8_t)0x00) {
-            break;
-        }
+size_t _z_read_serial_internal(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    while (sock._serial->available() < 1) {
+        z_sleep_ms(1);  // FIXME: Yield by sleeping.
     }
 
-    uint8_t *after_cobs = new uint8_t[_Z_SERIAL_MFS_SIZE]();
-    size_t trb = _z_cobs_decode(before_cobs, rb, after_cobs);
-
-    size_t i = 0;
-    uint16_t payload_len = 0;
-    for (i = 0; i < sizeof(payload_len); i++) {
-        payload_len |= (after_cobs[i] << ((uint8_t)i * (uint8_t)8));
+    // Take all the bytes already received at once
+    size_t available = (size_t)sock._serial->available();
+    if (available > len) {
+        available = len;
     }
-
-    if (trb == (size_t)(payload_len + (uint16_t)6)) {
-        (void)memcpy(ptr, &after_cobs[i], payload_len);
-        i = i + (size_t)payload_len;
-
-        uint32_t crc = 0;
-        for (uint8_t j = 0; j < sizeof(crc); j++) {
-            crc |= (uint32_t)(after_cobs[i] << (j * (uint8_t)8));
-            i = i + (size_t)1;
-        }
-
-        uint32_t c_crc = _z_crc32(ptr, payload_len);
-        if (c_crc != crc) {
-            ret = _Z_ERR_GENERIC;
-        }
-    } else {
-        ret = _Z_ERR_GENERIC;
-    }
-
-    delete before_cobs;
-    delete after_cobs;
-
-    rb = payload_len;
-    if (ret != _Z_RES_OK) {
-        rb = SIZE_MAX;
+    size_t rb = sock._serial->read(ptr, available);
+    if (rb == (size_t)0) {
+        return SIZE_MAX;
     }
-
     return rb;
 }
 
-size_t _z_read_exact_serial(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
-    size_t n = len;
-    size_t rb = 0;
-
-    do {
-        rb = _z_read_serial(sock, ptr, n);
-        if (rb == SIZE_MAX) return rb;
-
-        n -= rb;
-        ptr = ptr + (len - n);
-    } while (n > 0);
-
-    return len;
-}
-
-size_t _z_send_serial(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len) {
-    int8_t ret = _Z_RES_OK;
-
-    uint8_t *before_cobs = (uint8_t *)z_malloc(_Z_SERIAL_MFS_SIZE);
-    size_t i = 0;
-    for (i = 0; i < sizeof(uint16_t); ++i) {
-        before_cobs[i] = (len >> (i * (size_t)8)) & (size_t)0XFF;
-    }
-
-    (void)memcpy(&before_cobs[i], ptr, len);
-    i = i + len;
-
-    uint32_t crc = _z_crc32(ptr, len);
-    for (uint8_t j = 0; j < sizeof(crc); j++) {
-        before_cobs[i] = (crc >> (j * (uint8_t)8)) & (uint32_t)0XFF;
-        i = i + (size_t)1;
-    }
-
-    uint8_t *after_cobs = (uint8_t *)z_malloc(_Z_SERIAL_MAX_COBS_BUF_SIZE);
-    ssize_t twb = _z_cobs_encode(before_cobs, i, after_cobs);
-    after_cobs[twb] = 0x00;  // Manually add the COBS delimiter
-    ssize_t wb = sock._serial->write(after_cobs, twb + (ssize_t)1);
-    if (wb != (twb + (ssize_t)1)) {
-        ret = _Z_ERR_GENERIC;
+size_t _z_send_serial_internal(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len) {
+    size_t wb = sock._serial->write(ptr, len);
+    if (wb != len) {
+        return SIZE_MAX;
     }
-
-    z_free(before_cobs);
-    z_free(after_cobs);
-
-    size_t sb = len;
-    if (ret != _Z_RES_OK) {
-        sb = SIZE_MAX;
-    }
-
-    return sb;
+    return len;
 }
 #endif
 
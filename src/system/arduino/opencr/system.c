@@ -42,22 +42,24 @@ void z_random_fill(void *buf, size_t len) {
 }
 
 /*------------------ Memory ------------------*/
-void *z_malloc(size_t size) {
+#if Z_FEATURE_MEMORY_POOLS == 0  // Otherwise served by the memory pools
+void *_z_platform_malloc(size_t size) {
     // return pvPortMalloc(size); // FIXME: Further investigation is required to understand
     //        why pvPortMalloc or pvPortMallocAligned are failing
     return malloc(size);
 }
 
-void *z_realloc(void *ptr, size_t size) {
+void *_z_platform_realloc(void *ptr, size_t size) {
     // Not implemented by the platform
     return NULL;
 }
 
-void z_free(void *ptr) {
+void _z_platform_free(void *ptr) {
     // vPortFree(ptr); // FIXME: Further investigation is required to understand
     //        why vPortFree or vPortFreeAligned are failing
     return free(ptr);
 }
+#endif  // Z_FEATURE_MEMORY_POOLS == 0
 
 #if Z_FEATURE_MULTI_THREAD == 1
 #error "Multi-threading not supported yet on OpenCR port. Disable it by defining Z_FEATURE_MULTI_THREAD=0"
@@ -94,6 +96,8 @@ int8_t z_condvar_free(z_condvar_t *cv) { return -1; }
 int8_t z_condvar_signal(z_condvar_t *cv) { return -1; }
 
 int8_t z_condvar_wait(z_condvar_t *cv, z_mutex_t *m) { return -1; }
+
+int8_t z_condvar_wait_for(z_condvar_t *cv, z_mutex_t *m, uint32_t time_ms) { return -1; }
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
 /*------------------ Sleep ------------------*/
@@ -43,14 +43,15 @@ void z_random_fill(void* buf, size_t len) {
 }
 
 /*------------------ Memory ------------------*/
-void* z_malloc(size_t size) {
+#if Z_FEATURE_MEMORY_POOLS == 0  // Otherwise served by the memory pools
+void* _z_platform_malloc(size_t size) {
     if (!size) {
         return NULL;
     }
     return malloc(size);
 }
 
-void* z_realloc(void* ptr, size_t size) {
+void* _z_platform_realloc(void* ptr, size_t size) {
     if (!size) {
         free(ptr);
         return NULL;
@@ -58,7 +59,8 @@ void* z_realloc(void* ptr, size_t size) {
     return realloc(ptr, size);
 }
 
-void z_free(void* ptr) { return free(ptr); }
+void _z_platform_free(void* ptr) { return free(ptr); }
+#endif  // Z_FEATURE_MEMORY_POOLS == 0
 
 /*------------------ Task ------------------*/
 
@@ -149,6 +151,8 @@ int8_t z_condvar_signal(z_condvar_t* cv) { return -1; }
 
 int8_t z_condvar_wait(z_condvar_t* cv, z_mutex_t* m) { return -1; }
 
+int8_t z_condvar_wait_for(z_condvar_t* cv, z_mutex_t* m, uint32_t time_ms) { return -1; }
+
 /*------------------ Sleep ------------------*/
 int z_sleep_us(size_t time) {
     furi_delay_us(time);
@@ -48,14 +48,16 @@ void z_random_fill(void *buf, size_t len) {
 }
 
 /*------------------ Memory ------------------*/
-void *z_malloc(size_t size) { return pvPortMalloc(size); }
+#if Z_FEATURE_MEMORY_POOLS == 0  // Otherwise served by the memory pools
+void *_z_platform_malloc(size_t size) { return pvPortMalloc(size); }
 
-void *z_realloc(void *ptr, size_t size) {
+void *_z_platform_realloc(void *ptr, size_t size) {
     // realloc not implemented in FreeRTOS
     return NULL;
 }
 
-void z_free(void *ptr) { vPortFree(ptr); }
+void _z_platform_free(void *ptr) { vPortFree(ptr); }
+#endif  // Z_FEATURE_MEMORY_POOLS == 0
 
 #if Z_FEATURE_MULTI_THREAD == 1
 // In FreeRTOS, tasks created using xTaskCreate must end with vTaskDelete.
@@ -157,6 +159,7 @@ int8_t z_condvar_init(z_condvar_t *cv) { return -1; }
 int8_t z_condvar_free(z_condvar_t *cv) { return -1; }
 int8_t z_condvar_signal(z_condvar_t *cv) { return -1; }
 int8_t z_condvar_wait(z_condvar_t *cv, z_mutex_t *m) { return -1; }
+int8_t z_condvar_wait_for(z_condvar_t *cv, z_mutex_t *m, uint32_t time_ms) { return -1; }
 #endif  // Z_MULTI_THREAD == 1
 
 /*------------------ Sleep ------------------*/
@@ -26,8 +26,6 @@ extern "C" {
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/system/link/serial.h"
 #include "zenoh-pico/system/platform.h"
-#include "zenoh-pico/utils/checksum.h"
-#include "zenoh-pico/utils/encoding.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
@@ -274,13 +272,13 @@ size_t _z_read_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_
         }
 
         if (raddr.get_ip_version() == NSAPI_IPv4) {
-            *addr = _z_bytes_make(NSAPI_IPv4_BYTES + sizeof(uint16_t));
+            (void)_z_bytes_reserve(addr, NSAPI_IPv4_BYTES + sizeof(uint16_t));
             (void)memcpy(const_cast<uint8_t *>(addr->start), raddr.get_ip_bytes(), NSAPI_IPv4_BYTES);
             uint16_t port = raddr.get_port();
             (void)memcpy(const_cast<uint8_t *>(addr->start + NSAPI_IPv4_BYTES), &port, sizeof(uint16_t));
             break;
         } else if (raddr.get_ip_version() == NSAPI_IPv6) {
-            *addr = _z_bytes_make(NSAPI_IPv6_BYTES + sizeof(uint16_t));
+            (void)_z_bytes_reserve(addr, NSAPI_IPv6_BYTES + sizeof(uint16_t));
             (void)memcpy(const_cast<uint8_t *>(addr->start), raddr.get_ip_bytes(), NSAPI_IPv6_BYTES);
             uint16_t port = raddr.get_port();
             (void)memcpy(const_cast<uint8_t *>(addr->start + NSAPI_IPv6_BYTES), &port, sizeof(uint16_t));
@@ -372,111 +370,21 @@ int8_t _z_listen_serial_from_dev(_z_sys_net_socket_t *sock, char *device, uint32
 
 void _z_close_serial(_z_sys_net_socket_t *sock) { delete sock->_serial; }
 
-size_t _z_read_serial(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
-    int8_t ret = _Z_RES_OK;
-
-    uint8_t *before_cobs = new uint8_t[_Z_SERIAL_MAX_COBS_BUF_SIZE]();
-    size_t rb = 0;
-    for (size_t i = 0; i < _Z_SERIAL_MAX_COBS_BUF_SIZE; i++) {
-        sock._serial->read(&before_cobs[i], 1);
-        rb = rb + (size_t)1;
-        if (before_cobs[i] == (uint8_t)0x00) {
-            break;
-        }
-    }
-
-    uint8_t *after_cobs = new uint8_t[_Z_SERIAL_MFS_SIZE]();
-    size_t trb = _z_cobs_decode(before_cobs, rb, after_cobs);
-
-    size_t i = 0;
-    uint16_t payload_len = 0;
-    for (i = 0; i < sizeof(payload_len); i++) {
-        payload_len |= (after_cobs[i] << ((uint8_t)i * (uint8_t)8));
+size_t _z_read_serial_internal(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    // Blocks until some bytes are received, and returns the ones buffered so far
+    ssize_t rb = sock._serial->read(ptr, len);
+    if (rb <= 0) {
+        return SIZE_MAX;
     }
-
-    if (trb == (size_t)(payload_len + (uint16_t)6)) {
-        (void)memcpy(ptr, &after_cobs[i], payload_len);
-        i = i + (size_t)payload_len;
-
-        uint32_t crc = 0;
-        for (uint8_t j = 0; j < sizeof(crc); j++) {
-            crc |= (uint32_t)(after_cobs[i] << (j * (uint8_t)8));
-            i = i + (size_t)1;
-        }
-
-        uint32_t c_crc = _z_crc32(ptr, payload_len);
-        if (c_crc != crc) {
-            ret = _Z_ERR_GENERIC;
-        }
-    } else {
-        ret = _Z_ERR_GENERIC;
-    }
-
-    delete before_cobs;
-    delete after_cobs;
-
-    rb = payload_len;
-    if (ret != _Z_RES_OK) {
-        rb = SIZE_MAX;
-    }
-
-    return rb;
+    return (size_t)rb;
 }
 
-size_t _z_read_exact_serial(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
-    size_t n = 0;
-    uint8_t *pos = &ptr[0];
-
-    do {
-        size_t rb = _z_read_serial(sock, ptr, len - n);
-        if (rb == SIZE_MAX) {
-            n = rb;
-            break;
-        }
-
-        n = n + rb;
-        pos = _z_ptr_u8_offset(pos, n);
-    } while (n != len);
-
-    return n;
-}
-
-size_t _z_send_serial(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len) {
-    int8_t ret = _Z_RES_OK;
-
-    uint8_t *before_cobs = new uint8_t[_Z_SERIAL_MFS_SIZE]();
-    size_t i = 0;
-    for (; i < sizeof(uint16_t); ++i) {
-        before_cobs[i] = (len >> (i * (size_t)8)) & (size_t)0XFF;
+size_t _z_send_serial_internal(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len) {
+    ssize_t wb = sock._serial->write(ptr, len);
+    if ((wb < 0) || ((size_t)wb != len)) {
+        return SIZE_MAX;
     }
-
-    (void)memcpy(&before_cobs[i], ptr, len);
-    i = i + len;
-
-    uint32_t crc = _z_crc32(ptr, len);
-    for (uint8_t j = 0; j < sizeof(crc); j++) {
-        before_cobs[i] = (crc >> (j * (uint8_t)8)) & (uint32_t)0XFF;
-        i = i + (size_t)1;
-    }
-
-    uint8_t *after_cobs = new uint8_t[_Z_SERIAL_MAX_COBS_BUF_SIZE]();
-    ssize_t twb = _z_cobs_encode(before_cobs, i, after_cobs);
-    after_cobs[twb] = 0x00;  // Manually add the COBS delimiter
-
-    ssize_t wb = sock._serial->write(after_cobs, twb + (ssize_t)1);
-    if (wb != (twb + (ssize_t)1)) {
-        ret = _Z_ERR_GENERIC;
-    }
-
-    delete before_cobs;
-    delete after_cobs;
-
-    size_t sb = len;
-    if (ret != _Z_RES_OK) {
-        sb = SIZE_MAX;
-    }
-
-    return sb;
+    return len;
 }
 #endif
 
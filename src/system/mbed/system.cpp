@@ -33,11 +33,13 @@ uint64_t z_random_u64(void) { return randLIB_get_64bit(); }
 void z_random_fill(void *buf, size_t len) { randLIB_get_n_bytes_random(buf, len); }
 
 /*------------------ Memory ------------------*/
-void *z_malloc(size_t size) { return malloc(size); }
+#if Z_FEATURE_MEMORY_POOLS == 0  // Otherwise served by the memory pools
+void *_z_platform_malloc(size_t size) { return malloc(size); }
 
-void *z_realloc(void *ptr, size_t size) { return realloc(ptr, size); }
+void *_z_platform_realloc(void *ptr, size_t size) { return realloc(ptr, size); }
 
-void z_free(void *ptr) { free(ptr); }
+void _z_platform_free(void *ptr) { free(ptr); }
+#endif  // Z_FEATURE_MEMORY_POOLS == 0
 
 #if Z_FEATURE_MULTI_THREAD == 1
 /*------------------ Task ------------------*/
@@ -106,6 +108,12 @@ int8_t z_condvar_wait(z_condvar_t *cv, z_mutex_t *m) {
     ((ConditionVariable *)*cv)->wait();
     return 0;
 }
+
+int8_t z_condvar_wait_for(z_condvar_t *cv, z_mutex_t *m, uint32_t time_ms) {
+    *cv = new ConditionVariable(*((Mutex *)*m));
+    ((ConditionVariable *)*cv)->wait_for(chrono::milliseconds(time_ms));
+    return 0;
+}
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
 /*------------------ Sleep ------------------*/
@@ -109,8 +109,7 @@ size_t _z_receive_raweth(const _z_sys_net_socket_t *sock, void *buff, size_t buf
         return SIZE_MAX;
     }
     // Copy sender mac if needed
-    if (addr != NULL) {
-        *addr = _z_bytes_make(sizeof(ETH_ALEN));
+    if ((addr != NULL) && (_z_bytes_reserve(addr, sizeof(ETH_ALEN)) == _Z_RES_OK)) {
         (void)memcpy((uint8_t *)addr->start, (buff + ETH_ALEN), sizeof(ETH_ALEN));
     }
     return bytesRead;
@@ -14,23 +14,56 @@
 
 #include <arpa/inet.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <ifaddrs.h>
 #include <net/if.h>
 #include <netdb.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
+#include <termios.h>
 #include <unistd.h>
 
 #include "zenoh-pico/collections/string.h"
 #include "zenoh-pico/config.h"
+#include "zenoh-pico/system/link/serial.h"
 #include "zenoh-pico/system/platform.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
+#if Z_FEATURE_LINK_TCP == 1 || Z_FEATURE_LINK_UDP_MULTICAST == 1 || Z_FEATURE_LINK_UDP_UNICAST == 1
+#define _Z_SEND_VEC_IOV_MAX 16
+
+// Send the given buffers with a single sendmsg call, to the given address for unconnected sockets
+static size_t __z_send_vec(int fd, const _z_bytes_t *bufs, size_t count, const struct sockaddr *addr,
+                           socklen_t addrlen, int flags) {
+    struct iovec iov[_Z_SEND_VEC_IOV_MAX];
+    if (count > (size_t)_Z_SEND_VEC_IOV_MAX) {
+        return SIZE_MAX;
+    }
+    for (size_t i = 0; i < count; i++) {
+        iov[i].iov_base = (void *)bufs[i].start;
+        iov[i].iov_len = bufs[i].len;
+    }
+
+    struct msghdr msg;
+    (void)memset(&msg, 0, sizeof(msg));
+    msg.msg_name = (void *)addr;
+    msg.msg_namelen = addrlen;
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+    ssize_t wb = sendmsg(fd, &msg, flags);
+    return (wb < 0) ? SIZE_MAX : (size_t)wb;
+}
+#endif
+
 #if Z_FEATURE_LINK_TCP == 1
 
 /*------------------ TCP sockets ------------------*/
@@ -156,6 +189,14 @@ size_t _z_send_tcp(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t le
     return send(sock._fd, ptr, len, 0);
 #endif
 }
+
+size_t _z_send_vec_tcp(const _z_sys_net_socket_t sock, const _z_bytes_t *bufs, size_t count) {
+#if defined(ZENOH_LINUX)
+    return __z_send_vec(sock._fd, bufs, count, NULL, 0, MSG_NOSIGNAL);
+#else
+    return __z_send_vec(sock._fd, bufs, count, NULL, 0, 0);
+#endif
+}
 #endif
 
 #if Z_FEATURE_LINK_UDP_UNICAST == 1 || Z_FEATURE_LINK_UDP_MULTICAST == 1
@@ -251,6 +292,11 @@ size_t _z_send_udp_unicast(const _z_sys_net_socket_t sock, const uint8_t *ptr, s
                            const _z_sys_net_endpoint_t rep) {
     return sendto(sock._fd, ptr, len, 0, rep._iptcp->ai_addr, rep._iptcp->ai_addrlen);
 }
+
+size_t _z_send_vec_udp_unicast(const _z_sys_net_socket_t sock, const _z_bytes_t *bufs, size_t count,
+                               const _z_sys_net_endpoint_t rep) {
+    return __z_send_vec(sock._fd, bufs, count, rep._iptcp->ai_addr, rep._iptcp->ai_addrlen, 0);
+}
 #endif
 
 #if Z_FEATURE_LINK_UDP_MULTICAST == 1
@@ -336,7 +382,8 @@ int8_t _z_open_udp_multicast(_z_sys_net_socket_t *sock, const _z_sys_net_endpoin
 
             // Create lep endpoint
             if (ret == _Z_RES_OK) {
-                struct addrinfo *laddr = (struct addrinfo *)z_malloc(sizeof(struct addrinfo));
+                // Released by freeaddrinfo like the endpoints from getaddrinfo, so it must come from libc
+                struct addrinfo *laddr = (struct addrinfo *)malloc(sizeof(struct addrinfo));
                 if (laddr != NULL) {
                     laddr->ai_flags = 0;
                     laddr->ai_family = rep._iptcp->ai_family;
@@ -526,8 +573,7 @@ size_t _z_read_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_
             struct sockaddr_in *b = ((struct sockaddr_in *)&raddr);
             if (!((a->sin_port == b->sin_port) && (a->sin_addr.s_addr == b->sin_addr.s_addr))) {
                 // If addr is not NULL, it means that the rep was requested by the upper-layers
-                if (addr != NULL) {
-                    *addr = _z_bytes_make(sizeof(in_addr_t) + sizeof(in_port_t));
+                if ((addr != NULL) && (_z_bytes_reserve(addr, sizeof(in_addr_t) + sizeof(in_port_t)) == _Z_RES_OK)) {
                     (void)memcpy((uint8_t *)addr->start, &b->sin_addr.s_addr, sizeof(in_addr_t));
                     (void)memcpy((uint8_t *)(addr->start + sizeof(in_addr_t)), &b->sin_port, sizeof(in_port_t));
                 }
@@ -539,8 +585,8 @@ size_t _z_read_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_
             if (!((a->sin6_port == b->sin6_port) &&
                   (memcmp(a->sin6_addr.s6_addr, b->sin6_addr.s6_addr, sizeof(struct in6_addr)) == 0))) {
                 // If addr is not NULL, it means that the rep was requested by the upper-layers
-                if (addr != NULL) {
-                    *addr = _z_bytes_make(sizeof(struct in6_addr) + sizeof(in_port_t));
+                if ((addr != NULL) &&
+                    (_z_bytes_reserve(addr, sizeof(struct in6_addr) + sizeof(in_port_t)) == _Z_RES_OK)) {
                     (void)memcpy((uint8_t *)addr->start, &b->sin6_addr.s6_addr, sizeof(struct in6_addr));
                     (void)memcpy((uint8_t *)(addr->start + sizeof(struct in6_addr)), &b->sin6_port, sizeof(in_port_t));
                 }
@@ -578,6 +624,11 @@ size_t _z_send_udp_multicast(const _z_sys_net_socket_t sock, const uint8_t *ptr,
     return sendto(sock._fd, ptr, len, 0, rep._iptcp->ai_addr, rep._iptcp->ai_addrlen);
 }
 
+size_t _z_send_vec_udp_multicast(const _z_sys_net_socket_t sock, const _z_bytes_t *bufs, size_t count,
+                                 const _z_sys_net_endpoint_t rep) {
+    return __z_send_vec(sock._fd, bufs, count, rep._iptcp->ai_addr, rep._iptcp->ai_addrlen, 0);
+}
+
 #endif
 
 #if Z_FEATURE_LINK_BLUETOOTH == 1
@@ -585,5 +636,141 @@ size_t _z_send_udp_multicast(const _z_sys_net_socket_t sock, const uint8_t *ptr,
 #endif
 
 #if Z_FEATURE_LINK_SERIAL == 1
-#error "Serial not supported yet on Unix port of Zenoh-Pico"
+/*------------------ Serial sockets ------------------*/
+static int8_t __z_serial_speed(uint32_t baudrate, speed_t *speed) {
+    int8_t ret = _Z_RES_OK;
+    switch (baudrate) {
+        case 9600:
+            *speed = B9600;
+            break;
+        case 19200:
+            *speed = B19200;
+            break;
+        case 38400:
+            *speed = B38400;
+            break;
+        case 57600:
+            *speed = B57600;
+            break;
+        case 115200:
+            *speed = B115200;
+            break;
+#ifdef B230400
+        case 230400:
+            *speed = B230400;
+            break;
+#endif
+#ifdef B460800
+        case 460800:
+            *speed = B460800;
+            break;
+#endif
+#ifdef B921600
+        case 921600:
+            *speed = B921600;
+            break;
+#endif
+#ifdef B1000000
+        case 1000000:
+            *speed = B1000000;
+            break;
+#endif
+        default:
+            ret = _Z_ERR_CONFIG_LOCATOR_INVALID;
+            break;
+    }
+    return ret;
+}
+
+int8_t _z_open_serial_from_pins(_z_sys_net_socket_t *sock, uint32_t txpin, uint32_t rxpin, uint32_t baudrate) {
+    (void)(sock);
+    (void)(txpin);
+    (void)(rxpin);
+    (void)(baudrate);
+
+    // Pins are not addressable on Unix, serial ports are opened from their device
+    return _Z_ERR_GENERIC;
+}
+
+int8_t _z_open_serial_from_dev(_z_sys_net_socket_t *sock, char *dev, uint32_t baudrate) {
+    speed_t speed = B0;
+    int8_t ret = __z_serial_speed(baudrate, &speed);
+    if (ret != _Z_RES_OK) {
+        return ret;
+    }
+
+    sock->_fd = open(dev, O_RDWR | O_NOCTTY);
+    if (sock->_fd == -1) {
+        return _Z_ERR_GENERIC;
+    }
+
+    struct termios tty;
+    if (tcgetattr(sock->_fd, &tty) != 0) {
+        ret = _Z_ERR_GENERIC;
+    }
+    if (ret == _Z_RES_OK) {
+        // Raw 8N1 without flow control, the defaults in Zenoh Rust
+        tty.c_iflag &= ~(tcflag_t)(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON | IXOFF | IXANY);
+        tty.c_oflag &= ~(tcflag_t)OPOST;
+        tty.c_lflag &= ~(tcflag_t)(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+        tty.c_cflag &= ~(tcflag_t)(CSIZE | PARENB | CSTOPB);
+        tty.c_cflag |= (tcflag_t)(CS8 | CLOCAL | CREAD);
+        // Reads return the bytes already received, the wait for some is done with poll
+        tty.c_cc[VMIN] = 0;
+        tty.c_cc[VTIME] = 0;
+        if ((cfsetispeed(&tty, speed) != 0) || (cfsetospeed(&tty, speed) != 0) ||
+            (tcsetattr(sock->_fd, TCSANOW, &tty) != 0) || (tcflush(sock->_fd, TCIOFLUSH) != 0)) {
+            ret = _Z_ERR_GENERIC;
+        }
+    }
+
+    if (ret != _Z_RES_OK) {
+        close(sock->_fd);
+        sock->_fd = -1;
+    }
+    return ret;
+}
+
+int8_t _z_listen_serial_from_pins(_z_sys_net_socket_t *sock, uint32_t txpin, uint32_t rxpin, uint32_t baudrate) {
+    return _z_open_serial_from_pins(sock, txpin, rxpin, baudrate);
+}
+
+// A serial port is point to point: listening on it is opening it
+int8_t _z_listen_serial_from_dev(_z_sys_net_socket_t *sock, char *dev, uint32_t baudrate) {
+    return _z_open_serial_from_dev(sock, dev, baudrate);
+}
+
+void _z_close_serial(_z_sys_net_socket_t *sock) {
+    if (sock->_fd >= 0) {
+        close(sock->_fd);
+        sock->_fd = -1;
+    }
+}
+
+size_t _z_read_serial_internal(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    struct pollfd pfd = {.fd = sock._fd, .events = POLLIN, .revents = 0};
+    if (poll(&pfd, 1, Z_CONFIG_SOCKET_TIMEOUT) <= 0) {
+        return SIZE_MAX;
+    }
+    ssize_t rb = read(sock._fd, ptr, len);
+    if (rb <= 0) {
+        return SIZE_MAX;
+    }
+    return (size_t)rb;
+}
+
+size_t _z_send_serial_internal(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len) {
+    size_t n = 0;
+    while (n < len) {
+        ssize_t wb = write(sock._fd, &ptr[n], len - n);
+        if (wb < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return SIZE_MAX;
+        }
+        n = n + (size_t)wb;
+    }
+    return len;
+}
 #endif
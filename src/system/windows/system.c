@@ -50,13 +50,15 @@ uint64_t z_random_u64(void) {
 void z_random_fill(void *buf, size_t len) { RtlGenRandom(buf, (unsigned long)len); }
 
 /*------------------ Memory ------------------*/
+#if Z_FEATURE_MEMORY_POOLS == 0  // Otherwise served by the memory pools
 // #define MALLOC(x) HeapAlloc(GetProcessHeap(), 0, (x))
 // #define FREE(x) HeapFree(GetProcessHeap(), 0, (x))
-void *z_malloc(size_t size) { return malloc(size); }
+void *_z_platform_malloc(size_t size) { return malloc(size); }
 
-void *z_realloc(void *ptr, size_t size) { return realloc(ptr, size); }
+void *_z_platform_realloc(void *ptr, size_t size) { return realloc(ptr, size); }
 
-void z_free(void *ptr) { free(ptr); }
+void _z_platform_free(void *ptr) { free(ptr); }
+#endif  // Z_FEATURE_MEMORY_POOLS == 0
 
 #if Z_FEATURE_MULTI_THREAD == 1
 /*------------------ Task ------------------*/
@@ -146,6 +148,12 @@ int8_t z_condvar_wait(z_condvar_t *cv, z_mutex_t *m) {
     SleepConditionVariableSRW(cv, m, INFINITE, 0);
     return ret;
 }
+
+int8_t z_condvar_wait_for(z_condvar_t *cv, z_mutex_t *m, uint32_t time_ms) {
+    int8_t ret = _Z_RES_OK;
+    SleepConditionVariableSRW(cv, m, (DWORD)time_ms, 0);
+    return ret;
+}
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
 /*------------------ Sleep ------------------*/
@@ -20,6 +20,7 @@
 #include <zephyr/random/random.h>
 #endif
 
+#include <errno.h>
 #include <stddef.h>
 #include <sys/time.h>
 #include <unistd.h>
@@ -46,14 +47,16 @@ uint64_t z_random_u64(void) {
 void z_random_fill(void *buf, size_t len) { sys_rand_get(buf, len); }
 
 /*------------------ Memory ------------------*/
-void *z_malloc(size_t size) { return k_malloc(size); }
+#if Z_FEATURE_MEMORY_POOLS == 0  // Otherwise served by the memory pools
+void *_z_platform_malloc(size_t size) { return k_malloc(size); }
 
-void *z_realloc(void *ptr, size_t size) {
+void *_z_platform_realloc(void *ptr, size_t size) {
     // k_realloc not implemented in Zephyr
     return NULL;
 }
 
-void z_free(void *ptr) { k_free(ptr); }
+void _z_platform_free(void *ptr) { k_free(ptr); }
+#endif  // Z_FEATURE_MEMORY_POOLS == 0
 
 #if Z_FEATURE_MULTI_THREAD == 1
 
@@ -112,6 +115,20 @@ int8_t z_condvar_free(z_condvar_t *cv) { return pthread_cond_destroy(cv); }
 int8_t z_condvar_signal(z_condvar_t *cv) { return pthread_cond_signal(cv); }
 
 int8_t z_condvar_wait(z_condvar_t *cv, z_mutex_t *m) { return pthread_cond_wait(cv, m); }
+
+int8_t z_condvar_wait_for(z_condvar_t *cv, z_mutex_t *m, uint32_t time_ms) {
+    // The condition variables wait until a deadline of the default clock, i.e. the real-time one
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(time_ms / (uint32_t)1000);
+    deadline.tv_nsec += (long)(time_ms % (uint32_t)1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    int ret = pthread_cond_timedwait(cv, m, &deadline);
+    return (ret == ETIMEDOUT) ? (int8_t)0 : (int8_t)ret;
+}
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
 /*------------------ Sleep ------------------*/
@@ -16,6 +16,7 @@
 
 #include "zenoh-pico/api/constants.h"
 #include "zenoh-pico/protocol/codec/core.h"
+#include "zenoh-pico/protocol/codec/network.h"
 #include "zenoh-pico/protocol/codec/transport.h"
 #include "zenoh-pico/protocol/definitions/transport.h"
 #include "zenoh-pico/transport/multicast/tx.h"
@@ -69,6 +70,10 @@ void __unsafe_z_finalize_wbuf(_z_wbuf_t *buf, uint8_t link_flow_capability) {
     }
 }
 
+int8_t _z_write_n_msg(_z_wbuf_t *wbf, const _z_network_message_t *n_msg, const _z_bytes_t *encoded) {
+    return (encoded != NULL) ? _z_bytes_val_encode(wbf, encoded) : _z_network_message_encode(wbf, n_msg);
+}
+
 int8_t _z_send_t_msg(_z_transport_t *zt, const _z_transport_message_t *t_msg) {
     int8_t ret = _Z_RES_OK;
     switch (zt->_type) {
@@ -134,7 +139,12 @@ int8_t _z_link_send_t_msg(const _z_link_t *zl, const _z_transport_message_t *t_m
     return ret;
 }
 
-int8_t __unsafe_z_serialize_zenoh_fragment(_z_wbuf_t *dst, _z_wbuf_t *src, z_reliability_t reliability, size_t sn) {
+/**
+ * Serialize the next fragment of src on dst. With alias_payload, the fragment payload is not copied: dst gets the
+ * fragment header followed by ioslices aliasing src, which must then be sent before src is released or dst is reset.
+ */
+int8_t __unsafe_z_serialize_zenoh_fragment(_z_wbuf_t *dst, _z_wbuf_t *src, z_reliability_t reliability, size_t sn,
+                                           _Bool alias_payload) {
     int8_t ret = _Z_RES_OK;
 
     // Assume first that this is not the final fragment
@@ -156,7 +166,11 @@ int8_t __unsafe_z_serialize_zenoh_fragment(_z_wbuf_t *dst, _z_wbuf_t *src, z_rel
             }
 
             size_t to_copy = (bytes_left <= space_left) ? bytes_left : space_left;  // Compute bytes to write
-            ret = _z_wbuf_siphon(dst, src, to_copy);                                // Write the fragment
+            if (alias_payload == true) {
+                ret = _z_wbuf_siphon_view(dst, src, to_copy);  // Alias the fragment
+            } else {
+                ret = _z_wbuf_siphon(dst, src, to_copy);  // Write the fragment
+            }
         }
         break;
     } while (1);
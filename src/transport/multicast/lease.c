@@ -19,44 +19,11 @@
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/session/utils.h"
 #include "zenoh-pico/transport/common/lease.h"
+#include "zenoh-pico/transport/multicast/transport.h"
 #include "zenoh-pico/utils/logging.h"
 
 #if Z_FEATURE_MULTICAST_TRANSPORT == 1 || Z_FEATURE_RAWETH_TRANSPORT == 1
 
-static _z_zint_t _z_get_minimum_lease(_z_transport_peer_entry_list_t *peers, _z_zint_t local_lease) {
-    _z_zint_t ret = local_lease;
-
-    _z_transport_peer_entry_list_t *it = peers;
-    while (it != NULL) {
-        _z_transport_peer_entry_t *val = _z_transport_peer_entry_list_head(it);
-        _z_zint_t lease = val->_lease;
-        if (lease < ret) {
-            ret = lease;
-        }
-
-        it = _z_transport_peer_entry_list_tail(it);
-    }
-
-    return ret;
-}
-
-static _z_zint_t _z_get_next_lease(_z_transport_peer_entry_list_t *peers) {
-    _z_zint_t ret = SIZE_MAX;
-
-    _z_transport_peer_entry_list_t *it = peers;
-    while (it != NULL) {
-        _z_transport_peer_entry_t *val = _z_transport_peer_entry_list_head(it);
-        _z_zint_t next_lease = val->_next_lease;
-        if (next_lease < ret) {
-            ret = next_lease;
-        }
-
-        it = _z_transport_peer_entry_list_tail(it);
-    }
-
-    return ret;
-}
-
 int8_t _zp_multicast_send_join(_z_transport_multicast_t *ztm) {
     _z_conduit_sn_list_t next_sn;
     next_sn._is_qos = false;
@@ -92,42 +59,41 @@ void *_zp_multicast_lease_task(void *ztm_arg) {
     _z_transport_multicast_t *ztm = (_z_transport_multicast_t *)ztm_arg;
     ztm->_transmitted = false;
 
-    // From all peers, get the next lease time (minimum)
-    _z_zint_t next_lease = _z_get_minimum_lease(ztm->_peers, ztm->_lease);
-    _z_zint_t next_keep_alive = (_z_zint_t)(next_lease / Z_TRANSPORT_LEASE_EXPIRE_FACTOR);
-    _z_zint_t next_join = Z_JOIN_INTERVAL;
+    // Deadlines are absolute, in ms on the transport lease clock
+    z_mutex_lock(&ztm->_mutex_peer);
+    uint64_t now = _z_multicast_lease_now(ztm);
+    uint64_t next_keep_alive = now + (ztm->_min_lease / Z_TRANSPORT_LEASE_EXPIRE_FACTOR);
+    uint64_t next_join = now + Z_JOIN_INTERVAL;
+    z_mutex_unlock(&ztm->_mutex_peer);
 
-    _z_transport_peer_entry_list_t *it = NULL;
     while (ztm->_lease_task_running == true) {
         z_mutex_lock(&ztm->_mutex_peer);
-
-        if (next_lease <= 0) {
-            it = ztm->_peers;
-            while (it != NULL) {
-                _z_transport_peer_entry_t *entry = _z_transport_peer_entry_list_head(it);
-                if (entry->_received == true) {
-                    // Reset the lease parameters
-                    entry->_received = false;
-                    entry->_next_lease = entry->_lease;
-                    it = _z_transport_peer_entry_list_tail(it);
-                } else {
-                    _Z_INFO("Remove peer from know list because it has expired after %zums", entry->_lease);
-                    ztm->_peers =
-                        _z_transport_peer_entry_list_drop_filter(ztm->_peers, _z_transport_peer_entry_eq, entry);
-                    it = ztm->_peers;
-                }
+        now = _z_multicast_lease_now(ztm);
+
+        // Only visit the peers whose lease is due, the earliest deadline is at the top of the heap
+        _z_transport_peer_entry_t *entry = _z_transport_peer_lease_heap_top(&ztm->_peer_leases);
+        while ((entry != NULL) && (entry->_lease_deadline <= now)) {
+            if (entry->_received == true) {
+                // Renew the lease
+                entry->_received = false;
+                entry->_lease_deadline = now + entry->_lease;
+                _z_transport_peer_lease_heap_update(&ztm->_peer_leases, entry);
+            } else {
+                _Z_INFO("Remove peer from know list because it has expired after %zums", entry->_lease);
+                _z_multicast_peer_drop(ztm, entry);
             }
+            entry = _z_transport_peer_lease_heap_top(&ztm->_peer_leases);
         }
 
-        if (next_join <= 0) {
+        if (next_join <= now) {
             _zp_multicast_send_join(ztm);
             ztm->_transmitted = true;
 
             // Reset the join parameters
-            next_join = Z_JOIN_INTERVAL;
+            next_join = now + Z_JOIN_INTERVAL;
         }
 
-        if (next_keep_alive <= 0) {
+        if (next_keep_alive <= now) {
             // Check if need to send a keep alive
             if (ztm->_transmitted == false) {
                 if (_zp_multicast_send_keep_alive(ztm) < 0) {
@@ -137,46 +103,18 @@ void *_zp_multicast_lease_task(void *ztm_arg) {
 
             // Reset the keep alive parameters
             ztm->_transmitted = false;
-            next_keep_alive =
-                (_z_zint_t)(_z_get_minimum_lease(ztm->_peers, ztm->_lease) / Z_TRANSPORT_LEASE_EXPIRE_FACTOR);
+            next_keep_alive = now + (ztm->_min_lease / Z_TRANSPORT_LEASE_EXPIRE_FACTOR);
         }
 
-        // Compute the target interval to sleep
-        _z_zint_t interval;
-        if (next_lease > 0) {
-            interval = next_lease;
-            if (next_keep_alive < interval) {
-                interval = next_keep_alive;
-            }
-            if (next_join < interval) {
-                interval = next_join;
-            }
-        } else {
-            interval = next_keep_alive;
-            if (next_join < interval) {
-                interval = next_join;
-            }
+        // Sleep until the next deadline
+        uint64_t wake = (next_join < next_keep_alive) ? next_join : next_keep_alive;
+        if ((entry != NULL) && (entry->_lease_deadline < wake)) {
+            wake = entry->_lease_deadline;
         }
 
         z_mutex_unlock(&ztm->_mutex_peer);
 
-        // The keep alive and lease intervals are expressed in milliseconds
-        z_sleep_ms(interval);
-
-        // Decrement all intervals
-        z_mutex_lock(&ztm->_mutex_peer);
-
-        it = ztm->_peers;
-        while (it != NULL) {
-            _z_transport_peer_entry_t *entry = _z_transport_peer_entry_list_head(it);
-            entry->_next_lease = entry->_next_lease - interval;
-            it = _z_transport_peer_entry_list_tail(it);
-        }
-        next_lease = _z_get_next_lease(ztm->_peers);
-        next_keep_alive = next_keep_alive - interval;
-        next_join = next_join - interval;
-
-        z_mutex_unlock(&ztm->_mutex_peer);
+        z_sleep_ms((size_t)(wake - now));
     }
     return 0;
 }
@@ -15,6 +15,7 @@
 #include "zenoh-pico/transport/multicast/read.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/protocol/codec/transport.h"
@@ -28,13 +29,16 @@
 int8_t _zp_multicast_read(_z_transport_multicast_t *ztm) {
     int8_t ret = _Z_RES_OK;
 
-    _z_bytes_t addr;
+    uint8_t addr_buf[_Z_TRANSPORT_PEER_ADDR_MAX_LEN];
+    (void)memset(addr_buf, 0, sizeof(addr_buf));
+    _z_bytes_t addr = _z_bytes_wrap(addr_buf, sizeof(addr_buf));
     _z_transport_message_t t_msg;
     ret = _z_multicast_recv_t_msg(ztm, &t_msg, &addr);
     if (ret == _Z_RES_OK) {
         ret = _z_multicast_handle_transport_message(ztm, &t_msg, &addr);
         _z_t_msg_clear(&t_msg);
     }
+    _z_bytes_clear(&addr);
 
     return ret;
 }
@@ -56,8 +60,15 @@ void *_zp_multicast_read_task(void *ztm_arg) {
     // Prepare the buffer
     _z_zbuf_reset(&ztm->_zbuf);
 
+    // The source address of each batch is written to a reused scratch buffer
+    uint8_t addr_buf[_Z_TRANSPORT_PEER_ADDR_MAX_LEN];
     _z_bytes_t addr = _z_bytes_wrap(NULL, 0);
     while (ztm->_read_task_running == true) {
+        _z_bytes_clear(&addr);
+        // Links that do not report the sender leave it zeroed rather than what the previous batch held
+        (void)memset(addr_buf, 0, sizeof(addr_buf));
+        addr = _z_bytes_wrap(addr_buf, sizeof(addr_buf));
+
         // Read bytes from socket to the main buffer
         size_t to_read = 0;
 
@@ -109,7 +120,6 @@ void *_zp_multicast_read_task(void *ztm_arg) {
 
                 if (ret == _Z_RES_OK) {
                     _z_t_msg_clear(&t_msg);
-                    _z_bytes_clear(&addr);
                 } else {
                     ztm->_read_task_running = false;
                     continue;
@@ -124,6 +134,7 @@ void *_zp_multicast_read_task(void *ztm_arg) {
         // Move the read position of the read buffer
         _z_zbuf_set_rpos(&ztm->_zbuf, _z_zbuf_get_rpos(&ztm->_zbuf) + to_read);
     }
+    _z_bytes_clear(&addr);
     z_mutex_unlock(&ztm->_mutex_rx);
     return NULL;
 }
@@ -23,7 +23,10 @@
 #include "zenoh-pico/protocol/definitions/network.h"
 #include "zenoh-pico/protocol/definitions/transport.h"
 #include "zenoh-pico/protocol/iobuf.h"
+#include "zenoh-pico/session/interest.h"
 #include "zenoh-pico/session/utils.h"
+#include "zenoh-pico/transport/multicast/lease.h"
+#include "zenoh-pico/transport/multicast/transport.h"
 #include "zenoh-pico/transport/utils.h"
 #include "zenoh-pico/utils/logging.h"
 
@@ -102,24 +105,6 @@ int8_t _z_multicast_recv_t_msg(_z_transport_multicast_t *ztm, _z_transport_messa
 
 #if Z_FEATURE_MULTICAST_TRANSPORT == 1 || Z_FEATURE_RAWETH_TRANSPORT == 1
 
-static _z_transport_peer_entry_t *_z_find_peer_entry(_z_transport_peer_entry_list_t *l, _z_bytes_t *remote_addr) {
-    _z_transport_peer_entry_t *ret = NULL;
-
-    _z_transport_peer_entry_list_t *xs = l;
-    for (; xs != NULL; xs = _z_transport_peer_entry_list_tail(xs)) {
-        _z_transport_peer_entry_t *val = _z_transport_peer_entry_list_head(xs);
-        if (val->_remote_addr.len != remote_addr->len) {
-            continue;
-        }
-
-        if (memcmp(val->_remote_addr.start, remote_addr->start, remote_addr->len) == 0) {
-            ret = val;
-        }
-    }
-
-    return ret;
-}
-
 int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_transport_message_t *t_msg,
                                              _z_bytes_t *addr) {
     int8_t ret = _Z_RES_OK;
@@ -129,7 +114,7 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
     // Mark the session that we have received data from this peer
-    _z_transport_peer_entry_t *entry = _z_find_peer_entry(ztm->_peers, addr);
+    _z_transport_peer_entry_t *entry = _z_transport_peer_index_get(&ztm->_peer_index, addr);
     switch (_Z_MID(t_msg->_header)) {
         case _Z_MID_T_FRAME: {
             _Z_INFO("Received _Z_FRAME message");
@@ -147,7 +132,7 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
                     entry->_sn_rx_sns._val._plain._reliable = t_msg->_body._frame._sn;
                 } else {
 #if Z_FEATURE_FRAGMENTATION == 1
-                    _z_wbuf_clear(&entry->_dbuf_reliable);
+                    _z_defrag_buf_reset(&entry->_dbuf_reliable);
 #endif
                     _Z_INFO("Reliable message dropped because it is out of order");
                     break;
@@ -158,20 +143,27 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
                     entry->_sn_rx_sns._val._plain._best_effort = t_msg->_body._frame._sn;
                 } else {
 #if Z_FEATURE_FRAGMENTATION == 1
-                    _z_wbuf_clear(&entry->_dbuf_best_effort);
+                    _z_defrag_buf_reset(&entry->_dbuf_best_effort);
 #endif
                     _Z_INFO("Best effort message dropped because it is out of order");
                     break;
                 }
             }
 
-            // Handle all the zenoh message, one by one
+            // Handle all the zenoh message, one by one, as they are decoded
             uint16_t mapping = entry->_peer_id;
-            size_t len = _z_vec_len(&t_msg->_body._frame._messages);
-            for (size_t i = 0; i < len; i++) {
-                _z_network_message_t *zm = _z_network_message_vec_get(&t_msg->_body._frame._messages, i);
-                _z_msg_fix_mapping(zm, mapping);
-                _z_handle_network_message(ztm->_session, zm, mapping);
+            while (_z_zbuf_len(&t_msg->_body._frame._payload) > (size_t)0) {
+                _z_zenoh_message_t zm;
+                ret = _z_frame_decode_message(&t_msg->_body._frame, &zm);
+                if (ret != _Z_RES_OK) {
+                    break;
+                }
+                _z_msg_fix_mapping(&zm, mapping);
+                _z_handle_network_message(ztm->_session, &zm, mapping);
+                _z_msg_clear(&zm);
+            }
+            if (ret == _Z_ERR_MESSAGE_ZENOH_UNKNOWN) {
+                ret = _Z_RES_OK;  // The unknown messages are skipped
             }
 
             break;
@@ -185,31 +177,25 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
             }
             entry->_received = true;
 
-            _z_wbuf_t *dbuf = _Z_HAS_FLAG(t_msg->_header, _Z_FLAG_T_FRAGMENT_R)
-                                  ? &entry->_dbuf_reliable
-                                  : &entry->_dbuf_best_effort;  // Select the right defragmentation buffer
+            _z_defrag_buf_t *dbuf = _Z_HAS_FLAG(t_msg->_header, _Z_FLAG_T_FRAGMENT_R)
+                                        ? &entry->_dbuf_reliable
+                                        : &entry->_dbuf_best_effort;  // Select the right defragmentation buffer
 
-            _Bool drop = false;
-            if ((_z_wbuf_len(dbuf) + t_msg->_body._fragment._payload.len) > Z_FRAG_MAX_SIZE) {
-                // Filling the wbuf capacity as a way to signaling the last fragment to reset the dbuf
-                // Otherwise, last (smaller) fragments can be understood as a complete message
-                _z_wbuf_write_bytes(dbuf, t_msg->_body._fragment._payload.start, 0, _z_wbuf_space_left(dbuf));
-                drop = true;
-            } else {
-                _z_wbuf_write_bytes(dbuf, t_msg->_body._fragment._payload.start, 0,
-                                    t_msg->_body._fragment._payload.len);
+            // The fragment is copied straight from the read buffer, a message exceeding Z_FRAG_MAX_SIZE is flagged
+            // so that its remaining fragments are discarded
+            if (_z_defrag_buf_push(dbuf, &t_msg->_body._fragment._payload) != _Z_RES_OK) {
+                _Z_INFO("Fragment dropped because the message exceeds the fragmentation size");
             }
 
             if (_Z_HAS_FLAG(t_msg->_header, _Z_FLAG_T_FRAGMENT_M) == false) {
-                if (drop == true) {  // Drop message if it exceeds the fragmentation size
-                    _z_wbuf_reset(dbuf);
+                if (dbuf->_drop == true) {  // Drop message if it exceeds the fragmentation size
+                    _z_defrag_buf_reset(dbuf);
                     break;
                 }
 
-                _z_zbuf_t zbf = _z_wbuf_to_zbuf(dbuf);  // Convert the defragmentation buffer into a decoding buffer
-
+                // Decode in place, the message borrows the defragmentation buffer until it is cleared
                 _z_zenoh_message_t zm;
-                ret = _z_network_message_decode(&zm, &zbf);
+                ret = _z_network_message_decode(&zm, &dbuf->_buf);
                 if (ret == _Z_RES_OK) {
                     uint16_t mapping = entry->_peer_id;
                     _z_msg_fix_mapping(&zm, mapping);
@@ -218,10 +204,8 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
                                         // zenoh messages are released when their transport message is released.
                 }
 
-                // Free the decoding buffer
-                _z_zbuf_clear(&zbf);
                 // Reset the defragmentation buffer
-                _z_wbuf_reset(dbuf);
+                _z_defrag_buf_reset(dbuf);
             }
 #else
             _Z_INFO("Fragment dropped because fragmentation feature is deactivated");
@@ -257,6 +241,9 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
 
             if (entry == NULL)  // New peer
             {
+#if Z_FEATURE_INTEREST == 1
+                _Bool first_peer = false;
+#endif
                 entry = (_z_transport_peer_entry_t *)z_malloc(sizeof(_z_transport_peer_entry_t));
                 if (entry != NULL) {
                     entry->_sn_res = _z_sn_max(t_msg->_body._join._seq_num_res);
@@ -276,25 +263,38 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
                         _z_conduit_sn_list_decrement(entry->_sn_res, &entry->_sn_rx_sns);
 
 #if Z_FEATURE_FRAGMENTATION == 1
-#if Z_FEATURE_DYNAMIC_MEMORY_ALLOCATION == 1
-                        entry->_dbuf_reliable = _z_wbuf_make(0, true);
-                        entry->_dbuf_best_effort = _z_wbuf_make(0, true);
-#else
-                        entry->_dbuf_reliable = _z_wbuf_make(Z_FRAG_MAX_SIZE, false);
-                        entry->_dbuf_best_effort = _z_wbuf_make(Z_FRAG_MAX_SIZE, false);
-
-                        if ((_z_wbuf_capacity(&entry->_dbuf_reliable) != Z_FRAG_MAX_SIZE) ||
-                            (_z_wbuf_capacity(&entry->_dbuf_best_effort) != Z_FRAG_MAX_SIZE)) {
+                        int8_t ret_reliable = _z_defrag_buf_init(&entry->_dbuf_reliable);
+                        int8_t ret_best_effort = _z_defrag_buf_init(&entry->_dbuf_best_effort);
+                        if ((ret_reliable != _Z_RES_OK) || (ret_best_effort != _Z_RES_OK)) {
                             _Z_ERROR("Not enough memory to allocate peer defragmentation buffers!");
                         }
-#endif
 #endif
                         // Update lease time (set as ms during)
                         entry->_lease = t_msg->_body._join._lease;
-                        entry->_next_lease = entry->_lease;
                         entry->_received = true;
 
-                        ztm->_peers = _z_transport_peer_entry_list_insert(ztm->_peers, entry);
+#if Z_FEATURE_INTEREST == 1
+                        first_peer = (ztm->_peers == NULL);
+#endif
+                        ret = _z_multicast_peer_add(ztm, entry);
+                        if (ret != _Z_RES_OK) {
+                            _z_transport_peer_entry_clear(entry);
+                        }
+                    }
+
+                    if (ret == _Z_RES_OK) {
+#if Z_FEATURE_INTEREST == 1
+                        // The new peer drops our messages until it gets our join, announce ourselves right away
+                        _zp_multicast_send_join(ztm);
+                        // Only a node joining a group it had no peer in asks for the subscribers declared before, and
+                        // declares its own ones: the nodes already in the group answer it once instead of answering
+                        // an interest from each of them
+                        if (first_peer == true) {
+                            _z_keyexpr_t all = _z_rname("**");
+                            _z_declare_current_subscribers(ztm->_session);
+                            _z_declare_subscribers_interest(ztm->_session, &all);
+                        }
+#endif
                     } else {
                         z_free(entry);
                     }
@@ -308,8 +308,8 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
                 if ((t_msg->_body._join._seq_num_res != Z_SN_RESOLUTION) ||
                     (t_msg->_body._join._req_id_res != Z_REQ_RESOLUTION) ||
                     (t_msg->_body._join._batch_size != Z_BATCH_MULTICAST_SIZE)) {
-                    _z_transport_peer_entry_list_drop_filter(ztm->_peers, _z_transport_peer_entry_eq, entry);
-                    // TODO: cleanup here should also be done on mappings/subs/etc...
+                    _z_multicast_peer_drop(ztm, entry);
+                    // TODO: cleanup here should also be done on mappings/etc...
                     break;
                 }
 
@@ -317,8 +317,11 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
                 _z_conduit_sn_list_copy(&entry->_sn_rx_sns, &t_msg->_body._join._next_sn);
                 _z_conduit_sn_list_decrement(entry->_sn_res, &entry->_sn_rx_sns);
 
-                // Update lease time (set as ms during)
+                // Update lease time (set as ms during), it applies from the next renewal on
                 entry->_lease = t_msg->_body._join._lease;
+                if (entry->_lease < ztm->_min_lease) {
+                    ztm->_min_lease = entry->_lease;
+                }
             }
             break;
         }
@@ -329,7 +332,7 @@ int8_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_t
             if (entry == NULL) {
                 break;
             }
-            ztm->_peers = _z_transport_peer_entry_list_drop_filter(ztm->_peers, _z_transport_peer_entry_eq, entry);
+            _z_multicast_peer_drop(ztm, entry);
 
             break;
         }
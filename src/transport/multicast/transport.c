@@ -18,6 +18,7 @@
 #include <string.h>
 
 #include "zenoh-pico/link/link.h"
+#include "zenoh-pico/session/interest.h"
 #include "zenoh-pico/transport/common/lease.h"
 #include "zenoh-pico/transport/common/read.h"
 #include "zenoh-pico/transport/common/tx.h"
@@ -57,7 +58,14 @@ int8_t _z_multicast_transport_create(_z_transport_t *zt, _z_link_t *zl,
         ret = z_mutex_init(&ztm->_mutex_rx);
         if (ret == _Z_RES_OK) {
             ret = z_mutex_init(&ztm->_mutex_peer);
-            if (ret != _Z_RES_OK) {
+            if (ret == _Z_RES_OK) {
+                ret = _z_tx_gate_init(&ztm->_gate_tx);
+                if (ret != _Z_RES_OK) {
+                    z_mutex_free(&ztm->_mutex_tx);
+                    z_mutex_free(&ztm->_mutex_rx);
+                    z_mutex_free(&ztm->_mutex_peer);
+                }
+            } else {
                 z_mutex_free(&ztm->_mutex_tx);
                 z_mutex_free(&ztm->_mutex_rx);
             }
@@ -82,6 +90,7 @@ int8_t _z_multicast_transport_create(_z_transport_t *zt, _z_link_t *zl,
             z_mutex_free(&ztm->_mutex_tx);
             z_mutex_free(&ztm->_mutex_rx);
             z_mutex_free(&ztm->_mutex_peer);
+            _z_tx_gate_clear(&ztm->_gate_tx);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
             _z_wbuf_clear(&ztm->_wbuf);
@@ -99,6 +108,8 @@ int8_t _z_multicast_transport_create(_z_transport_t *zt, _z_link_t *zl,
 
         // Initialize peer list
         ztm->_peers = _z_transport_peer_entry_list_new();
+        _z_transport_peer_index_init(&ztm->_peer_index);
+        _z_transport_peer_lease_heap_init(&ztm->_peer_leases);
 
 #if Z_FEATURE_MULTI_THREAD == 1
         // Tasks
@@ -106,9 +117,19 @@ int8_t _z_multicast_transport_create(_z_transport_t *zt, _z_link_t *zl,
         ztm->_read_task = NULL;
         ztm->_lease_task_running = false;
         ztm->_lease_task = NULL;
+        ztm->_tx_task_running = false;
+        ztm->_tx_task = NULL;
+        ztm->_tx_queue = NULL;
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_FRAGMENTATION == 1 && Z_FEATURE_TX_PREEMPTION == 1
+        ztm->_frag_suspended_reliable = NULL;
+        ztm->_frag_suspended_best_effort = NULL;
+#endif
+
         ztm->_lease = Z_TRANSPORT_LEASE;
+        ztm->_min_lease = ztm->_lease;
+        ztm->_lease_clock = z_clock_now();
 
         // Notifiers
         ztm->_transmitted = false;
@@ -191,10 +212,17 @@ void _z_multicast_transport_clear(_z_transport_t *zt) {
         z_task_join(ztm->_lease_task);
         z_task_free(&ztm->_lease_task);
     }
+    if (ztm->_tx_task != NULL) {
+        _zp_multicast_stop_tx_task(ztm);
+        z_task_join(ztm->_tx_task);
+        z_task_free(&ztm->_tx_task);
+    }
+    _z_tx_queue_free(&ztm->_tx_queue);
     // Clean up the mutexes
     z_mutex_free(&ztm->_mutex_tx);
     z_mutex_free(&ztm->_mutex_rx);
     z_mutex_free(&ztm->_mutex_peer);
+    _z_tx_gate_clear(&ztm->_gate_tx);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
     // Clean up the buffers
@@ -202,10 +230,51 @@ void _z_multicast_transport_clear(_z_transport_t *zt) {
     _z_zbuf_clear(&ztm->_zbuf);
 
     // Clean up peer list
+    _z_transport_peer_index_init(&ztm->_peer_index);
+    _z_transport_peer_lease_heap_clear(&ztm->_peer_leases);
     _z_transport_peer_entry_list_free(&ztm->_peers);
     _z_link_clear(&ztm->_link);
 }
 
+uint64_t _z_multicast_lease_now(_z_transport_multicast_t *ztm) {
+    return (uint64_t)z_clock_elapsed_ms(&ztm->_lease_clock);
+}
+
+int8_t _z_multicast_peer_add(_z_transport_multicast_t *ztm, _z_transport_peer_entry_t *entry) {
+    entry->_lease_deadline = _z_multicast_lease_now(ztm) + entry->_lease;
+    int8_t ret = _z_transport_peer_lease_heap_push(&ztm->_peer_leases, entry);
+    if (ret == _Z_RES_OK) {
+        ztm->_peers = _z_transport_peer_entry_list_insert(ztm->_peers, entry);
+        _z_transport_peer_index_add(&ztm->_peer_index, entry);
+        if (entry->_lease < ztm->_min_lease) {
+            ztm->_min_lease = entry->_lease;
+        }
+    }
+    return ret;
+}
+
+static _Bool _z_multicast_peer_is(const _z_transport_peer_entry_t *left, const _z_transport_peer_entry_t *right) {
+    return left == right;
+}
+
+void _z_multicast_peer_drop(_z_transport_multicast_t *ztm, _z_transport_peer_entry_t *entry) {
+#if Z_FEATURE_INTEREST == 1
+    _z_unregister_remote_subscribers_for_peer(ztm->_session, entry->_peer_id);
+#endif
+    _z_transport_peer_index_remove(&ztm->_peer_index, entry);
+    _z_transport_peer_lease_heap_remove(&ztm->_peer_leases, entry);
+    ztm->_peers = _z_transport_peer_entry_list_drop_filter(ztm->_peers, _z_multicast_peer_is, entry);
+
+    // Peers leave rarely, recompute the smallest lease from the remaining ones
+    ztm->_min_lease = ztm->_lease;
+    for (_z_transport_peer_entry_list_t *it = ztm->_peers; it != NULL; it = _z_transport_peer_entry_list_tail(it)) {
+        _z_zint_t lease = _z_transport_peer_entry_list_head(it)->_lease;
+        if (lease < ztm->_min_lease) {
+            ztm->_min_lease = lease;
+        }
+    }
+}
+
 #else
 
 int8_t _z_multicast_transport_create(_z_transport_t *zt, _z_link_t *zl,
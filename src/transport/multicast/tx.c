@@ -71,22 +71,229 @@ int8_t _z_multicast_send_t_msg(_z_transport_multicast_t *ztm, const _z_transport
     return ret;
 }
 
+#if Z_FEATURE_FRAGMENTATION == 1
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_TX_PREEMPTION == 1
+/**
+ * Let the waiting messages of a higher priority be sent before the next fragment of a message. The fragmentation buffer
+ * is left on the transport meanwhile, so that a message that needs to be fragmented on the same channel first sends
+ * the remaining fragments: a channel can only carry the fragments of one message at a time.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztm->_mutex_tx
+ */
+static void __unsafe_z_multicast_yield_fragments(_z_transport_multicast_t *ztm, _z_wbuf_t *fbf,
+                                                 z_reliability_t reliability, z_priority_t priority) {
+    _z_wbuf_t **suspended =
+        (reliability == Z_RELIABILITY_RELIABLE) ? &ztm->_frag_suspended_reliable : &ztm->_frag_suspended_best_effort;
+    *suspended = fbf;
+    _z_tx_gate_yield(&ztm->_gate_tx, &ztm->_mutex_tx, priority);
+    if (*suspended == fbf) {
+        *suspended = NULL;  // Otherwise, the message has been completed and another one has been interrupted since
+    }
+}
+
+static int8_t __unsafe_z_multicast_send_fragments(_z_transport_multicast_t *ztm, _z_wbuf_t *fbf,
+                                                  z_reliability_t reliability, z_priority_t priority, _z_zint_t sn);
+
+/**
+ * Send the remaining fragments of a message interrupted on the given channel, if any. `sn` is the sequence number
+ * reserved for the first fragment of the next message, it is taken again after the interrupted message.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztm->_mutex_tx
+ */
+static int8_t __unsafe_z_multicast_resume_fragments(_z_transport_multicast_t *ztm, z_reliability_t reliability,
+                                                    _z_zint_t *sn) {
+    int8_t ret = _Z_RES_OK;
+    _z_wbuf_t **suspended =
+        (reliability == Z_RELIABILITY_RELIABLE) ? &ztm->_frag_suspended_reliable : &ztm->_frag_suspended_best_effort;
+    _z_wbuf_t *fbf = *suspended;
+    if (fbf != NULL) {
+        *suspended = NULL;
+        // Give back the reserved sequence number, no other one has been taken since
+        if (reliability == Z_RELIABILITY_RELIABLE) {
+            ztm->_sn_tx_reliable = *sn;
+        } else {
+            ztm->_sn_tx_best_effort = *sn;
+        }
+        // Nothing preempts the control priority: the interrupted message must be completed before the lock is
+        // released, its owner would otherwise release the fragmentation buffer while it is still being sent
+        ret = __unsafe_z_multicast_send_fragments(ztm, fbf, reliability, _Z_PRIORITY_CONTROL,
+                                                  __unsafe_z_multicast_get_sn(ztm, reliability));
+        *sn = __unsafe_z_multicast_get_sn(ztm, reliability);
+    }
+    return ret;
+}
+#endif
+
+/**
+ * Fragment and send the message encoded in `fbf`, `sn` being the sequence number of the first fragment.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztm->_mutex_tx
+ */
+static int8_t __unsafe_z_multicast_send_fragments(_z_transport_multicast_t *ztm, _z_wbuf_t *fbf,
+                                                  z_reliability_t reliability, z_priority_t priority, _z_zint_t sn) {
+    int8_t ret = _Z_RES_OK;
+    _ZP_UNUSED(priority);
+
+    _Bool is_first = true;
+    while ((ret == _Z_RES_OK) && (_z_wbuf_len(fbf) > 0)) {
+        if (is_first == false) {  // Get the fragment sequence number
+            sn = __unsafe_z_multicast_get_sn(ztm, reliability);
+        }
+        is_first = false;
+
+        // Clear the buffer for serialization
+        __unsafe_z_prepare_wbuf(&ztm->_wbuf, ztm->_link._cap._flow);
+
+        // Serialize one fragment
+        ret = __unsafe_z_serialize_zenoh_fragment(&ztm->_wbuf, fbf, reliability, sn, false);
+        if (ret == _Z_RES_OK) {
+            // Write the message length in the reserved space if needed
+            __unsafe_z_finalize_wbuf(&ztm->_wbuf, ztm->_link._cap._flow);
+
+            ret = _z_link_send_wbuf(&ztm->_link, &ztm->_wbuf);  // Send the wbuf on the socket
+            if (ret == _Z_RES_OK) {
+                ztm->_transmitted = true;  // Mark the session that we have transmitted data
+            }
+        }
+
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_TX_PREEMPTION == 1
+        if ((ret == _Z_RES_OK) && (_z_wbuf_len(fbf) > 0)) {
+            __unsafe_z_multicast_yield_fragments(ztm, fbf, reliability, priority);
+        }
+#endif
+    }
+
+    return ret;
+}
+#endif
+
+/**
+ * Send a network message, given either as is or already encoded.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztm->_mutex_tx
+ */
+static int8_t __unsafe_z_multicast_send_n_msg(_z_transport_multicast_t *ztm, const _z_network_message_t *n_msg,
+                                              const _z_bytes_t *encoded, z_reliability_t reliability,
+                                              z_priority_t priority) {
+    int8_t ret = _Z_RES_OK;
+    _ZP_UNUSED(priority);  // Only used for fragmentation
+
+    // Prepare the buffer eventually reserving space for the message length
+    __unsafe_z_prepare_wbuf(&ztm->_wbuf, ztm->_link._cap._flow);
+
+    _z_zint_t sn = __unsafe_z_multicast_get_sn(ztm, reliability);  // Get the next sequence number
+
+    _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, reliability);
+    ret = _z_transport_message_encode(&ztm->_wbuf, &t_msg);  // Encode the frame header
+    if (ret == _Z_RES_OK) {
+        ret = _z_write_n_msg(&ztm->_wbuf, n_msg, encoded);  // Encode the network message
+        if (ret == _Z_RES_OK) {
+            // Write the message length in the reserved space if needed
+            __unsafe_z_finalize_wbuf(&ztm->_wbuf, ztm->_link._cap._flow);
+
+            ret = _z_link_send_wbuf(&ztm->_link, &ztm->_wbuf);  // Send the wbuf on the socket
+            if (ret == _Z_RES_OK) {
+                ztm->_transmitted = true;  // Mark the session that we have transmitted data
+            }
+        } else {
+#if Z_FEATURE_FRAGMENTATION == 1
+            // The message does not fit in the current batch, let's fragment it
+            // Create an expandable wbuf for fragmentation
+            _z_wbuf_t fbf = _z_wbuf_make(_Z_FRAG_BUFF_BASE_SIZE, true);
+
+            ret = _z_write_n_msg(&fbf, n_msg, encoded);  // Encode the message on the expandable wbuf
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_TX_PREEMPTION == 1
+            if (ret == _Z_RES_OK) {
+                ret = __unsafe_z_multicast_resume_fragments(ztm, reliability, &sn);
+            }
+#endif
+            if (ret == _Z_RES_OK) {
+                ret = __unsafe_z_multicast_send_fragments(ztm, &fbf, reliability, priority, sn);
+            }
+            // Clear the buffer as it's no longer required
+            _z_wbuf_clear(&fbf);
+#else
+            _Z_INFO("Sending the message required fragmentation feature that is deactivated.");
+#endif
+        }
+    }
+
+    return ret;
+}
+
+#if Z_FEATURE_MULTI_THREAD == 1
+/**
+ * Send the network messages submitted to the TX task, starting with ``entry`` if already taken out of the queue. The
+ * queued messages go before the ones sent directly, as they have been submitted before.
+ */
+static void _z_multicast_tx_queue_drain(_z_transport_multicast_t *ztm, _z_tx_queue_entry_t *entry) {
+    _z_tx_gate_lock(&ztm->_gate_tx, &ztm->_mutex_tx, _Z_PRIORITY_CONTROL);
+
+    // Bound the round not to hold back the transport messages, e.g. joins, for too long
+    size_t budget = _z_tx_queue_capacity(ztm->_tx_queue);
+    if (entry == NULL) {
+        entry = _z_tx_queue_pop(ztm->_tx_queue, false);
+    }
+    while (entry != NULL) {
+        int8_t ret = __unsafe_z_multicast_send_n_msg(ztm, NULL, &entry->_msg, entry->_reliability, entry->_priority);
+        if (ret != _Z_RES_OK) {
+            _Z_ERROR("Failed to send a queued network message: %d", ret);
+        }
+        _z_tx_queue_entry_free(&entry);
+        budget--;
+        if (budget > (size_t)0) {
+            entry = _z_tx_queue_pop(ztm->_tx_queue, false);
+        }
+    }
+
+    _z_tx_gate_unlock(&ztm->_gate_tx, &ztm->_mutex_tx);
+}
+
+static int8_t _z_multicast_submit_n_msg(_z_transport_multicast_t *ztm, const _z_network_message_t *n_msg,
+                                        z_reliability_t reliability, z_congestion_control_t cong_ctrl) {
+    int8_t ret = _z_tx_queue_push(ztm->_tx_queue, n_msg, reliability, cong_ctrl);
+    if (ret == _Z_ERR_TRANSPORT_NO_SPACE) {
+        _Z_INFO("Dropping zenoh message because of congestion control");
+        ret = _Z_RES_OK;
+    } else if ((ret == _Z_RES_OK) && (ztm->_tx_task_running == false)) {
+        // The TX task has been stopped in the meantime, it may have exited without sending the message
+        _z_multicast_tx_queue_drain(ztm, NULL);
+    }
+    return ret;
+}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
 int8_t _z_multicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg, z_reliability_t reliability,
                                z_congestion_control_t cong_ctrl) {
     int8_t ret = _Z_RES_OK;
     _Z_DEBUG(">> send network message");
 
     _z_transport_multicast_t *ztm = &zn->_tp._transport._multicast;
+    z_priority_t priority = _z_n_msg_get_priority(n_msg);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    if (ztm->_tx_task_running == true) {
+        return _z_multicast_submit_n_msg(ztm, n_msg, reliability, cong_ctrl);
+    }
+#endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    // Acquire the lock and drop the message if needed
+    // Acquire the lock, after the messages of higher priority, and drop the message if needed
     _Bool drop = false;
     if (cong_ctrl == Z_CONGESTION_CONTROL_BLOCK) {
 #if Z_FEATURE_MULTI_THREAD == 1
-        z_mutex_lock(&ztm->_mutex_tx);
+        _z_tx_gate_lock(&ztm->_gate_tx, &ztm->_mutex_tx, priority);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
     } else {
 #if Z_FEATURE_MULTI_THREAD == 1
-        int8_t locked = z_mutex_trylock(&ztm->_mutex_tx);
+        int8_t locked = _z_tx_gate_trylock(&ztm->_gate_tx, &ztm->_mutex_tx, priority);
         if (locked != (int8_t)0) {
             _Z_INFO("Dropping zenoh message because of congestion control");
             // We failed to acquire the lock, drop the message
@@ -96,70 +303,67 @@ int8_t _z_multicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_m
     }
 
     if (drop == false) {
-        // Prepare the buffer eventually reserving space for the message length
-        __unsafe_z_prepare_wbuf(&ztm->_wbuf, ztm->_link._cap._flow);
-
-        _z_zint_t sn = __unsafe_z_multicast_get_sn(ztm, reliability);  // Get the next sequence number
-
-        _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, reliability);
-        ret = _z_transport_message_encode(&ztm->_wbuf, &t_msg);  // Encode the frame header
-        if (ret == _Z_RES_OK) {
-            ret = _z_network_message_encode(&ztm->_wbuf, n_msg);  // Encode the network message
-            if (ret == _Z_RES_OK) {
-                // Write the message length in the reserved space if needed
-                __unsafe_z_finalize_wbuf(&ztm->_wbuf, ztm->_link._cap._flow);
-
-                ret = _z_link_send_wbuf(&ztm->_link, &ztm->_wbuf);  // Send the wbuf on the socket
-                if (ret == _Z_RES_OK) {
-                    ztm->_transmitted = true;  // Mark the session that we have transmitted data
-                }
-            } else {
-#if Z_FEATURE_FRAGMENTATION == 1
-                // The message does not fit in the current batch, let's fragment it
-                // Create an expandable wbuf for fragmentation
-                _z_wbuf_t fbf = _z_wbuf_make(_Z_FRAG_BUFF_BASE_SIZE, true);
-
-                ret = _z_network_message_encode(&fbf, n_msg);  // Encode the message on the expandable wbuf
-                if (ret == _Z_RES_OK) {
-                    _Bool is_first = true;  // Fragment and send the message
-                    while (_z_wbuf_len(&fbf) > 0) {
-                        if (is_first == false) {  // Get the fragment sequence number
-                            sn = __unsafe_z_multicast_get_sn(ztm, reliability);
-                        }
-                        is_first = false;
-
-                        // Clear the buffer for serialization
-                        __unsafe_z_prepare_wbuf(&ztm->_wbuf, ztm->_link._cap._flow);
-
-                        // Serialize one fragment
-                        ret = __unsafe_z_serialize_zenoh_fragment(&ztm->_wbuf, &fbf, reliability, sn);
-                        if (ret == _Z_RES_OK) {
-                            // Write the message length in the reserved space if needed
-                            __unsafe_z_finalize_wbuf(&ztm->_wbuf, ztm->_link._cap._flow);
-
-                            ret = _z_link_send_wbuf(&ztm->_link, &ztm->_wbuf);  // Send the wbuf on the socket
-                            if (ret == _Z_RES_OK) {
-                                ztm->_transmitted = true;  // Mark the session that we have transmitted data
-                            }
-                        }
-                    }
-                }
-                // Clear the buffer as it's no longer required
-                _z_wbuf_clear(&fbf);
-#else
-                _Z_INFO("Sending the message required fragmentation feature that is deactivated.");
-#endif
-            }
-        }
+        ret = __unsafe_z_multicast_send_n_msg(ztm, n_msg, NULL, reliability, priority);
 
 #if Z_FEATURE_MULTI_THREAD == 1
-        z_mutex_unlock(&ztm->_mutex_tx);
+        _z_tx_gate_unlock(&ztm->_gate_tx, &ztm->_mutex_tx);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
     }
 
     return ret;
 }
 
+#if Z_FEATURE_MULTI_THREAD == 1
+void *_zp_multicast_tx_task(void *ztm_arg) {
+    _z_transport_multicast_t *ztm = (_z_transport_multicast_t *)ztm_arg;
+
+    while (ztm->_tx_task_running == true) {
+        // Wait for a message, or to be woken up by the task being stopped
+        _z_multicast_tx_queue_drain(ztm, _z_tx_queue_pop(ztm->_tx_queue, true));
+    }
+    // Send the messages submitted before the task has been stopped
+    _z_multicast_tx_queue_drain(ztm, NULL);
+
+    return 0;
+}
+
+int8_t _zp_multicast_start_tx_task(_z_transport_multicast_t *ztm, z_task_attr_t *attr, z_task_t *task,
+                                   size_t queue_size) {
+    // Wait for a previous task to be done
+    if (ztm->_tx_task != NULL) {
+        _zp_multicast_stop_tx_task(ztm);
+        z_task_join(ztm->_tx_task);
+        z_task_free(&ztm->_tx_task);
+    }
+    // The queue is kept until the transport is cleared, a submitter may still hold it
+    if (ztm->_tx_queue == NULL) {
+        ztm->_tx_queue = _z_tx_queue_new(queue_size);
+        if (ztm->_tx_queue == NULL) {
+            return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+    }
+    // Init memory
+    (void)memset(task, 0, sizeof(z_task_t));
+    // Init task
+    ztm->_tx_task_running = true;
+    if (z_task_init(task, attr, _zp_multicast_tx_task, ztm) != _Z_RES_OK) {
+        ztm->_tx_task_running = false;
+        return _Z_ERR_SYSTEM_TASK_FAILED;
+    }
+    // Attach task
+    ztm->_tx_task = task;
+    return _Z_RES_OK;
+}
+
+int8_t _zp_multicast_stop_tx_task(_z_transport_multicast_t *ztm) {
+    ztm->_tx_task_running = false;
+    if (ztm->_tx_queue != NULL) {
+        _z_tx_queue_wake(ztm->_tx_queue);
+    }
+    return _Z_RES_OK;
+}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
 #else
 int8_t _z_multicast_send_t_msg(_z_transport_multicast_t *ztm, const _z_transport_message_t *t_msg) {
     _ZP_UNUSED(ztm);
@@ -175,4 +379,25 @@ int8_t _z_multicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_m
     _ZP_UNUSED(cong_ctrl);
     return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
 }
+
+#if Z_FEATURE_MULTI_THREAD == 1
+void *_zp_multicast_tx_task(void *ztm_arg) {
+    _ZP_UNUSED(ztm_arg);
+    return NULL;
+}
+
+int8_t _zp_multicast_start_tx_task(_z_transport_multicast_t *ztm, z_task_attr_t *attr, z_task_t *task,
+                                   size_t queue_size) {
+    _ZP_UNUSED(ztm);
+    _ZP_UNUSED(attr);
+    _ZP_UNUSED(task);
+    _ZP_UNUSED(queue_size);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+}
+
+int8_t _zp_multicast_stop_tx_task(_z_transport_multicast_t *ztm) {
+    _ZP_UNUSED(ztm);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
 #endif  // Z_FEATURE_MULTICAST_TRANSPORT == 1
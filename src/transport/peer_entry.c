@@ -18,8 +18,8 @@
 
 void _z_transport_peer_entry_clear(_z_transport_peer_entry_t *src) {
 #if Z_FEATURE_FRAGMENTATION == 1
-    _z_wbuf_clear(&src->_dbuf_reliable);
-    _z_wbuf_clear(&src->_dbuf_best_effort);
+    _z_defrag_buf_clear(&src->_dbuf_reliable);
+    _z_defrag_buf_clear(&src->_dbuf_best_effort);
 #endif
 
     src->_remote_zid = _z_id_empty();
@@ -28,19 +28,21 @@ void _z_transport_peer_entry_clear(_z_transport_peer_entry_t *src) {
 
 void _z_transport_peer_entry_copy(_z_transport_peer_entry_t *dst, const _z_transport_peer_entry_t *src) {
 #if Z_FEATURE_FRAGMENTATION == 1
-    _z_wbuf_copy(&dst->_dbuf_reliable, &src->_dbuf_reliable);
-    _z_wbuf_copy(&dst->_dbuf_best_effort, &src->_dbuf_best_effort);
+    _z_defrag_buf_copy(&dst->_dbuf_reliable, &src->_dbuf_reliable);
+    _z_defrag_buf_copy(&dst->_dbuf_best_effort, &src->_dbuf_best_effort);
 #endif
 
     dst->_sn_res = src->_sn_res;
     _z_conduit_sn_list_copy(&dst->_sn_rx_sns, &src->_sn_rx_sns);
 
     dst->_lease = src->_lease;
-    dst->_next_lease = src->_next_lease;
+    dst->_lease_deadline = src->_lease_deadline;
+    dst->_lease_heap_idx = SIZE_MAX;
     dst->_received = src->_received;
 
     dst->_remote_zid = src->_remote_zid;
     _z_bytes_copy(&dst->_remote_addr, &src->_remote_addr);
+    dst->_index_next = NULL;
 }
 
 size_t _z_transport_peer_entry_size(const _z_transport_peer_entry_t *src) {
@@ -56,3 +58,140 @@ _Bool _z_transport_peer_entry_eq(const _z_transport_peer_entry_t *left, const _z
 
     return ret;
 }
+
+static size_t _z_transport_peer_index_bucket(const _z_bytes_t *addr) {
+    // FNV-1a over the address bytes
+    uint32_t hash = 2166136261U;
+    for (size_t i = 0; i < addr->len; i++) {
+        hash ^= addr->start[i];
+        hash *= 16777619U;
+    }
+    return (size_t)(hash % (uint32_t)Z_PEER_INDEX_SIZE);
+}
+
+void _z_transport_peer_index_init(_z_transport_peer_index_t *index) {
+    for (size_t i = 0; i < (size_t)Z_PEER_INDEX_SIZE; i++) {
+        index->_buckets[i] = NULL;
+    }
+}
+
+void _z_transport_peer_index_add(_z_transport_peer_index_t *index, _z_transport_peer_entry_t *entry) {
+    size_t b = _z_transport_peer_index_bucket(&entry->_remote_addr);
+    entry->_index_next = index->_buckets[b];
+    index->_buckets[b] = entry;
+}
+
+void _z_transport_peer_index_remove(_z_transport_peer_index_t *index, const _z_transport_peer_entry_t *entry) {
+    _z_transport_peer_entry_t **it = &index->_buckets[_z_transport_peer_index_bucket(&entry->_remote_addr)];
+    while (*it != NULL) {
+        if (*it == entry) {
+            *it = entry->_index_next;
+            break;
+        }
+        it = &(*it)->_index_next;
+    }
+}
+
+_z_transport_peer_entry_t *_z_transport_peer_index_get(const _z_transport_peer_index_t *index, const _z_bytes_t *addr) {
+    _z_transport_peer_entry_t *ret = index->_buckets[_z_transport_peer_index_bucket(addr)];
+    while (ret != NULL) {
+        if ((ret->_remote_addr.len == addr->len) &&
+            (memcmp(ret->_remote_addr.start, addr->start, addr->len) == 0)) {
+            break;
+        }
+        ret = ret->_index_next;
+    }
+    return ret;
+}
+
+static void _z_transport_peer_lease_heap_set(_z_transport_peer_lease_heap_t *heap, size_t i,
+                                             _z_transport_peer_entry_t *entry) {
+    heap->_vals[i] = entry;
+    entry->_lease_heap_idx = i;
+}
+
+static void _z_transport_peer_lease_heap_sift_up(_z_transport_peer_lease_heap_t *heap, size_t i) {
+    _z_transport_peer_entry_t *entry = heap->_vals[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (heap->_vals[parent]->_lease_deadline <= entry->_lease_deadline) {
+            break;
+        }
+        _z_transport_peer_lease_heap_set(heap, i, heap->_vals[parent]);
+        i = parent;
+    }
+    _z_transport_peer_lease_heap_set(heap, i, entry);
+}
+
+static void _z_transport_peer_lease_heap_sift_down(_z_transport_peer_lease_heap_t *heap, size_t i) {
+    _z_transport_peer_entry_t *entry = heap->_vals[i];
+    for (;;) {
+        size_t child = (2 * i) + 1;
+        if (child >= heap->_len) {
+            break;
+        }
+        if ((child + 1 < heap->_len) &&
+            (heap->_vals[child + 1]->_lease_deadline < heap->_vals[child]->_lease_deadline)) {
+            child = child + 1;
+        }
+        if (entry->_lease_deadline <= heap->_vals[child]->_lease_deadline) {
+            break;
+        }
+        _z_transport_peer_lease_heap_set(heap, i, heap->_vals[child]);
+        i = child;
+    }
+    _z_transport_peer_lease_heap_set(heap, i, entry);
+}
+
+void _z_transport_peer_lease_heap_init(_z_transport_peer_lease_heap_t *heap) {
+    heap->_vals = NULL;
+    heap->_len = 0;
+    heap->_capacity = 0;
+}
+
+void _z_transport_peer_lease_heap_clear(_z_transport_peer_lease_heap_t *heap) {
+    z_free(heap->_vals);
+    _z_transport_peer_lease_heap_init(heap);
+}
+
+int8_t _z_transport_peer_lease_heap_push(_z_transport_peer_lease_heap_t *heap, _z_transport_peer_entry_t *entry) {
+    if (heap->_len == heap->_capacity) {
+        size_t capacity = (heap->_capacity == 0) ? 4 : (heap->_capacity * 2);
+        _z_transport_peer_entry_t **vals =
+            (_z_transport_peer_entry_t **)z_realloc(heap->_vals, capacity * sizeof(_z_transport_peer_entry_t *));
+        if (vals == NULL) {
+            return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+        heap->_vals = vals;
+        heap->_capacity = capacity;
+    }
+    heap->_vals[heap->_len] = entry;
+    heap->_len = heap->_len + 1;
+    _z_transport_peer_lease_heap_sift_up(heap, heap->_len - 1);
+    return _Z_RES_OK;
+}
+
+void _z_transport_peer_lease_heap_remove(_z_transport_peer_lease_heap_t *heap, const _z_transport_peer_entry_t *entry) {
+    size_t i = entry->_lease_heap_idx;
+    if ((i >= heap->_len) || (heap->_vals[i] != entry)) {
+        return;
+    }
+    heap->_len = heap->_len - 1;
+    if (i < heap->_len) {
+        _z_transport_peer_lease_heap_set(heap, i, heap->_vals[heap->_len]);
+        _z_transport_peer_lease_heap_update(heap, heap->_vals[i]);
+    }
+}
+
+void _z_transport_peer_lease_heap_update(_z_transport_peer_lease_heap_t *heap, _z_transport_peer_entry_t *entry) {
+    size_t i = entry->_lease_heap_idx;
+    if ((i > 0) && (entry->_lease_deadline < heap->_vals[(i - 1) / 2]->_lease_deadline)) {
+        _z_transport_peer_lease_heap_sift_up(heap, i);
+    } else {
+        _z_transport_peer_lease_heap_sift_down(heap, i);
+    }
+}
+
+_z_transport_peer_entry_t *_z_transport_peer_lease_heap_top(const _z_transport_peer_lease_heap_t *heap) {
+    return (heap->_len > 0) ? heap->_vals[0] : NULL;
+}
@@ -174,6 +174,7 @@ int8_t _z_new_link_raweth(_z_link_t *zl, _z_endpoint_t endpoint) {
 
     zl->_write_f = _z_f_link_write_raweth;
     zl->_write_all_f = _z_f_link_write_all_raweth;
+    zl->_write_vec_f = NULL;
     zl->_read_f = _z_f_link_read_raweth;
     zl->_read_exact_f = _z_f_link_read_exact_raweth;
 
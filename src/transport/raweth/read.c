@@ -15,6 +15,7 @@
 #include "zenoh-pico/transport/raweth/read.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/protocol/codec/transport.h"
@@ -29,13 +30,16 @@
 int8_t _zp_raweth_read(_z_transport_multicast_t *ztm) {
     int8_t ret = _Z_RES_OK;
 
-    _z_bytes_t addr;
+    uint8_t addr_buf[_Z_TRANSPORT_PEER_ADDR_MAX_LEN];
+    (void)memset(addr_buf, 0, sizeof(addr_buf));
+    _z_bytes_t addr = _z_bytes_wrap(addr_buf, sizeof(addr_buf));
     _z_transport_message_t t_msg;
     ret = _z_raweth_recv_t_msg(ztm, &t_msg, &addr);
     if (ret == _Z_RES_OK) {
         ret = _z_multicast_handle_transport_message(ztm, &t_msg, &addr);
         _z_t_msg_clear(&t_msg);
     }
+    _z_bytes_clear(&addr);
     return ret;
 }
 #else
@@ -51,10 +55,16 @@ int8_t _zp_raweth_read(_z_transport_multicast_t *ztm) {
 void *_zp_raweth_read_task(void *ztm_arg) {
     _z_transport_multicast_t *ztm = (_z_transport_multicast_t *)ztm_arg;
     _z_transport_message_t t_msg;
+    // The source address of each frame is written to a reused scratch buffer
+    uint8_t addr_buf[_Z_TRANSPORT_PEER_ADDR_MAX_LEN];
     _z_bytes_t addr = _z_bytes_wrap(NULL, 0);
 
     // Task loop
     while (ztm->_read_task_running == true) {
+        _z_bytes_clear(&addr);
+        // Links that do not report the sender leave it zeroed rather than what the previous batch held
+        (void)memset(addr_buf, 0, sizeof(addr_buf));
+        addr = _z_bytes_wrap(addr_buf, sizeof(addr_buf));
         // Read message from link
         int8_t ret = _z_raweth_recv_t_msg(ztm, &t_msg, &addr);
         switch (ret) {
@@ -78,8 +88,8 @@ void *_zp_raweth_read_task(void *ztm_arg) {
             continue;
         }
         _z_t_msg_clear(&t_msg);
-        _z_bytes_clear(&addr);
     }
+    _z_bytes_clear(&addr);
     return NULL;
 }
 
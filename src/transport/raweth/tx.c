@@ -33,8 +33,12 @@
 
 #if Z_FEATURE_MULTI_THREAD == 1
 static void _zp_raweth_unlock_tx_mutex(_z_transport_multicast_t *ztm) { z_mutex_unlock(&ztm->_mutex_tx); }
+static void _zp_raweth_unlock_tx_gate(_z_transport_multicast_t *ztm) {
+    _z_tx_gate_unlock(&ztm->_gate_tx, &ztm->_mutex_tx);
+}
 #else
 static void _zp_raweth_unlock_tx_mutex(_z_transport_multicast_t *ztm) { _ZP_UNUSED(ztm); }
+static void _zp_raweth_unlock_tx_gate(_z_transport_multicast_t *ztm) { _ZP_UNUSED(ztm); }
 #endif
 
 static int _zp_raweth_find_map_entry(const _z_keyexpr_t *keyexpr, _z_raweth_socket_t *sock) {
@@ -225,12 +229,13 @@ int8_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg,
     _z_transport_multicast_t *ztm = &zn->_tp._transport._raweth;
     _Z_DEBUG(">> send network message");
 
-    // Acquire the lock and drop the message if needed
+    // Acquire the lock, after the messages of higher priority, and drop the message if needed
 #if Z_FEATURE_MULTI_THREAD == 1
+    z_priority_t priority = _z_n_msg_get_priority(n_msg);
     if (cong_ctrl == Z_CONGESTION_CONTROL_BLOCK) {
-        z_mutex_lock(&ztm->_mutex_tx);
+        _z_tx_gate_lock(&ztm->_gate_tx, &ztm->_mutex_tx, priority);
     } else {
-        if (z_mutex_trylock(&ztm->_mutex_tx) != (int8_t)0) {
+        if (_z_tx_gate_trylock(&ztm->_gate_tx, &ztm->_mutex_tx, priority) != (int8_t)0) {
             _Z_INFO("Dropping zenoh message because of congestion control");
             // We failed to acquire the lock, drop the message
             return ret;
@@ -260,21 +265,21 @@ int8_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg,
     _z_wbuf_reset(&ztm->_wbuf);
     // Set socket info
     _Z_CLEAN_RETURN_IF_ERR(_zp_raweth_set_socket(keyexpr, &ztm->_link._socket._raweth),
-                           _zp_raweth_unlock_tx_mutex(ztm));
+                           _zp_raweth_unlock_tx_gate(ztm));
     // Prepare buff
     __unsafe_z_raweth_prepare_header(&ztm->_link, &ztm->_wbuf);
     // Set the frame header
     _z_zint_t sn = __unsafe_z_raweth_get_sn(ztm, reliability);
     _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, reliability);
     // Encode the frame header
-    _Z_CLEAN_RETURN_IF_ERR(_z_transport_message_encode(&ztm->_wbuf, &t_msg), _zp_raweth_unlock_tx_mutex(ztm));
+    _Z_CLEAN_RETURN_IF_ERR(_z_transport_message_encode(&ztm->_wbuf, &t_msg), _zp_raweth_unlock_tx_gate(ztm));
     // Encode the network message
     if (_z_network_message_encode(&ztm->_wbuf, n_msg) == _Z_RES_OK) {
         // Write the eth header
         _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_raweth_write_header(&ztm->_link, &ztm->_wbuf),
-                               _zp_raweth_unlock_tx_mutex(ztm));
+                               _zp_raweth_unlock_tx_gate(ztm));
         // Send the wbuf on the socket
-        _Z_CLEAN_RETURN_IF_ERR(_z_raweth_link_send_wbuf(&ztm->_link, &ztm->_wbuf), _zp_raweth_unlock_tx_mutex(ztm));
+        _Z_CLEAN_RETURN_IF_ERR(_z_raweth_link_send_wbuf(&ztm->_link, &ztm->_wbuf), _zp_raweth_unlock_tx_gate(ztm));
         // Mark the session that we have transmitted data
         ztm->_transmitted = true;
     } else {  // The message does not fit in the current batch, let's fragment it
@@ -282,7 +287,7 @@ int8_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg,
         // Create an expandable wbuf for fragmentation
         _z_wbuf_t fbf = _z_wbuf_make(_Z_FRAG_BUFF_BASE_SIZE, true);
         // Encode the message on the expandable wbuf
-        _Z_CLEAN_RETURN_IF_ERR(_z_network_message_encode(&fbf, n_msg), _zp_raweth_unlock_tx_mutex(ztm));
+        _Z_CLEAN_RETURN_IF_ERR(_z_network_message_encode(&fbf, n_msg), _zp_raweth_unlock_tx_gate(ztm));
         // Fragment and send the message
         _Bool is_first = true;
         while (_z_wbuf_len(&fbf) > 0) {
@@ -296,13 +301,13 @@ int8_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg,
             // Prepare buff
             __unsafe_z_raweth_prepare_header(&ztm->_link, &ztm->_wbuf);
             // Serialize one fragment
-            _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_serialize_zenoh_fragment(&ztm->_wbuf, &fbf, reliability, sn),
-                                   _zp_raweth_unlock_tx_mutex(ztm));
+            _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_serialize_zenoh_fragment(&ztm->_wbuf, &fbf, reliability, sn, false),
+                                   _zp_raweth_unlock_tx_gate(ztm));
             // Write the eth header
             _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_raweth_write_header(&ztm->_link, &ztm->_wbuf),
-                                   _zp_raweth_unlock_tx_mutex(ztm));
+                                   _zp_raweth_unlock_tx_gate(ztm));
             // Send the wbuf on the socket
-            _Z_CLEAN_RETURN_IF_ERR(_z_raweth_link_send_wbuf(&ztm->_link, &ztm->_wbuf), _zp_raweth_unlock_tx_mutex(ztm));
+            _Z_CLEAN_RETURN_IF_ERR(_z_raweth_link_send_wbuf(&ztm->_link, &ztm->_wbuf), _zp_raweth_unlock_tx_gate(ztm));
             // Mark the session that we have transmitted data
             ztm->_transmitted = true;
         }
@@ -312,9 +317,7 @@ int8_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg,
         _Z_INFO("Sending the message required fragmentation feature that is deactivated.");
 #endif
     }
-#if Z_FEATURE_MULTI_THREAD == 1
-    z_mutex_unlock(&ztm->_mutex_tx);
-#endif  // Z_FEATURE_MULTI_THREAD == 1
+    _zp_raweth_unlock_tx_gate(ztm);
     return ret;
 }
 
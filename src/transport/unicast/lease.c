@@ -47,6 +47,13 @@ void *_zp_unicast_lease_task(void *ztu_arg) {
     _z_zint_t next_lease = ztu->_lease;
     _z_zint_t next_keep_alive = (_z_zint_t)(ztu->_lease / Z_TRANSPORT_LEASE_EXPIRE_FACTOR);
     while (ztu->_lease_task_running == true) {
+#if Z_FEATURE_BATCHING == 1
+        // Flush the pending batch if it has been lingering for too long
+        if (ztu->_batching == true) {
+            _z_unicast_flush_expired(ztu);
+        }
+#endif
+
         if (next_lease == 0) {
             // Check if received data
             if (ztu->_received == true) {
@@ -85,9 +92,37 @@ void *_zp_unicast_lease_task(void *ztu_arg) {
                 interval = next_keep_alive;
             }
         }
-
         // The keep alive and lease intervals are expressed in milliseconds
+#if Z_FEATURE_BATCHING == 1
+        // Wait until the pending batch has lingered long enough if it is due first. A batch opening in the meantime
+        // wakes the task up, so that its linger is honored too
+        z_clock_t start = z_clock_now();
+        z_mutex_lock(&ztu->_mutex_tx);
+        _z_zint_t wait = interval;
+        uint32_t linger = (ztu->_batching == true) ? ztu->_batch_linger_ms : (uint32_t)0;
+        if ((ztu->_batch_count > (size_t)0) && (linger > (uint32_t)0)) {
+            unsigned long lingered = z_clock_elapsed_ms(&ztu->_batch_start);
+            _z_zint_t left = (lingered < linger) ? (_z_zint_t)(linger - lingered) : (_z_zint_t)1;
+            if (left < wait) {
+                wait = left;
+            }
+        }
+        int8_t res = z_condvar_wait_for(&ztu->_cond_batch, &ztu->_mutex_tx, (uint32_t)wait);
+        z_mutex_unlock(&ztu->_mutex_tx);
+        if (res != _Z_RES_OK) {
+            // No condition variables on this platform, the batches are polled instead
+            if ((linger > (uint32_t)0) && (linger < wait)) {
+                wait = linger;
+            }
+            z_sleep_ms(wait);
+        }
+        unsigned long elapsed = z_clock_elapsed_ms(&start);
+        if (elapsed < interval) {
+            interval = (_z_zint_t)elapsed;
+        }
+#else
         z_sleep_ms(interval);
+#endif
 
         next_lease = next_lease - interval;
         next_keep_alive = next_keep_alive - interval;
@@ -109,7 +109,7 @@ int8_t _z_unicast_handle_transport_message(_z_transport_unicast_t *ztu, _z_trans
                     ztu->_sn_rx_reliable = t_msg->_body._frame._sn;
                 } else {
 #if Z_FEATURE_FRAGMENTATION == 1
-                    _z_wbuf_clear(&ztu->_dbuf_reliable);
+                    _z_defrag_buf_reset(&ztu->_dbuf_reliable);
 #endif
                     _Z_INFO("Reliable message dropped because it is out of order");
                     break;
@@ -119,19 +119,25 @@ int8_t _z_unicast_handle_transport_message(_z_transport_unicast_t *ztu, _z_trans
                     ztu->_sn_rx_best_effort = t_msg->_body._frame._sn;
                 } else {
 #if Z_FEATURE_FRAGMENTATION == 1
-                    _z_wbuf_clear(&ztu->_dbuf_best_effort);
+                    _z_defrag_buf_reset(&ztu->_dbuf_best_effort);
 #endif
                     _Z_INFO("Best effort message dropped because it is out of order");
                     break;
                 }
             }
 
-            // Handle all the zenoh message, one by one
-            size_t len = _z_vec_len(&t_msg->_body._frame._messages);
-            for (size_t i = 0; i < len; i++) {
-                _z_handle_network_message(ztu->_session,
-                                          (_z_zenoh_message_t *)_z_vec_get(&t_msg->_body._frame._messages, i),
-                                          _Z_KEYEXPR_MAPPING_UNKNOWN_REMOTE);
+            // Handle all the zenoh message, one by one, as they are decoded
+            while (_z_zbuf_len(&t_msg->_body._frame._payload) > (size_t)0) {
+                _z_zenoh_message_t zm;
+                ret = _z_frame_decode_message(&t_msg->_body._frame, &zm);
+                if (ret != _Z_RES_OK) {
+                    break;
+                }
+                _z_handle_network_message(ztu->_session, &zm, _Z_KEYEXPR_MAPPING_UNKNOWN_REMOTE);
+                _z_msg_clear(&zm);
+            }
+            if (ret == _Z_ERR_MESSAGE_ZENOH_UNKNOWN) {
+                ret = _Z_RES_OK;  // The unknown messages are skipped
             }
 
             break;
@@ -140,31 +146,25 @@ int8_t _z_unicast_handle_transport_message(_z_transport_unicast_t *ztu, _z_trans
         case _Z_MID_T_FRAGMENT: {
             _Z_INFO("Received Z_FRAGMENT message");
 #if Z_FEATURE_FRAGMENTATION == 1
-            _z_wbuf_t *dbuf = _Z_HAS_FLAG(t_msg->_header, _Z_FLAG_T_FRAGMENT_R)
-                                  ? &ztu->_dbuf_reliable
-                                  : &ztu->_dbuf_best_effort;  // Select the right defragmentation buffer
-
-            _Bool drop = false;
-            if ((_z_wbuf_len(dbuf) + t_msg->_body._fragment._payload.len) > Z_FRAG_MAX_SIZE) {
-                // Filling the wbuf capacity as a way to signal the last fragment to reset the dbuf
-                // Otherwise, last (smaller) fragments can be understood as a complete message
-                _z_wbuf_write_bytes(dbuf, t_msg->_body._fragment._payload.start, 0, _z_wbuf_space_left(dbuf));
-                drop = true;
-            } else {
-                _z_wbuf_write_bytes(dbuf, t_msg->_body._fragment._payload.start, 0,
-                                    t_msg->_body._fragment._payload.len);
+            _z_defrag_buf_t *dbuf = _Z_HAS_FLAG(t_msg->_header, _Z_FLAG_T_FRAGMENT_R)
+                                        ? &ztu->_dbuf_reliable
+                                        : &ztu->_dbuf_best_effort;  // Select the right defragmentation buffer
+
+            // The fragment is copied straight from the read buffer, a message exceeding Z_FRAG_MAX_SIZE is flagged
+            // so that its remaining fragments are discarded
+            if (_z_defrag_buf_push(dbuf, &t_msg->_body._fragment._payload) != _Z_RES_OK) {
+                _Z_INFO("Fragment dropped because the message exceeds the fragmentation size");
             }
 
             if (_Z_HAS_FLAG(t_msg->_header, _Z_FLAG_T_FRAGMENT_M) == false) {
-                if (drop == true) {  // Drop message if it exceeds the fragmentation size
-                    _z_wbuf_reset(dbuf);
+                if (dbuf->_drop == true) {  // Drop message if it exceeds the fragmentation size
+                    _z_defrag_buf_reset(dbuf);
                     break;
                 }
 
-                _z_zbuf_t zbf = _z_wbuf_to_zbuf(dbuf);  // Convert the defragmentation buffer into a decoding buffer
-
+                // Decode in place, the message borrows the defragmentation buffer until it is cleared
                 _z_zenoh_message_t zm;
-                int8_t ret = _z_network_message_decode(&zm, &zbf);
+                int8_t ret = _z_network_message_decode(&zm, &dbuf->_buf);
                 if (ret == _Z_RES_OK) {
                     _z_handle_network_message(ztu->_session, &zm, _Z_KEYEXPR_MAPPING_UNKNOWN_REMOTE);
                     _z_msg_clear(&zm);  // Clear must be explicitly called for fragmented zenoh messages. Non-fragmented
@@ -173,10 +173,8 @@ int8_t _z_unicast_handle_transport_message(_z_transport_unicast_t *ztu, _z_trans
                     _Z_DEBUG("Failed to decode defragmented message");
                 }
 
-                // Free the decoding buffer
-                _z_zbuf_clear(&zbf);
                 // Reset the defragmentation buffer
-                _z_wbuf_reset(dbuf);
+                _z_defrag_buf_reset(dbuf);
             }
 #else
             _Z_INFO("Fragment dropped because fragmentation feature is deactivated");
@@ -41,7 +41,13 @@ int8_t _z_unicast_transport_create(_z_transport_t *zt, _z_link_t *zl, _z_transpo
     ret = z_mutex_init(&zt->_transport._unicast._mutex_tx);
     if (ret == _Z_RES_OK) {
         ret = z_mutex_init(&zt->_transport._unicast._mutex_rx);
-        if (ret != _Z_RES_OK) {
+        if (ret == _Z_RES_OK) {
+            ret = _z_tx_gate_init(&zt->_transport._unicast._gate_tx);
+            if (ret != _Z_RES_OK) {
+                z_mutex_free(&zt->_transport._unicast._mutex_tx);
+                z_mutex_free(&zt->_transport._unicast._mutex_rx);
+            }
+        } else {
             z_mutex_free(&zt->_transport._unicast._mutex_tx);
         }
     }
@@ -50,31 +56,22 @@ int8_t _z_unicast_transport_create(_z_transport_t *zt, _z_link_t *zl, _z_transpo
     // Initialize the read and write buffers
     if (ret == _Z_RES_OK) {
         uint16_t mtu = (zl->_mtu < Z_BATCH_UNICAST_SIZE) ? zl->_mtu : Z_BATCH_UNICAST_SIZE;
-        size_t dbuf_size = 0;
         size_t wbuf_size = 0;
         size_t zbuf_size = 0;
-        _Bool expandable = false;
 
         switch (zl->_cap._flow) {
             case Z_LINK_CAP_FLOW_STREAM:
                 // Add stream length field to buffer size
                 wbuf_size = mtu + _Z_MSG_LEN_ENC_SIZE;
                 zbuf_size = Z_BATCH_UNICAST_SIZE + _Z_MSG_LEN_ENC_SIZE;
-                expandable = true;
                 break;
             case Z_LINK_CAP_FLOW_DATAGRAM:
             default:
                 wbuf_size = mtu;
                 zbuf_size = Z_BATCH_UNICAST_SIZE;
-                expandable = false;
                 break;
         }
 
-#if Z_FEATURE_DYNAMIC_MEMORY_ALLOCATION == 0
-        expandable = false;
-        dbuf_size = Z_FRAG_MAX_SIZE;
-#endif
-
         // Initialize tx rx buffers
         zt->_transport._unicast._wbuf = _z_wbuf_make(wbuf_size, false);
         zt->_transport._unicast._zbuf = _z_zbuf_make(zbuf_size);
@@ -88,6 +85,7 @@ int8_t _z_unicast_transport_create(_z_transport_t *zt, _z_link_t *zl, _z_transpo
 #if Z_FEATURE_MULTI_THREAD == 1
             z_mutex_free(&zt->_transport._unicast._mutex_tx);
             z_mutex_free(&zt->_transport._unicast._mutex_rx);
+            _z_tx_gate_clear(&zt->_transport._unicast._gate_tx);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
             _z_wbuf_clear(&zt->_transport._unicast._wbuf);
@@ -96,27 +94,21 @@ int8_t _z_unicast_transport_create(_z_transport_t *zt, _z_link_t *zl, _z_transpo
 
 #if Z_FEATURE_FRAGMENTATION == 1
         // Initialize the defragmentation buffers
-        zt->_transport._unicast._dbuf_reliable = _z_wbuf_make(dbuf_size, expandable);
-        zt->_transport._unicast._dbuf_best_effort = _z_wbuf_make(dbuf_size, expandable);
+        int8_t ret_reliable = _z_defrag_buf_init(&zt->_transport._unicast._dbuf_reliable);
+        int8_t ret_best_effort = _z_defrag_buf_init(&zt->_transport._unicast._dbuf_best_effort);
 
         // Clean up the buffers if one of them failed to be allocated
-        if (
-#if Z_FEATURE_DYNAMIC_MEMORY_ALLOCATION == 0
-            (_z_wbuf_capacity(&zt->_transport._unicast._dbuf_reliable) != dbuf_size) ||
-            (_z_wbuf_capacity(&zt->_transport._unicast._dbuf_best_effort) != dbuf_size)) {
-#else
-            (_z_wbuf_capacity(&zt->_transport._unicast._dbuf_reliable) != Z_IOSLICE_SIZE) ||
-            (_z_wbuf_capacity(&zt->_transport._unicast._dbuf_best_effort) != Z_IOSLICE_SIZE)) {
-#endif
+        if ((ret_reliable != _Z_RES_OK) || (ret_best_effort != _Z_RES_OK)) {
             ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
             _Z_ERROR("Not enough memory to allocate transport defragmentation buffers!");
 
-            _z_wbuf_clear(&zt->_transport._unicast._dbuf_reliable);
-            _z_wbuf_clear(&zt->_transport._unicast._dbuf_best_effort);
+            _z_defrag_buf_clear(&zt->_transport._unicast._dbuf_reliable);
+            _z_defrag_buf_clear(&zt->_transport._unicast._dbuf_best_effort);
 
 #if Z_FEATURE_MULTI_THREAD == 1
             z_mutex_free(&zt->_transport._unicast._mutex_tx);
             z_mutex_free(&zt->_transport._unicast._mutex_rx);
+            _z_tx_gate_clear(&zt->_transport._unicast._gate_tx);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
             _z_wbuf_clear(&zt->_transport._unicast._wbuf);
@@ -144,8 +136,28 @@ int8_t _z_unicast_transport_create(_z_transport_t *zt, _z_link_t *zl, _z_transpo
         zt->_transport._unicast._read_task = NULL;
         zt->_transport._unicast._lease_task_running = false;
         zt->_transport._unicast._lease_task = NULL;
+        zt->_transport._unicast._tx_task_running = false;
+        zt->_transport._unicast._tx_task = NULL;
+        zt->_transport._unicast._tx_queue = NULL;
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_FRAGMENTATION == 1 && Z_FEATURE_TX_PREEMPTION == 1
+        zt->_transport._unicast._frag_suspended_reliable = NULL;
+        zt->_transport._unicast._frag_suspended_best_effort = NULL;
+#endif
+
+#if Z_FEATURE_BATCHING == 1
+        // TX batching is disabled by default
+        zt->_transport._unicast._batching = false;
+        zt->_transport._unicast._batch_count = 0;
+        zt->_transport._unicast._batch_linger_ms = Z_BATCH_LINGER_MS;
+        zt->_transport._unicast._batch_reliability = Z_RELIABILITY_RELIABLE;
+#if Z_FEATURE_MULTI_THREAD == 1
+        // Without condition variables, the lease task polls the pending batch instead
+        (void)z_condvar_init(&zt->_transport._unicast._cond_batch);
+#endif
+#endif
+
         // Notifiers
         zt->_transport._unicast._received = 0;
         zt->_transport._unicast._transmitted = 0;
@@ -294,18 +306,28 @@ void _z_unicast_transport_clear(_z_transport_t *zt) {
         z_task_join(ztu->_lease_task);
         z_task_free(&ztu->_lease_task);
     }
+    if (ztu->_tx_task != NULL) {
+        _zp_unicast_stop_tx_task(zt);
+        z_task_join(ztu->_tx_task);
+        z_task_free(&ztu->_tx_task);
+    }
+    _z_tx_queue_free(&ztu->_tx_queue);
 
     // Clean up the mutexes
     z_mutex_free(&ztu->_mutex_tx);
     z_mutex_free(&ztu->_mutex_rx);
+    _z_tx_gate_clear(&ztu->_gate_tx);
+#if Z_FEATURE_BATCHING == 1
+    (void)z_condvar_free(&ztu->_cond_batch);
+#endif
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
     // Clean up the buffers
     _z_wbuf_clear(&ztu->_wbuf);
     _z_zbuf_clear(&ztu->_zbuf);
 #if Z_FEATURE_FRAGMENTATION == 1
-    _z_wbuf_clear(&ztu->_dbuf_reliable);
-    _z_wbuf_clear(&ztu->_dbuf_best_effort);
+    _z_defrag_buf_clear(&ztu->_dbuf_reliable);
+    _z_defrag_buf_clear(&ztu->_dbuf_best_effort);
 #endif
 
     // Clean up PIDs
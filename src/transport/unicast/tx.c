@@ -15,6 +15,7 @@
 #include "zenoh-pico/transport/unicast/tx.h"
 
 #include <assert.h>
+#include <string.h>
 
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/protocol/codec/network.h"
@@ -43,6 +44,155 @@ _z_zint_t __unsafe_z_unicast_get_sn(_z_transport_unicast_t *ztu, z_reliability_t
     return sn;
 }
 
+/**
+ * Whether the network message being encoded in the transport wbuf may alias the user payload, that is
+ * whether the wbuf is sent before returning to the caller rather than kept for a pending batch.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztu->_mutex_tx
+ */
+static _Bool __unsafe_z_unicast_can_alias(const _z_transport_unicast_t *ztu, _Bool batch) {
+    return (ztu->_link._write_vec_f != NULL) && (batch == false);
+}
+
+#if Z_FEATURE_BATCHING == 1
+/**
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztu->_mutex_tx
+ */
+static int8_t __unsafe_z_unicast_flush(_z_transport_unicast_t *ztu) {
+    int8_t ret = _Z_RES_OK;
+    if (ztu->_batch_count > 0) {
+        ztu->_batch_count = 0;
+        // Write the message length in the reserved space if needed
+        __unsafe_z_finalize_wbuf(&ztu->_wbuf, ztu->_link._cap._flow);
+        ret = _z_link_send_wbuf(&ztu->_link, &ztu->_wbuf);  // Send the wbuf on the socket
+        if (ret == _Z_RES_OK) {
+            ztu->_transmitted = true;  // Mark the session that we have transmitted data
+        }
+    }
+    return ret;
+}
+
+/**
+ * Append a network message to the FRAME of the pending batch. The message is not appended, and
+ * `batched` is left to false, if there is no pending batch or if the pending batch is for a
+ * different reliability or has not enough space left. In the latter two cases the batch is flushed.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztu->_mutex_tx
+ */
+static int8_t __unsafe_z_unicast_batch_n_msg(_z_transport_unicast_t *ztu, const _z_network_message_t *n_msg,
+                                             const _z_bytes_t *encoded, z_reliability_t reliability, _Bool *batched) {
+    int8_t ret = _Z_RES_OK;
+    *batched = false;
+
+    if (ztu->_batch_count > 0) {
+        if (ztu->_batch_reliability == reliability) {
+            size_t w_pos = _z_wbuf_get_wpos(&ztu->_wbuf);  // Mark the buffer to revert a partial encoding
+            if (_z_write_n_msg(&ztu->_wbuf, n_msg, encoded) == _Z_RES_OK) {
+                ztu->_batch_count = ztu->_batch_count + (size_t)1;
+                *batched = true;
+            } else {
+                _z_wbuf_set_wpos(&ztu->_wbuf, w_pos);
+                ret = __unsafe_z_unicast_flush(ztu);  // The batch is full
+            }
+        } else {
+            ret = __unsafe_z_unicast_flush(ztu);  // A FRAME carries messages of a single reliability
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * Flush the pending batch if it has been lingering for longer than allowed. A linger of 0
+ * means that the batch is only flushed when full or on explicit request.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztu->_mutex_tx
+ */
+static int8_t __unsafe_z_unicast_flush_expired(_z_transport_unicast_t *ztu) {
+    int8_t ret = _Z_RES_OK;
+    if ((ztu->_batch_count > 0) && (ztu->_batch_linger_ms > (uint32_t)0) &&
+        (z_clock_elapsed_ms(&ztu->_batch_start) >= ztu->_batch_linger_ms)) {
+        ret = __unsafe_z_unicast_flush(ztu);
+    }
+    return ret;
+}
+
+int8_t _z_unicast_flush(_z_transport_unicast_t *ztu) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&ztu->_mutex_tx);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    int8_t ret = __unsafe_z_unicast_flush(ztu);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&ztu->_mutex_tx);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    return ret;
+}
+
+int8_t _z_unicast_flush_expired(_z_transport_unicast_t *ztu) {
+    int8_t ret = _Z_RES_OK;
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    // Do not wait for the lock, the batch is being handled by the lock holder anyway
+    if (z_mutex_trylock(&ztu->_mutex_tx) != (int8_t)0) {
+        return ret;
+    }
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    ret = __unsafe_z_unicast_flush_expired(ztu);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&ztu->_mutex_tx);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    return ret;
+}
+
+int8_t _z_unicast_batch_start(_z_transport_unicast_t *ztu, uint32_t linger_ms) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&ztu->_mutex_tx);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    ztu->_batch_linger_ms = linger_ms;
+    ztu->_batching = true;
+#if Z_FEATURE_MULTI_THREAD == 1
+    // A batch may already be pending, with a shorter linger than the one the lease task is waiting for
+    (void)z_condvar_signal(&ztu->_cond_batch);
+#endif
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&ztu->_mutex_tx);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    return _Z_RES_OK;
+}
+
+int8_t _z_unicast_batch_stop(_z_transport_unicast_t *ztu) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_lock(&ztu->_mutex_tx);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    ztu->_batching = false;
+    int8_t ret = __unsafe_z_unicast_flush(ztu);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_unlock(&ztu->_mutex_tx);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    return ret;
+}
+#endif  // Z_FEATURE_BATCHING == 1
+
 int8_t _z_unicast_send_t_msg(_z_transport_unicast_t *ztu, const _z_transport_message_t *t_msg) {
     int8_t ret = _Z_RES_OK;
     _Z_DEBUG(">> send session message");
@@ -52,6 +202,17 @@ int8_t _z_unicast_send_t_msg(_z_transport_unicast_t *ztu, const _z_transport_mes
     z_mutex_lock(&ztu->_mutex_tx);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
+#if Z_FEATURE_BATCHING == 1
+    // Transport messages are never batched, send the pending batch first not to lose it
+    ret = __unsafe_z_unicast_flush(ztu);
+    if (ret != _Z_RES_OK) {
+#if Z_FEATURE_MULTI_THREAD == 1
+        z_mutex_unlock(&ztu->_mutex_tx);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+        return ret;
+    }
+#endif
+
     // Prepare the buffer eventually reserving space for the message length
     __unsafe_z_prepare_wbuf(&ztu->_wbuf, ztu->_link._cap._flow);
 
@@ -74,31 +235,137 @@ int8_t _z_unicast_send_t_msg(_z_transport_unicast_t *ztu, const _z_transport_mes
     return ret;
 }
 
-int8_t _z_unicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg, z_reliability_t reliability,
-                             z_congestion_control_t cong_ctrl) {
+#if Z_FEATURE_FRAGMENTATION == 1
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_TX_PREEMPTION == 1
+/**
+ * Let the waiting messages of a higher priority be sent before the next fragment of a message. The fragmentation buffer
+ * is left on the transport meanwhile, so that a message that needs to be fragmented on the same channel first sends
+ * the remaining fragments: a channel can only carry the fragments of one message at a time.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztu->_mutex_tx
+ */
+static int8_t __unsafe_z_unicast_yield_fragments(_z_transport_unicast_t *ztu, _z_wbuf_t *fbf,
+                                                 z_reliability_t reliability, z_priority_t priority) {
     int8_t ret = _Z_RES_OK;
-    _Z_DEBUG(">> send network message");
+    _z_wbuf_t **suspended =
+        (reliability == Z_RELIABILITY_RELIABLE) ? &ztu->_frag_suspended_reliable : &ztu->_frag_suspended_best_effort;
+    *suspended = fbf;
+    if (_z_tx_gate_yield(&ztu->_gate_tx, &ztu->_mutex_tx, priority) == true) {
+#if Z_FEATURE_BATCHING == 1
+        ret = __unsafe_z_unicast_flush(ztu);  // Send the batch opened in the meantime, if any
+#endif
+    }
+    if (*suspended == fbf) {
+        *suspended = NULL;  // Otherwise, the message has been completed and another one has been interrupted since
+    }
+    return ret;
+}
 
-    _z_transport_unicast_t *ztu = &zn->_tp._transport._unicast;
+static int8_t __unsafe_z_unicast_send_fragments(_z_transport_unicast_t *ztu, _z_wbuf_t *fbf,
+                                                z_reliability_t reliability, z_priority_t priority, _z_zint_t sn);
 
-    // Acquire the lock and drop the message if needed
-    _Bool drop = false;
-    if (cong_ctrl == Z_CONGESTION_CONTROL_BLOCK) {
-#if Z_FEATURE_MULTI_THREAD == 1
-        z_mutex_lock(&ztu->_mutex_tx);
-#endif  // Z_FEATURE_MULTI_THREAD == 1
-    } else {
-#if Z_FEATURE_MULTI_THREAD == 1
-        int8_t locked = z_mutex_trylock(&ztu->_mutex_tx);
-        if (locked != (int8_t)0) {
-            _Z_INFO("Dropping zenoh message because of congestion control");
-            // We failed to acquire the lock, drop the message
-            drop = true;
+/**
+ * Send the remaining fragments of a message interrupted on the given channel, if any. `sn` is the sequence number
+ * reserved for the first fragment of the next message, it is taken again after the interrupted message.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztu->_mutex_tx
+ */
+static int8_t __unsafe_z_unicast_resume_fragments(_z_transport_unicast_t *ztu, z_reliability_t reliability,
+                                                  _z_zint_t *sn) {
+    int8_t ret = _Z_RES_OK;
+    _z_wbuf_t **suspended =
+        (reliability == Z_RELIABILITY_RELIABLE) ? &ztu->_frag_suspended_reliable : &ztu->_frag_suspended_best_effort;
+    _z_wbuf_t *fbf = *suspended;
+    if (fbf != NULL) {
+        *suspended = NULL;
+        // Give back the reserved sequence number, no other one has been taken since
+        if (reliability == Z_RELIABILITY_RELIABLE) {
+            ztu->_sn_tx_reliable = *sn;
+        } else {
+            ztu->_sn_tx_best_effort = *sn;
         }
-#endif  // Z_FEATURE_MULTI_THREAD == 1
+        // Nothing preempts the control priority: the interrupted message must be completed before the lock is
+        // released, its owner would otherwise release the fragmentation buffer while it is still being sent
+        ret = __unsafe_z_unicast_send_fragments(ztu, fbf, reliability, _Z_PRIORITY_CONTROL,
+                                                __unsafe_z_unicast_get_sn(ztu, reliability));
+        *sn = __unsafe_z_unicast_get_sn(ztu, reliability);
     }
+    return ret;
+}
+#endif
 
-    if (drop == false) {
+/**
+ * Fragment and send the message encoded in `fbf`, `sn` being the sequence number of the first fragment.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztu->_mutex_tx
+ */
+static int8_t __unsafe_z_unicast_send_fragments(_z_transport_unicast_t *ztu, _z_wbuf_t *fbf,
+                                                z_reliability_t reliability, z_priority_t priority, _z_zint_t sn) {
+    int8_t ret = _Z_RES_OK;
+    _ZP_UNUSED(priority);
+
+    _Bool is_first = true;
+    while ((ret == _Z_RES_OK) && (_z_wbuf_len(fbf) > 0)) {
+        if (is_first == false) {  // Get the fragment sequence number
+            sn = __unsafe_z_unicast_get_sn(ztu, reliability);
+        }
+        is_first = false;
+
+        // Clear the buffer for serialization
+        __unsafe_z_prepare_wbuf(&ztu->_wbuf, ztu->_link._cap._flow);
+
+        // Serialize one fragment. A stream link, or one supporting vectored writes, gets the fragment header and
+        // payload as separate slices, the payload is then aliased rather than copied
+        _Bool alias = (ztu->_link._cap._flow == Z_LINK_CAP_FLOW_STREAM) || (ztu->_link._write_vec_f != NULL);
+        ret = __unsafe_z_serialize_zenoh_fragment(&ztu->_wbuf, fbf, reliability, sn, alias);
+        if (ret == _Z_RES_OK) {
+            // Write the message length in the reserved space if needed
+            __unsafe_z_finalize_wbuf(&ztu->_wbuf, ztu->_link._cap._flow);
+
+            ret = _z_link_send_wbuf(&ztu->_link, &ztu->_wbuf);  // Send the wbuf on the socket
+            if (ret == _Z_RES_OK) {
+                ztu->_transmitted = true;  // Mark the session that we have transmitted data
+            }
+        }
+        // Drop the slices aliasing the fragmentation buffer
+        _z_wbuf_reset(&ztu->_wbuf);
+
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_TX_PREEMPTION == 1
+        if ((ret == _Z_RES_OK) && (_z_wbuf_len(fbf) > 0)) {
+            ret = __unsafe_z_unicast_yield_fragments(ztu, fbf, reliability, priority);
+        }
+#endif
+    }
+
+    return ret;
+}
+#endif
+
+/**
+ * Send a network message, given either as is or already encoded. Unless ``batch`` is set, the message is written on
+ * the link before returning.
+ *
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztu->_mutex_tx
+ */
+static int8_t __unsafe_z_unicast_send_n_msg(_z_transport_unicast_t *ztu, const _z_network_message_t *n_msg,
+                                            const _z_bytes_t *encoded, z_reliability_t reliability,
+                                            z_priority_t priority, _Bool batch) {
+    int8_t ret = _Z_RES_OK;
+    _ZP_UNUSED(priority);  // Only used for batching or fragmentation
+
+    _Bool batched = false;
+#if Z_FEATURE_BATCHING == 1
+    ret = __unsafe_z_unicast_batch_n_msg(ztu, n_msg, encoded, reliability, &batched);
+#endif
+    if ((ret == _Z_RES_OK) && (batched == false)) {
         // Prepare the buffer eventually reserving space for the message length
         __unsafe_z_prepare_wbuf(&ztu->_wbuf, ztu->_link._cap._flow);
 
@@ -107,69 +374,241 @@ int8_t _z_unicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg
         _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, reliability);
         ret = _z_transport_message_encode(&ztu->_wbuf, &t_msg);  // Encode the frame header
         if (ret == _Z_RES_OK) {
-            ret = _z_network_message_encode(&ztu->_wbuf, n_msg);  // Encode the network message
+            // Large payloads are aliased rather than copied when the frame is sent right away, the link then
+            // writes the header and the payload with a single vectored write
+            ztu->_wbuf._alias_bytes = __unsafe_z_unicast_can_alias(ztu, batch);
+            ret = _z_write_n_msg(&ztu->_wbuf, n_msg, encoded);  // Encode the network message
+            ztu->_wbuf._alias_bytes = false;
             if (ret == _Z_RES_OK) {
+#if Z_FEATURE_BATCHING == 1
+                // The FRAME opens a new batch, which is sent right away unless batching
+                ztu->_batch_count = 1;
+                ztu->_batch_reliability = reliability;
+                ztu->_batch_start = z_clock_now();
+                if (batch == false) {
+                    ret = __unsafe_z_unicast_flush(ztu);
+                } else {
+#if Z_FEATURE_MULTI_THREAD == 1
+                    // Let the lease task know when the batch has to be sent
+                    (void)z_condvar_signal(&ztu->_cond_batch);
+#endif
+                }
+#else
                 // Write the message length in the reserved space if needed
                 __unsafe_z_finalize_wbuf(&ztu->_wbuf, ztu->_link._cap._flow);
 
-                if (ztu->_wbuf._ioss._len == 1) {
-                    ret = _z_link_send_wbuf(&ztu->_link, &ztu->_wbuf);  // Send the wbuf on the socket
-                } else {
-                    // Change the MID
-
-                    // for ()
-                }
+                ret = _z_link_send_wbuf(&ztu->_link, &ztu->_wbuf);  // Send the wbuf on the socket
                 if (ret == _Z_RES_OK) {
                     ztu->_transmitted = true;  // Mark the session that we have transmitted data
                 }
+#endif
             } else {
 #if Z_FEATURE_FRAGMENTATION == 1
                 // The message does not fit in the current batch, let's fragment it
                 // Create an expandable wbuf for fragmentation
                 _z_wbuf_t fbf = _z_wbuf_make(_Z_FRAG_BUFF_BASE_SIZE, true);
 
-                ret = _z_network_message_encode(&fbf, n_msg);  // Encode the message on the expandable wbuf
+                ret = _z_write_n_msg(&fbf, n_msg, encoded);  // Encode the message on the expandable wbuf
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_TX_PREEMPTION == 1
                 if (ret == _Z_RES_OK) {
-                    _Bool is_first = true;  // Fragment and send the message
-                    while (_z_wbuf_len(&fbf) > 0) {
-                        if (is_first == false) {  // Get the fragment sequence number
-                            sn = __unsafe_z_unicast_get_sn(ztu, reliability);
-                        }
-                        is_first = false;
-
-                        // Clear the buffer for serialization
-                        __unsafe_z_prepare_wbuf(&ztu->_wbuf, ztu->_link._cap._flow);
-
-                        // Serialize one fragment
-                        ret = __unsafe_z_serialize_zenoh_fragment(&ztu->_wbuf, &fbf, reliability, sn);
-                        if (ret == _Z_RES_OK) {
-                            // Write the message length in the reserved space if needed
-                            __unsafe_z_finalize_wbuf(&ztu->_wbuf, ztu->_link._cap._flow);
-
-                            ret = _z_link_send_wbuf(&ztu->_link, &ztu->_wbuf);  // Send the wbuf on the socket
-                            if (ret == _Z_RES_OK) {
-                                ztu->_transmitted = true;  // Mark the session that we have transmitted data
-                            }
-                        }
-                    }
+                    ret = __unsafe_z_unicast_resume_fragments(ztu, reliability, &sn);
+                }
+#endif
+                if (ret == _Z_RES_OK) {
+                    ret = __unsafe_z_unicast_send_fragments(ztu, &fbf, reliability, priority, sn);
                 }
-
-                // Clear the buffer as it's no longer required
                 _z_wbuf_clear(&fbf);
 #else
                 _Z_INFO("Sending the message required fragmentation feature that is deactivated.");
 #endif
             }
         }
+    }
+
+#if Z_FEATURE_BATCHING == 1
+    if ((ret == _Z_RES_OK) && (priority <= Z_PRIORITY_REAL_TIME)) {
+        ret = __unsafe_z_unicast_flush(ztu);  // Real-time messages do not linger in a batch
+    }
+    if (ret == _Z_RES_OK) {
+        ret = __unsafe_z_unicast_flush_expired(ztu);
+    }
+#else
+    _ZP_UNUSED(batch);
+#endif
+
+    return ret;
+}
 
 #if Z_FEATURE_MULTI_THREAD == 1
-        z_mutex_unlock(&ztu->_mutex_tx);
+/**
+ * Send the network messages submitted to the TX task, batching them and starting with ``entry`` if already taken out
+ * of the queue. The queued messages go before the ones sent directly, as they have been submitted before.
+ */
+static void _z_unicast_tx_queue_drain(_z_transport_unicast_t *ztu, _z_tx_queue_entry_t *entry) {
+    _z_tx_gate_lock(&ztu->_gate_tx, &ztu->_mutex_tx, _Z_PRIORITY_CONTROL);
+
+    // Bound the round not to hold back the transport messages, e.g. keep alives, for too long
+    size_t budget = _z_tx_queue_capacity(ztu->_tx_queue);
+    if (entry == NULL) {
+        entry = _z_tx_queue_pop(ztu->_tx_queue, false);
+    }
+    while (entry != NULL) {
+        int8_t ret =
+            __unsafe_z_unicast_send_n_msg(ztu, NULL, &entry->_msg, entry->_reliability, entry->_priority, true);
+        if (ret != _Z_RES_OK) {
+            _Z_ERROR("Failed to send a queued network message: %d", ret);
+        }
+        _z_tx_queue_entry_free(&entry);
+        budget--;
+        if (budget > (size_t)0) {
+            entry = _z_tx_queue_pop(ztu->_tx_queue, false);
+        }
+    }
+#if Z_FEATURE_BATCHING == 1
+    if (ztu->_batching == false) {
+        __unsafe_z_unicast_flush(ztu);  // Otherwise the pending batch is flushed as configured by the user
+    }
+#endif
+
+    _z_tx_gate_unlock(&ztu->_gate_tx, &ztu->_mutex_tx);
+}
+
+static int8_t _z_unicast_submit_n_msg(_z_transport_unicast_t *ztu, const _z_network_message_t *n_msg,
+                                      z_reliability_t reliability, z_congestion_control_t cong_ctrl) {
+    int8_t ret = _z_tx_queue_push(ztu->_tx_queue, n_msg, reliability, cong_ctrl);
+    if (ret == _Z_ERR_TRANSPORT_NO_SPACE) {
+        _Z_INFO("Dropping zenoh message because of congestion control");
+        ret = _Z_RES_OK;
+    } else if ((ret == _Z_RES_OK) && (ztu->_tx_task_running == false)) {
+        // The TX task has been stopped in the meantime, it may have exited without sending the message
+        _z_unicast_tx_queue_drain(ztu, NULL);
+    }
+    return ret;
+}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+int8_t _z_unicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg, z_reliability_t reliability,
+                             z_congestion_control_t cong_ctrl) {
+    int8_t ret = _Z_RES_OK;
+    _Z_DEBUG(">> send network message");
+
+    _z_transport_unicast_t *ztu = &zn->_tp._transport._unicast;
+    z_priority_t priority = _z_n_msg_get_priority(n_msg);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    if (ztu->_tx_task_running == true) {
+        return _z_unicast_submit_n_msg(ztu, n_msg, reliability, cong_ctrl);
+    }
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    // Acquire the lock, after the messages of higher priority, and drop the message if needed
+    _Bool drop = false;
+    if (cong_ctrl == Z_CONGESTION_CONTROL_BLOCK) {
+#if Z_FEATURE_MULTI_THREAD == 1
+        _z_tx_gate_lock(&ztu->_gate_tx, &ztu->_mutex_tx, priority);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+    } else {
+#if Z_FEATURE_MULTI_THREAD == 1
+        int8_t locked = _z_tx_gate_trylock(&ztu->_gate_tx, &ztu->_mutex_tx, priority);
+        if (locked != (int8_t)0) {
+            _Z_INFO("Dropping zenoh message because of congestion control");
+            // We failed to acquire the lock, drop the message
+            drop = true;
+        }
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+    }
+
+    if (drop == false) {
+#if Z_FEATURE_BATCHING == 1
+        _Bool batch = ztu->_batching;
+#else
+        _Bool batch = false;
+#endif
+        ret = __unsafe_z_unicast_send_n_msg(ztu, n_msg, NULL, reliability, priority, batch);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+        _z_tx_gate_unlock(&ztu->_gate_tx, &ztu->_mutex_tx);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
     }
 
     return ret;
 }
+
+#if Z_FEATURE_MULTI_THREAD == 1
+void *_zp_unicast_tx_task(void *ztu_arg) {
+    _z_transport_unicast_t *ztu = (_z_transport_unicast_t *)ztu_arg;
+
+    while (ztu->_tx_task_running == true) {
+        // Wait for a message, or to be woken up by the task being stopped
+        _z_unicast_tx_queue_drain(ztu, _z_tx_queue_pop(ztu->_tx_queue, true));
+    }
+    // Send the messages submitted before the task has been stopped
+    _z_unicast_tx_queue_drain(ztu, NULL);
+
+    return 0;
+}
+
+int8_t _zp_unicast_start_tx_task(_z_transport_t *zt, z_task_attr_t *attr, z_task_t *task, size_t queue_size) {
+    _z_transport_unicast_t *ztu = &zt->_transport._unicast;
+    // Wait for a previous task to be done
+    if (ztu->_tx_task != NULL) {
+        _zp_unicast_stop_tx_task(zt);
+        z_task_join(ztu->_tx_task);
+        z_task_free(&ztu->_tx_task);
+    }
+    // The queue is kept until the transport is cleared, a submitter may still hold it
+    if (ztu->_tx_queue == NULL) {
+        ztu->_tx_queue = _z_tx_queue_new(queue_size);
+        if (ztu->_tx_queue == NULL) {
+            return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+    }
+    // Init memory
+    (void)memset(task, 0, sizeof(z_task_t));
+    // Init task
+    ztu->_tx_task_running = true;
+    if (z_task_init(task, attr, _zp_unicast_tx_task, ztu) != _Z_RES_OK) {
+        ztu->_tx_task_running = false;
+        return _Z_ERR_SYSTEM_TASK_FAILED;
+    }
+    // Attach task
+    ztu->_tx_task = task;
+    return _Z_RES_OK;
+}
+
+int8_t _zp_unicast_stop_tx_task(_z_transport_t *zt) {
+    _z_transport_unicast_t *ztu = &zt->_transport._unicast;
+    ztu->_tx_task_running = false;
+    if (ztu->_tx_queue != NULL) {
+        _z_tx_queue_wake(ztu->_tx_queue);
+    }
+    return _Z_RES_OK;
+}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
 #else
+#if Z_FEATURE_BATCHING == 1
+int8_t _z_unicast_batch_start(_z_transport_unicast_t *ztu, uint32_t linger_ms) {
+    _ZP_UNUSED(ztu);
+    _ZP_UNUSED(linger_ms);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+}
+
+int8_t _z_unicast_batch_stop(_z_transport_unicast_t *ztu) {
+    _ZP_UNUSED(ztu);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+}
+
+int8_t _z_unicast_flush(_z_transport_unicast_t *ztu) {
+    _ZP_UNUSED(ztu);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+}
+
+int8_t _z_unicast_flush_expired(_z_transport_unicast_t *ztu) {
+    _ZP_UNUSED(ztu);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+}
+#endif
+
 int8_t _z_unicast_send_t_msg(_z_transport_unicast_t *ztu, const _z_transport_message_t *t_msg) {
     _ZP_UNUSED(ztu);
     _ZP_UNUSED(t_msg);
@@ -184,4 +623,24 @@ int8_t _z_unicast_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg
     _ZP_UNUSED(cong_ctrl);
     return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
 }
+
+#if Z_FEATURE_MULTI_THREAD == 1
+void *_zp_unicast_tx_task(void *ztu_arg) {
+    _ZP_UNUSED(ztu_arg);
+    return NULL;
+}
+
+int8_t _zp_unicast_start_tx_task(_z_transport_t *zt, z_task_attr_t *attr, z_task_t *task, size_t queue_size) {
+    _ZP_UNUSED(zt);
+    _ZP_UNUSED(attr);
+    _ZP_UNUSED(task);
+    _ZP_UNUSED(queue_size);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+}
+
+int8_t _zp_unicast_stop_tx_task(_z_transport_t *zt) {
+    _ZP_UNUSED(zt);
+    return _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
 #endif  // Z_FEATURE_UNICAST_TRANSPORT == 1
@@ -14,7 +14,16 @@
 
 #include "zenoh-pico/transport/utils.h"
 
+#include <stddef.h>
+#include <string.h>
+
+#include "zenoh-pico/protocol/codec/network.h"
 #include "zenoh-pico/protocol/core.h"
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/utils/logging.h"
+#include "zenoh-pico/utils/result.h"
+
+#define _Z_TX_QUEUE_ENTRY_BASE_SIZE 128  // Arbitrary base size of the buffer to encode a queued message
 
 #define U8_MAX 0xFF
 #define U16_MAX 0xFFFF
@@ -116,3 +125,294 @@ void _z_conduit_sn_list_decrement(const _z_zint_t sn_resolution, _z_conduit_sn_l
         }
     }
 }
+
+#if Z_FEATURE_FRAGMENTATION == 1
+int8_t _z_defrag_buf_init(_z_defrag_buf_t *dbuf) {
+    int8_t ret = _Z_RES_OK;
+    dbuf->_drop = false;
+#if Z_FEATURE_DYNAMIC_MEMORY_ALLOCATION == 1
+    // Allocated on the first fragment, when its size is known
+    dbuf->_buf._ios = _z_iosli_wrap(NULL, 0, 0, 0);
+#else
+    dbuf->_buf = _z_zbuf_make(Z_FRAG_MAX_SIZE);
+    if (_z_zbuf_capacity(&dbuf->_buf) != Z_FRAG_MAX_SIZE) {
+        ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    }
+#endif
+    return ret;
+}
+
+int8_t _z_defrag_buf_push(_z_defrag_buf_t *dbuf, const _z_bytes_t *fragment) {
+    if (dbuf->_drop == true) {
+        return _Z_ERR_TRANSPORT_NO_SPACE;
+    }
+
+    size_t len = _z_zbuf_get_wpos(&dbuf->_buf) + fragment->len;
+    if (len > Z_FRAG_MAX_SIZE) {
+        dbuf->_drop = true;
+        return _Z_ERR_TRANSPORT_NO_SPACE;
+    }
+
+    size_t capacity = _z_zbuf_capacity(&dbuf->_buf);
+    if (len > capacity) {
+#if Z_FEATURE_DYNAMIC_MEMORY_ALLOCATION == 1
+        capacity = (capacity == (size_t)0) ? len : capacity * (size_t)2;
+        while (capacity < len) {
+            capacity = capacity * (size_t)2;
+        }
+        if (capacity > (size_t)Z_FRAG_MAX_SIZE) {
+            capacity = Z_FRAG_MAX_SIZE;
+        }
+        uint8_t *buf = (uint8_t *)z_realloc(dbuf->_buf._ios._buf, capacity);
+        if (buf == NULL) {
+            dbuf->_drop = true;
+            return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+        dbuf->_buf._ios._buf = buf;
+        dbuf->_buf._ios._capacity = capacity;
+        dbuf->_buf._ios._is_alloc = true;
+#else
+        dbuf->_drop = true;
+        return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+#endif
+    }
+
+    if (fragment->len > (size_t)0) {
+        (void)memcpy(_z_zbuf_get_wptr(&dbuf->_buf), fragment->start, fragment->len);
+        _z_zbuf_set_wpos(&dbuf->_buf, len);
+    }
+    return _Z_RES_OK;
+}
+
+void _z_defrag_buf_reset(_z_defrag_buf_t *dbuf) {
+    _z_zbuf_reset(&dbuf->_buf);
+    dbuf->_drop = false;
+}
+
+void _z_defrag_buf_clear(_z_defrag_buf_t *dbuf) {
+    _z_zbuf_clear(&dbuf->_buf);
+    dbuf->_buf._ios = _z_iosli_wrap(NULL, 0, 0, 0);
+    dbuf->_drop = false;
+}
+
+void _z_defrag_buf_copy(_z_defrag_buf_t *dst, const _z_defrag_buf_t *src) {
+    _z_iosli_copy(&dst->_buf._ios, &src->_buf._ios);
+    if ((dst->_buf._ios._is_alloc == true) && (dst->_buf._ios._buf == NULL)) {
+        dst->_buf._ios = _z_iosli_wrap(NULL, 0, 0, 0);  // Failed to allocate, start over with an empty buffer
+    }
+    dst->_drop = src->_drop;
+}
+#endif
+
+#if Z_FEATURE_MULTI_THREAD == 1
+int8_t _z_tx_gate_init(_z_tx_gate_t *gate) {
+    gate->_busy = false;
+    int8_t ret = z_mutex_init(&gate->_mutex);
+    size_t i = 0;
+    while ((ret == _Z_RES_OK) && (i < _Z_TX_GATE_PRIORITIES)) {
+        gate->_waiting[i] = 0;
+        gate->_yielded[i] = 0;
+        ret = z_condvar_init(&gate->_cond[i]);
+        if (ret == _Z_RES_OK) {
+            ret = z_condvar_init(&gate->_cond_yielded[i]);
+            if (ret != _Z_RES_OK) {
+                z_condvar_free(&gate->_cond[i]);
+            }
+        }
+        if (ret == _Z_RES_OK) {
+            i++;
+        }
+    }
+    if (ret != _Z_RES_OK) {
+        while (i > (size_t)0) {
+            i--;
+            z_condvar_free(&gate->_cond[i]);
+            z_condvar_free(&gate->_cond_yielded[i]);
+        }
+        z_mutex_free(&gate->_mutex);
+    }
+    return ret;
+}
+
+void _z_tx_gate_clear(_z_tx_gate_t *gate) {
+    for (size_t i = 0; i < _Z_TX_GATE_PRIORITIES; i++) {
+        z_condvar_free(&gate->_cond[i]);
+        z_condvar_free(&gate->_cond_yielded[i]);
+    }
+    z_mutex_free(&gate->_mutex);
+}
+
+// The highest priority with a non-zero count, _Z_TX_GATE_PRIORITIES if there is none
+static size_t _z_tx_gate_first(const size_t *counts) {
+    size_t i = 0;
+    while ((i < _Z_TX_GATE_PRIORITIES) && (counts[i] == (size_t)0)) {
+        i++;
+    }
+    return i;
+}
+
+static inline size_t _z_tx_gate_index(z_priority_t priority) {
+    size_t i = (size_t)priority;
+    return (i < _Z_TX_GATE_PRIORITIES) ? i : _Z_TX_GATE_PRIORITIES - (size_t)1;
+}
+
+// Wake up the sender the gate goes to next, a yielded sender going before the new senders of the same priority
+static void __unsafe_z_tx_gate_notify(_z_tx_gate_t *gate) {
+    size_t waiting = _z_tx_gate_first(gate->_waiting);
+    size_t yielded = _z_tx_gate_first(gate->_yielded);
+    if ((yielded < _Z_TX_GATE_PRIORITIES) && (yielded <= waiting)) {
+        z_condvar_signal(&gate->_cond_yielded[yielded]);
+    } else if (waiting < _Z_TX_GATE_PRIORITIES) {
+        z_condvar_signal(&gate->_cond[waiting]);
+    }
+}
+
+static _Bool __unsafe_z_tx_gate_can_take(const _z_tx_gate_t *gate, size_t prio, _Bool yielded) {
+    if (gate->_busy == true) {
+        return false;
+    }
+    if (_z_tx_gate_first(gate->_waiting) < prio) {
+        return false;
+    }
+    size_t first_yielded = _z_tx_gate_first(gate->_yielded);
+    return (yielded == true) ? (first_yielded >= prio) : (first_yielded > prio);
+}
+
+// Wait until the gate can be taken at the given priority, then take it
+static void __unsafe_z_tx_gate_acquire(_z_tx_gate_t *gate, size_t prio, _Bool yielded) {
+    size_t *counts = (yielded == true) ? gate->_yielded : gate->_waiting;
+    z_condvar_t *cond = (yielded == true) ? &gate->_cond_yielded[prio] : &gate->_cond[prio];
+    counts[prio]++;
+    while (__unsafe_z_tx_gate_can_take(gate, prio, yielded) == false) {
+        z_condvar_wait(cond, &gate->_mutex);
+    }
+    counts[prio]--;
+    gate->_busy = true;
+}
+
+// Free the gate and hand it over to the next sender
+static void __unsafe_z_tx_gate_release(_z_tx_gate_t *gate) {
+    gate->_busy = false;
+    __unsafe_z_tx_gate_notify(gate);
+}
+
+void _z_tx_gate_lock(_z_tx_gate_t *gate, z_mutex_t *mutex_tx, z_priority_t priority) {
+    z_mutex_lock(&gate->_mutex);
+    __unsafe_z_tx_gate_acquire(gate, _z_tx_gate_index(priority), false);
+    z_mutex_unlock(&gate->_mutex);
+
+    // Only the gate owner contends with the senders that bypass the gate, e.g. for transport messages
+    z_mutex_lock(mutex_tx);
+}
+
+int8_t _z_tx_gate_trylock(_z_tx_gate_t *gate, z_mutex_t *mutex_tx, z_priority_t priority) {
+    int8_t ret = -1;
+
+    z_mutex_lock(&gate->_mutex);
+    if (__unsafe_z_tx_gate_can_take(gate, _z_tx_gate_index(priority), false) == true) {
+        ret = z_mutex_trylock(mutex_tx);
+        if (ret == (int8_t)0) {
+            gate->_busy = true;
+        }
+    }
+    z_mutex_unlock(&gate->_mutex);
+
+    return ret;
+}
+
+void _z_tx_gate_unlock(_z_tx_gate_t *gate, z_mutex_t *mutex_tx) {
+    z_mutex_unlock(mutex_tx);
+
+    z_mutex_lock(&gate->_mutex);
+    __unsafe_z_tx_gate_release(gate);
+    z_mutex_unlock(&gate->_mutex);
+}
+
+_Bool _z_tx_gate_yield(_z_tx_gate_t *gate, z_mutex_t *mutex_tx, z_priority_t priority) {
+    size_t prio = _z_tx_gate_index(priority);
+
+    z_mutex_lock(&gate->_mutex);
+    _Bool yield = _z_tx_gate_first(gate->_waiting) < prio;
+    if (yield == true) {
+        z_mutex_unlock(mutex_tx);
+        __unsafe_z_tx_gate_release(gate);
+        __unsafe_z_tx_gate_acquire(gate, prio, true);
+    }
+    z_mutex_unlock(&gate->_mutex);
+
+    if (yield == true) {
+        z_mutex_lock(mutex_tx);
+    }
+    return yield;
+}
+
+/*------------------ TX queue ------------------*/
+void _z_tx_queue_entry_free(_z_tx_queue_entry_t **entry) {
+    _z_tx_queue_entry_t *ptr = *entry;
+    if (ptr != NULL) {
+        _z_bytes_clear(&ptr->_msg);
+        z_free(ptr);
+        *entry = NULL;
+    }
+}
+
+static void _z_tx_queue_elem_free(void **elem) { _z_tx_queue_entry_free((_z_tx_queue_entry_t **)elem); }
+
+_z_tx_queue_t *_z_tx_queue_new(size_t capacity) { return _z_ring_mt_new(capacity, _z_tx_queue_elem_free); }
+
+void _z_tx_queue_free(_z_tx_queue_t **queue) { _z_ring_mt_free(queue); }
+
+size_t _z_tx_queue_capacity(const _z_tx_queue_t *queue) { return _z_ring_mt_capacity(queue); }
+
+// Encode the message on a buffer of its own, taken over from the encoding buffer when it fits in a single slice. The
+// expandable encoding buffer aliases the payloads, which are then copied only once
+static int8_t _z_tx_queue_entry_make(_z_tx_queue_entry_t *entry, const _z_network_message_t *n_msg,
+                                     z_reliability_t reliability) {
+    _z_wbuf_t wbf = _z_wbuf_make(_Z_TX_QUEUE_ENTRY_BASE_SIZE, true);
+    int8_t ret = _z_network_message_encode(&wbf, n_msg);
+    if (ret == _Z_RES_OK) {
+        _z_iosli_t *ios = _z_wbuf_get_iosli(&wbf, 0);
+        if ((_z_wbuf_len_iosli(&wbf) == (size_t)1) && (ios->_is_alloc == true)) {
+            entry->_msg = (_z_bytes_t){.start = ios->_buf, .len = _z_iosli_readable(ios), ._is_alloc = true};
+            ios->_is_alloc = false;
+        } else {
+            _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+            entry->_msg = (_z_bytes_t){.start = zbf._ios._buf, .len = _z_zbuf_len(&zbf), ._is_alloc = true};
+        }
+        if (entry->_msg.start == NULL) {
+            ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+    }
+    _z_wbuf_clear(&wbf);
+    entry->_reliability = reliability;
+    entry->_priority = _z_n_msg_get_priority(n_msg);
+    return ret;
+}
+
+int8_t _z_tx_queue_push(_z_tx_queue_t *queue, const _z_network_message_t *n_msg, z_reliability_t reliability,
+                        z_congestion_control_t cong_ctrl) {
+    _z_tx_queue_entry_t *entry = (_z_tx_queue_entry_t *)z_malloc(sizeof(_z_tx_queue_entry_t));
+    if (entry == NULL) {
+        return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    }
+    int8_t ret = _z_tx_queue_entry_make(entry, n_msg, reliability);
+    if (ret != _Z_RES_OK) {
+        _z_tx_queue_entry_free(&entry);
+        return ret;
+    }
+
+    if (cong_ctrl == Z_CONGESTION_CONTROL_BLOCK) {
+        (void)_z_ring_mt_push(queue, entry);  // The queue is never closed, the entry is always pushed
+    } else if (_z_ring_mt_try_push(queue, entry) == false) {
+        _z_tx_queue_entry_free(&entry);
+        ret = _Z_ERR_TRANSPORT_NO_SPACE;
+    }
+    return ret;
+}
+
+_z_tx_queue_entry_t *_z_tx_queue_pop(_z_tx_queue_t *queue, _Bool wait) {
+    return (_z_tx_queue_entry_t *)((wait == true) ? _z_ring_mt_pull(queue) : _z_ring_mt_try_pull(queue));
+}
+
+void _z_tx_queue_wake(_z_tx_queue_t *queue) { _z_ring_mt_wake(queue); }
+#endif  // Z_FEATURE_MULTI_THREAD == 1
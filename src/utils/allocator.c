@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/utils/allocator.h"
+
+#include <stddef.h>
+
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/utils/pool.h"
+#include "zenoh-pico/utils/result.h"
+
+/*------------------ Allocator ------------------*/
+static void *_z_default_alloc(size_t size, void *ctx) {
+    _ZP_UNUSED(ctx);
+#if Z_FEATURE_MEMORY_POOLS == 1
+    return _z_pool_malloc(size);
+#else
+    return _z_platform_malloc(size);
+#endif
+}
+
+static void *_z_default_realloc(void *ptr, size_t size, void *ctx) {
+    _ZP_UNUSED(ctx);
+#if Z_FEATURE_MEMORY_POOLS == 1
+    return _z_pool_realloc(ptr, size);
+#else
+    return _z_platform_realloc(ptr, size);
+#endif
+}
+
+static void _z_default_free(void *ptr, void *ctx) {
+    _ZP_UNUSED(ctx);
+#if Z_FEATURE_MEMORY_POOLS == 1
+    _z_pool_free(ptr);
+#else
+    _z_platform_free(ptr);
+#endif
+}
+
+static _z_allocator_t _z_allocator = {
+    .alloc_fn = _z_default_alloc, .realloc_fn = _z_default_realloc, .free_fn = _z_default_free, .ctx = NULL};
+
+int8_t _z_allocator_set(const _z_allocator_t *allocator) {
+    if (allocator == NULL) {
+        _z_allocator = (_z_allocator_t){
+            .alloc_fn = _z_default_alloc, .realloc_fn = _z_default_realloc, .free_fn = _z_default_free, .ctx = NULL};
+        return _Z_RES_OK;
+    }
+    if ((allocator->alloc_fn == NULL) || (allocator->realloc_fn == NULL) || (allocator->free_fn == NULL)) {
+        return _Z_ERR_GENERIC;
+    }
+    _z_allocator = *allocator;
+    return _Z_RES_OK;
+}
+
+void *z_malloc(size_t size) { return _z_allocator.alloc_fn(size, _z_allocator.ctx); }
+
+void *z_realloc(void *ptr, size_t size) { return _z_allocator.realloc_fn(ptr, size, _z_allocator.ctx); }
+
+void z_free(void *ptr) { _z_allocator.free_fn(ptr, _z_allocator.ctx); }
+
+/*------------------ Arena ------------------*/
+#define _Z_ARENA_ALIGN sizeof(uint64_t)
+
+int8_t _z_arena_init(_z_arena_t *arena, size_t capacity) {
+    arena->_len = 0;
+    arena->_capacity = 0;
+    arena->_start = NULL;
+    if (capacity == (size_t)0) {
+        return _Z_RES_OK;
+    }
+    arena->_start = (uint8_t *)z_malloc(capacity);
+    if (arena->_start == NULL) {
+        return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    }
+    arena->_capacity = capacity;
+    return _Z_RES_OK;
+}
+
+void _z_arena_clear(_z_arena_t *arena) {
+    z_free(arena->_start);
+    arena->_start = NULL;
+    arena->_capacity = 0;
+    arena->_len = 0;
+}
+
+_Bool _z_arena_owns(const _z_arena_t *arena, const void *ptr) {
+    uintptr_t addr = (uintptr_t)ptr;
+    uintptr_t start = (uintptr_t)arena->_start;
+    return (arena->_start != NULL) && (addr >= start) && (addr < start + arena->_capacity);
+}
+
+void *_z_arena_alloc(_z_arena_t *arena, size_t size) {
+    if (arena != NULL) {
+        size_t len = (size + _Z_ARENA_ALIGN - 1) & ~(_Z_ARENA_ALIGN - 1);
+        if (len <= arena->_capacity - arena->_len) {
+            void *ptr = &arena->_start[arena->_len];
+            arena->_len += len;
+            return ptr;
+        }
+    }
+    return z_malloc(size);
+}
+
+void _z_arena_free(_z_arena_t *arena, void *ptr) {
+    if ((arena == NULL) || (_z_arena_owns(arena, ptr) == false)) {
+        z_free(ptr);
+    }
+}
@@ -14,8 +14,11 @@
 
 #include "zenoh-pico/utils/checksum.h"
 
+#include "zenoh-pico/config.h"
+
 #define __CRC_POLYNOMIAL 0x04C11DB7
 
+#if Z_CRC32_TABLES == 0
 uint32_t _z_crc32(const uint8_t *message, size_t len) {
     uint32_t crc = 0xFFFFFFFF;
     for (size_t i = 0; i < len; i++) {
@@ -26,3 +29,314 @@ uint32_t _z_crc32(const uint8_t *message, size_t len) {
     }
     return ~crc;
 }
+#elif Z_CRC32_TABLES == 1 || Z_CRC32_TABLES == 8
+/**
+ * Table ``0`` holds the CRC of each byte value, i.e. the 8 steps of the bitwise loop for that byte. Table ``k`` holds
+ * the CRC of each byte value followed by ``k`` zero bytes, so that slicing-by-8 folds 8 bytes with 8 lookups.
+ *
+ * The tables are constant so that they stay in flash, they have been generated with:
+ *     T[0][i] = 8 bitwise steps of __CRC_POLYNOMIAL over i
+ *     T[k][i] = (T[k - 1][i] >> 8) ^ T[0][T[k - 1][i] & 0xFF]
+ */
+static const uint32_t _z_crc32_table[Z_CRC32_TABLES][256] = {
+    {
+        0x00000000, 0x06233697, 0x05c45641, 0x03e760d6, 0x020a97ed, 0x0429a17a, 0x07cec1ac, 0x01edf73b,
+        0x04152fda, 0x0236194d, 0x01d1799b, 0x07f24f0c, 0x061fb837, 0x003c8ea0, 0x03dbee76, 0x05f8d8e1,
+        0x01a864db, 0x078b524c, 0x046c329a, 0x024f040d, 0x03a2f336, 0x0581c5a1, 0x0666a577, 0x004593e0,
+        0x05bd4b01, 0x039e7d96, 0x00791d40, 0x065a2bd7, 0x07b7dcec, 0x0194ea7b, 0x02738aad, 0x0450bc3a,
+        0x0350c9b6, 0x0573ff21, 0x06949ff7, 0x00b7a960, 0x015a5e5b, 0x077968cc, 0x049e081a, 0x02bd3e8d,
+        0x0745e66c, 0x0166d0fb, 0x0281b02d, 0x04a286ba, 0x054f7181, 0x036c4716, 0x008b27c0, 0x06a81157,
+        0x02f8ad6d, 0x04db9bfa, 0x073cfb2c, 0x011fcdbb, 0x00f23a80, 0x06d10c17, 0x05366cc1, 0x03155a56,
+        0x06ed82b7, 0x00ceb420, 0x0329d4f6, 0x050ae261, 0x04e7155a, 0x02c423cd, 0x0123431b, 0x0700758c,
+        0x06a1936c, 0x0082a5fb, 0x0365c52d, 0x0546f3ba, 0x04ab0481, 0x02883216, 0x016f52c0, 0x074c6457,
+        0x02b4bcb6, 0x04978a21, 0x0770eaf7, 0x0153dc60, 0x00be2b5b, 0x069d1dcc, 0x057a7d1a, 0x03594b8d,
+        0x0709f7b7, 0x012ac120, 0x02cda1f6, 0x04ee9761, 0x0503605a, 0x032056cd, 0x00c7361b, 0x06e4008c,
+        0x031cd86d, 0x053feefa, 0x06d88e2c, 0x00fbb8bb, 0x01164f80, 0x07357917, 0x04d219c1, 0x02f12f56,
+        0x05f15ada, 0x03d26c4d, 0x00350c9b, 0x06163a0c, 0x07fbcd37, 0x01d8fba0, 0x023f9b76, 0x041cade1,
+        0x01e47500, 0x07c74397, 0x04202341, 0x020315d6, 0x03eee2ed, 0x05cdd47a, 0x062ab4ac, 0x0009823b,
+        0x04593e01, 0x027a0896, 0x019d6840, 0x07be5ed7, 0x0653a9ec, 0x00709f7b, 0x0397ffad, 0x05b4c93a,
+        0x004c11db, 0x066f274c, 0x0588479a, 0x03ab710d, 0x02468636, 0x0465b0a1, 0x0782d077, 0x01a1e6e0,
+        0x04c11db7, 0x02e22b20, 0x01054bf6, 0x07267d61, 0x06cb8a5a, 0x00e8bccd, 0x030fdc1b, 0x052cea8c,
+        0x00d4326d, 0x06f704fa, 0x0510642c, 0x033352bb, 0x02dea580, 0x04fd9317, 0x071af3c1, 0x0139c556,
+        0x0569796c, 0x034a4ffb, 0x00ad2f2d, 0x068e19ba, 0x0763ee81, 0x0140d816, 0x02a7b8c0, 0x04848e57,
+        0x017c56b6, 0x075f6021, 0x04b800f7, 0x029b3660, 0x0376c15b, 0x0555f7cc, 0x06b2971a, 0x0091a18d,
+        0x0791d401, 0x01b2e296, 0x02558240, 0x0476b4d7, 0x059b43ec, 0x03b8757b, 0x005f15ad, 0x067c233a,
+        0x0384fbdb, 0x05a7cd4c, 0x0640ad9a, 0x00639b0d, 0x018e6c36, 0x07ad5aa1, 0x044a3a77, 0x02690ce0,
+        0x0639b0da, 0x001a864d, 0x03fde69b, 0x05ded00c, 0x04332737, 0x021011a0, 0x01f77176, 0x07d447e1,
+        0x022c9f00, 0x040fa997, 0x07e8c941, 0x01cbffd6, 0x002608ed, 0x06053e7a, 0x05e25eac, 0x03c1683b,
+        0x02608edb, 0x0443b84c, 0x07a4d89a, 0x0187ee0d, 0x006a1936, 0x06492fa1, 0x05ae4f77, 0x038d79e0,
+        0x0675a101, 0x00569796, 0x03b1f740, 0x0592c1d7, 0x047f36ec, 0x025c007b, 0x01bb60ad, 0x0798563a,
+        0x03c8ea00, 0x05ebdc97, 0x060cbc41, 0x002f8ad6, 0x01c27ded, 0x07e14b7a, 0x04062bac, 0x02251d3b,
+        0x07ddc5da, 0x01fef34d, 0x0219939b, 0x043aa50c, 0x05d75237, 0x03f464a0, 0x00130476, 0x063032e1,
+        0x0130476d, 0x071371fa, 0x04f4112c, 0x02d727bb, 0x033ad080, 0x0519e617, 0x06fe86c1, 0x00ddb056,
+        0x052568b7, 0x03065e20, 0x00e13ef6, 0x06c20861, 0x072fff5a, 0x010cc9cd, 0x02eba91b, 0x04c89f8c,
+        0x009823b6, 0x06bb1521, 0x055c75f7, 0x037f4360, 0x0292b45b, 0x04b182cc, 0x0756e21a, 0x0175d48d,
+        0x048d0c6c, 0x02ae3afb, 0x01495a2d, 0x076a6cba, 0x06879b81, 0x00a4ad16, 0x0343cdc0, 0x0560fb57
+    },
+#if Z_CRC32_TABLES == 8
+    {
+        0x00000000, 0x0482ad61, 0x008761ad, 0x0405cccc, 0x010ec35a, 0x058c6e3b, 0x0189a2f7, 0x050b0f96,
+        0x021d86b4, 0x069f2bd5, 0x029ae719, 0x06184a78, 0x031345ee, 0x0791e88f, 0x03942443, 0x07168922,
+        0x043b0d68, 0x00b9a009, 0x04bc6cc5, 0x003ec1a4, 0x0535ce32, 0x01b76353, 0x05b2af9f, 0x013002fe,
+        0x06268bdc, 0x02a426bd, 0x06a1ea71, 0x02234710, 0x07284886, 0x03aae5e7, 0x07af292b, 0x032d844a,
+        0x01f421bf, 0x05768cde, 0x01734012, 0x05f1ed73, 0x00fae2e5, 0x04784f84, 0x007d8348, 0x04ff2e29,
+        0x03e9a70b, 0x076b0a6a, 0x036ec6a6, 0x07ec6bc7, 0x02e76451, 0x0665c930, 0x026005fc, 0x06e2a89d,
+        0x05cf2cd7, 0x014d81b6, 0x05484d7a, 0x01cae01b, 0x04c1ef8d, 0x004342ec, 0x04468e20, 0x00c42341,
+        0x07d2aa63, 0x03500702, 0x0755cbce, 0x03d766af, 0x06dc6939, 0x025ec458, 0x065b0894, 0x02d9a5f5,
+        0x03e8437e, 0x076aee1f, 0x036f22d3, 0x07ed8fb2, 0x02e68024, 0x06642d45, 0x0261e189, 0x06e34ce8,
+        0x01f5c5ca, 0x057768ab, 0x0172a467, 0x05f00906, 0x00fb0690, 0x0479abf1, 0x007c673d, 0x04feca5c,
+        0x07d34e16, 0x0351e377, 0x07542fbb, 0x03d682da, 0x06dd8d4c, 0x025f202d, 0x065aece1, 0x02d84180,
+        0x05cec8a2, 0x014c65c3, 0x0549a90f, 0x01cb046e, 0x04c00bf8, 0x0042a699, 0x04476a55, 0x00c5c734,
+        0x021c62c1, 0x069ecfa0, 0x029b036c, 0x0619ae0d, 0x0312a19b, 0x07900cfa, 0x0395c036, 0x07176d57,
+        0x0001e475, 0x04834914, 0x008685d8, 0x040428b9, 0x010f272f, 0x058d8a4e, 0x01884682, 0x050aebe3,
+        0x06276fa9, 0x02a5c2c8, 0x06a00e04, 0x0222a365, 0x0729acf3, 0x03ab0192, 0x07aecd5e, 0x032c603f,
+        0x043ae91d, 0x00b8447c, 0x04bd88b0, 0x003f25d1, 0x05342a47, 0x01b68726, 0x05b34bea, 0x0131e68b,
+        0x07d086fc, 0x03522b9d, 0x0757e751, 0x03d54a30, 0x06de45a6, 0x025ce8c7, 0x0659240b, 0x02db896a,
+        0x05cd0048, 0x014fad29, 0x054a61e5, 0x01c8cc84, 0x04c3c312, 0x00416e73, 0x0444a2bf, 0x00c60fde,
+        0x03eb8b94, 0x076926f5, 0x036cea39, 0x07ee4758, 0x02e548ce, 0x0667e5af, 0x02622963, 0x06e08402,
+        0x01f60d20, 0x0574a041, 0x01716c8d, 0x05f3c1ec, 0x00f8ce7a, 0x047a631b, 0x007fafd7, 0x04fd02b6,
+        0x0624a743, 0x02a60a22, 0x06a3c6ee, 0x02216b8f, 0x072a6419, 0x03a8c978, 0x07ad05b4, 0x032fa8d5,
+        0x043921f7, 0x00bb8c96, 0x04be405a, 0x003ced3b, 0x0537e2ad, 0x01b54fcc, 0x05b08300, 0x01322e61,
+        0x021faa2b, 0x069d074a, 0x0298cb86, 0x061a66e7, 0x03116971, 0x0793c410, 0x039608dc, 0x0714a5bd,
+        0x00022c9f, 0x048081fe, 0x00854d32, 0x0407e053, 0x010cefc5, 0x058e42a4, 0x018b8e68, 0x05092309,
+        0x0438c582, 0x00ba68e3, 0x04bfa42f, 0x003d094e, 0x053606d8, 0x01b4abb9, 0x05b16775, 0x0133ca14,
+        0x06254336, 0x02a7ee57, 0x06a2229b, 0x02208ffa, 0x072b806c, 0x03a92d0d, 0x07ace1c1, 0x032e4ca0,
+        0x0003c8ea, 0x0481658b, 0x0084a947, 0x04060426, 0x010d0bb0, 0x058fa6d1, 0x018a6a1d, 0x0508c77c,
+        0x021e4e5e, 0x069ce33f, 0x02992ff3, 0x061b8292, 0x03108d04, 0x07922065, 0x0397eca9, 0x071541c8,
+        0x05cce43d, 0x014e495c, 0x054b8590, 0x01c928f1, 0x04c22767, 0x00408a06, 0x044546ca, 0x00c7ebab,
+        0x07d16289, 0x0353cfe8, 0x07560324, 0x03d4ae45, 0x06dfa1d3, 0x025d0cb2, 0x0658c07e, 0x02da6d1f,
+        0x01f7e955, 0x05754434, 0x017088f8, 0x05f22599, 0x00f92a0f, 0x047b876e, 0x007e4ba2, 0x04fce6c3,
+        0x03ea6fe1, 0x0768c280, 0x036d0e4c, 0x07efa32d, 0x02e4acbb, 0x066601da, 0x0263cd16, 0x06e16077
+    },
+    {
+        0x00000000, 0x03d6eee0, 0x07adddc0, 0x047b3320, 0x06d980ef, 0x050f6e0f, 0x01745d2f, 0x02a2b3cf,
+        0x04313ab1, 0x07e7d451, 0x039ce771, 0x004a0991, 0x02e8ba5e, 0x013e54be, 0x0545679e, 0x0693897e,
+        0x01e04e0d, 0x0236a0ed, 0x064d93cd, 0x059b7d2d, 0x0739cee2, 0x04ef2002, 0x00941322, 0x0342fdc2,
+        0x05d174bc, 0x06079a5c, 0x027ca97c, 0x01aa479c, 0x0308f453, 0x00de1ab3, 0x04a52993, 0x0773c773,
+        0x03c09c1a, 0x001672fa, 0x046d41da, 0x07bbaf3a, 0x05191cf5, 0x06cff215, 0x02b4c135, 0x01622fd5,
+        0x07f1a6ab, 0x0427484b, 0x005c7b6b, 0x038a958b, 0x01282644, 0x02fec8a4, 0x0685fb84, 0x05531564,
+        0x0220d217, 0x01f63cf7, 0x058d0fd7, 0x065be137, 0x04f952f8, 0x072fbc18, 0x03548f38, 0x008261d8,
+        0x0611e8a6, 0x05c70646, 0x01bc3566, 0x026adb86, 0x00c86849, 0x031e86a9, 0x0765b589, 0x04b35b69,
+        0x07813834, 0x0457d6d4, 0x002ce5f4, 0x03fa0b14, 0x0158b8db, 0x028e563b, 0x06f5651b, 0x05238bfb,
+        0x03b00285, 0x0066ec65, 0x041ddf45, 0x07cb31a5, 0x0569826a, 0x06bf6c8a, 0x02c45faa, 0x0112b14a,
+        0x06617639, 0x05b798d9, 0x01ccabf9, 0x021a4519, 0x00b8f6d6, 0x036e1836, 0x07152b16, 0x04c3c5f6,
+        0x02504c88, 0x0186a268, 0x05fd9148, 0x062b7fa8, 0x0489cc67, 0x075f2287, 0x032411a7, 0x00f2ff47,
+        0x0441a42e, 0x07974ace, 0x03ec79ee, 0x003a970e, 0x029824c1, 0x014eca21, 0x0535f901, 0x06e317e1,
+        0x00709e9f, 0x03a6707f, 0x07dd435f, 0x040badbf, 0x06a91e70, 0x057ff090, 0x0104c3b0, 0x02d22d50,
+        0x05a1ea23, 0x067704c3, 0x020c37e3, 0x01dad903, 0x03786acc, 0x00ae842c, 0x04d5b70c, 0x070359ec,
+        0x0190d092, 0x02463e72, 0x063d0d52, 0x05ebe3b2, 0x0749507d, 0x049fbe9d, 0x00e48dbd, 0x0332635d,
+        0x06804b07, 0x0556a5e7, 0x012d96c7, 0x02fb7827, 0x0059cbe8, 0x038f2508, 0x07f41628, 0x0422f8c8,
+        0x02b171b6, 0x01679f56, 0x051cac76, 0x06ca4296, 0x0468f159, 0x07be1fb9, 0x03c52c99, 0x0013c279,
+        0x0760050a, 0x04b6ebea, 0x00cdd8ca, 0x031b362a, 0x01b985e5, 0x026f6b05, 0x06145825, 0x05c2b6c5,
+        0x03513fbb, 0x0087d15b, 0x04fce27b, 0x072a0c9b, 0x0588bf54, 0x065e51b4, 0x02256294, 0x01f38c74,
+        0x0540d71d, 0x069639fd, 0x02ed0add, 0x013be43d, 0x039957f2, 0x004fb912, 0x04348a32, 0x07e264d2,
+        0x0171edac, 0x02a7034c, 0x06dc306c, 0x050ade8c, 0x07a86d43, 0x047e83a3, 0x0005b083, 0x03d35e63,
+        0x04a09910, 0x077677f0, 0x030d44d0, 0x00dbaa30, 0x027919ff, 0x01aff71f, 0x05d4c43f, 0x06022adf,
+        0x0091a3a1, 0x03474d41, 0x073c7e61, 0x04ea9081, 0x0648234e, 0x059ecdae, 0x01e5fe8e, 0x0233106e,
+        0x01017333, 0x02d79dd3, 0x06acaef3, 0x057a4013, 0x07d8f3dc, 0x040e1d3c, 0x00752e1c, 0x03a3c0fc,
+        0x05304982, 0x06e6a762, 0x029d9442, 0x014b7aa2, 0x03e9c96d, 0x003f278d, 0x044414ad, 0x0792fa4d,
+        0x00e13d3e, 0x0337d3de, 0x074ce0fe, 0x049a0e1e, 0x0638bdd1, 0x05ee5331, 0x01956011, 0x02438ef1,
+        0x04d0078f, 0x0706e96f, 0x037dda4f, 0x00ab34af, 0x02098760, 0x01df6980, 0x05a45aa0, 0x0672b440,
+        0x02c1ef29, 0x011701c9, 0x056c32e9, 0x06badc09, 0x04186fc6, 0x07ce8126, 0x03b5b206, 0x00635ce6,
+        0x06f0d598, 0x05263b78, 0x015d0858, 0x028be6b8, 0x00295577, 0x03ffbb97, 0x078488b7, 0x04526657,
+        0x0321a124, 0x00f74fc4, 0x048c7ce4, 0x075a9204, 0x05f821cb, 0x062ecf2b, 0x0255fc0b, 0x018312eb,
+        0x07109b95, 0x04c67575, 0x00bd4655, 0x036ba8b5, 0x01c91b7a, 0x021ff59a, 0x0664c6ba, 0x05b2285a
+    },
+    {
+        0x00000000, 0x01339183, 0x02672306, 0x0354b285, 0x04ce460c, 0x05fdd78f, 0x06a9650a, 0x079af489,
+        0x001eb777, 0x012d26f4, 0x02799471, 0x034a05f2, 0x04d0f17b, 0x05e360f8, 0x06b7d27d, 0x078443fe,
+        0x003d6eee, 0x010eff6d, 0x025a4de8, 0x0369dc6b, 0x04f328e2, 0x05c0b961, 0x06940be4, 0x07a79a67,
+        0x0023d999, 0x0110481a, 0x0244fa9f, 0x03776b1c, 0x04ed9f95, 0x05de0e16, 0x068abc93, 0x07b92d10,
+        0x007adddc, 0x01494c5f, 0x021dfeda, 0x032e6f59, 0x04b49bd0, 0x05870a53, 0x06d3b8d6, 0x07e02955,
+        0x00646aab, 0x0157fb28, 0x020349ad, 0x0330d82e, 0x04aa2ca7, 0x0599bd24, 0x06cd0fa1, 0x07fe9e22,
+        0x0047b332, 0x017422b1, 0x02209034, 0x031301b7, 0x0489f53e, 0x05ba64bd, 0x06eed638, 0x07dd47bb,
+        0x00590445, 0x016a95c6, 0x023e2743, 0x030db6c0, 0x04974249, 0x05a4d3ca, 0x06f0614f, 0x07c3f0cc,
+        0x00f5bbb8, 0x01c62a3b, 0x029298be, 0x03a1093d, 0x043bfdb4, 0x05086c37, 0x065cdeb2, 0x076f4f31,
+        0x00eb0ccf, 0x01d89d4c, 0x028c2fc9, 0x03bfbe4a, 0x04254ac3, 0x0516db40, 0x064269c5, 0x0771f846,
+        0x00c8d556, 0x01fb44d5, 0x02aff650, 0x039c67d3, 0x0406935a, 0x053502d9, 0x0661b05c, 0x075221df,
+        0x00d66221, 0x01e5f3a2, 0x02b14127, 0x0382d0a4, 0x0418242d, 0x052bb5ae, 0x067f072b, 0x074c96a8,
+        0x008f6664, 0x01bcf7e7, 0x02e84562, 0x03dbd4e1, 0x04412068, 0x0572b1eb, 0x0626036e, 0x071592ed,
+        0x0091d113, 0x01a24090, 0x02f6f215, 0x03c56396, 0x045f971f, 0x056c069c, 0x0638b419, 0x070b259a,
+        0x00b2088a, 0x01819909, 0x02d52b8c, 0x03e6ba0f, 0x047c4e86, 0x054fdf05, 0x061b6d80, 0x0728fc03,
+        0x00acbffd, 0x019f2e7e, 0x02cb9cfb, 0x03f80d78, 0x0462f9f1, 0x05516872, 0x0605daf7, 0x07364b74,
+        0x01eb7770, 0x00d8e6f3, 0x038c5476, 0x02bfc5f5, 0x0525317c, 0x0416a0ff, 0x0742127a, 0x067183f9,
+        0x01f5c007, 0x00c65184, 0x0392e301, 0x02a17282, 0x053b860b, 0x04081788, 0x075ca50d, 0x066f348e,
+        0x01d6199e, 0x00e5881d, 0x03b13a98, 0x0282ab1b, 0x05185f92, 0x042bce11, 0x077f7c94, 0x064ced17,
+        0x01c8aee9, 0x00fb3f6a, 0x03af8def, 0x029c1c6c, 0x0506e8e5, 0x04357966, 0x0761cbe3, 0x06525a60,
+        0x0191aaac, 0x00a23b2f, 0x03f689aa, 0x02c51829, 0x055feca0, 0x046c7d23, 0x0738cfa6, 0x060b5e25,
+        0x018f1ddb, 0x00bc8c58, 0x03e83edd, 0x02dbaf5e, 0x05415bd7, 0x0472ca54, 0x072678d1, 0x0615e952,
+        0x01acc442, 0x009f55c1, 0x03cbe744, 0x02f876c7, 0x0562824e, 0x045113cd, 0x0705a148, 0x063630cb,
+        0x01b27335, 0x0081e2b6, 0x03d55033, 0x02e6c1b0, 0x057c3539, 0x044fa4ba, 0x071b163f, 0x062887bc,
+        0x011eccc8, 0x002d5d4b, 0x0379efce, 0x024a7e4d, 0x05d08ac4, 0x04e31b47, 0x07b7a9c2, 0x06843841,
+        0x01007bbf, 0x0033ea3c, 0x036758b9, 0x0254c93a, 0x05ce3db3, 0x04fdac30, 0x07a91eb5, 0x069a8f36,
+        0x0123a226, 0x001033a5, 0x03448120, 0x027710a3, 0x05ede42a, 0x04de75a9, 0x078ac72c, 0x06b956af,
+        0x013d1551, 0x000e84d2, 0x035a3657, 0x0269a7d4, 0x05f3535d, 0x04c0c2de, 0x0794705b, 0x06a7e1d8,
+        0x01641114, 0x00578097, 0x03033212, 0x0230a391, 0x05aa5718, 0x0499c69b, 0x07cd741e, 0x06fee59d,
+        0x017aa663, 0x004937e0, 0x031d8565, 0x022e14e6, 0x05b4e06f, 0x048771ec, 0x07d3c369, 0x06e052ea,
+        0x01597ffa, 0x006aee79, 0x033e5cfc, 0x020dcd7f, 0x059739f6, 0x04a4a875, 0x07f01af0, 0x06c38b73,
+        0x0147c88d, 0x0074590e, 0x0320eb8b, 0x02137a08, 0x05898e81, 0x04ba1f02, 0x07eead87, 0x06dd3c04
+    },
+    {
+        0x00000000, 0x07274ef0, 0x07cca68f, 0x00ebe87f, 0x061b7671, 0x013c3881, 0x01d7d0fe, 0x06f09e0e,
+        0x05b4d78d, 0x0293997d, 0x02787102, 0x055f3ff2, 0x03afa1fc, 0x0488ef0c, 0x04630773, 0x03444983,
+        0x02eb9475, 0x05ccda85, 0x052732fa, 0x02007c0a, 0x04f0e204, 0x03d7acf4, 0x033c448b, 0x041b0a7b,
+        0x075f43f8, 0x00780d08, 0x0093e577, 0x07b4ab87, 0x01443589, 0x06637b79, 0x06889306, 0x01afddf6,
+        0x05d728ea, 0x02f0661a, 0x021b8e65, 0x053cc095, 0x03cc5e9b, 0x04eb106b, 0x0400f814, 0x0327b6e4,
+        0x0063ff67, 0x0744b197, 0x07af59e8, 0x00881718, 0x06788916, 0x015fc7e6, 0x01b42f99, 0x06936169,
+        0x073cbc9f, 0x001bf26f, 0x00f01a10, 0x07d754e0, 0x0127caee, 0x0600841e, 0x06eb6c61, 0x01cc2291,
+        0x02886b12, 0x05af25e2, 0x0544cd9d, 0x0263836d, 0x04931d63, 0x03b45393, 0x035fbbec, 0x0478f51c,
+        0x022c6abb, 0x050b244b, 0x05e0cc34, 0x02c782c4, 0x04371cca, 0x0310523a, 0x03fbba45, 0x04dcf4b5,
+        0x0798bd36, 0x00bff3c6, 0x00541bb9, 0x07735549, 0x0183cb47, 0x06a485b7, 0x064f6dc8, 0x01682338,
+        0x00c7fece, 0x07e0b03e, 0x070b5841, 0x002c16b1, 0x06dc88bf, 0x01fbc64f, 0x01102e30, 0x063760c0,
+        0x05732943, 0x025467b3, 0x02bf8fcc, 0x0598c13c, 0x03685f32, 0x044f11c2, 0x04a4f9bd, 0x0383b74d,
+        0x07fb4251, 0x00dc0ca1, 0x0037e4de, 0x0710aa2e, 0x01e03420, 0x06c77ad0, 0x062c92af, 0x010bdc5f,
+        0x024f95dc, 0x0568db2c, 0x05833353, 0x02a47da3, 0x0454e3ad, 0x0373ad5d, 0x03984522, 0x04bf0bd2,
+        0x0510d624, 0x023798d4, 0x02dc70ab, 0x05fb3e5b, 0x030ba055, 0x042ceea5, 0x04c706da, 0x03e0482a,
+        0x00a401a9, 0x07834f59, 0x0768a726, 0x004fe9d6, 0x06bf77d8, 0x01983928, 0x0173d157, 0x06549fa7,
+        0x0458d576, 0x037f9b86, 0x039473f9, 0x04b33d09, 0x0243a307, 0x0564edf7, 0x058f0588, 0x02a84b78,
+        0x01ec02fb, 0x06cb4c0b, 0x0620a474, 0x0107ea84, 0x07f7748a, 0x00d03a7a, 0x003bd205, 0x071c9cf5,
+        0x06b34103, 0x01940ff3, 0x017fe78c, 0x0658a97c, 0x00a83772, 0x078f7982, 0x076491fd, 0x0043df0d,
+        0x0307968e, 0x0420d87e, 0x04cb3001, 0x03ec7ef1, 0x051ce0ff, 0x023bae0f, 0x02d04670, 0x05f70880,
+        0x018ffd9c, 0x06a8b36c, 0x06435b13, 0x016415e3, 0x07948bed, 0x00b3c51d, 0x00582d62, 0x077f6392,
+        0x043b2a11, 0x031c64e1, 0x03f78c9e, 0x04d0c26e, 0x02205c60, 0x05071290, 0x05ecfaef, 0x02cbb41f,
+        0x036469e9, 0x04432719, 0x04a8cf66, 0x038f8196, 0x057f1f98, 0x02585168, 0x02b3b917, 0x0594f7e7,
+        0x06d0be64, 0x01f7f094, 0x011c18eb, 0x063b561b, 0x00cbc815, 0x07ec86e5, 0x07076e9a, 0x0020206a,
+        0x0674bfcd, 0x0153f13d, 0x01b81942, 0x069f57b2, 0x006fc9bc, 0x0748874c, 0x07a36f33, 0x008421c3,
+        0x03c06840, 0x04e726b0, 0x040ccecf, 0x032b803f, 0x05db1e31, 0x02fc50c1, 0x0217b8be, 0x0530f64e,
+        0x049f2bb8, 0x03b86548, 0x03538d37, 0x0474c3c7, 0x02845dc9, 0x05a31339, 0x0548fb46, 0x026fb5b6,
+        0x012bfc35, 0x060cb2c5, 0x06e75aba, 0x01c0144a, 0x07308a44, 0x0017c4b4, 0x00fc2ccb, 0x07db623b,
+        0x03a39727, 0x0484d9d7, 0x046f31a8, 0x03487f58, 0x05b8e156, 0x029fafa6, 0x027447d9, 0x05530929,
+        0x061740aa, 0x01300e5a, 0x01dbe625, 0x06fca8d5, 0x000c36db, 0x072b782b, 0x07c09054, 0x00e7dea4,
+        0x01480352, 0x066f4da2, 0x0684a5dd, 0x01a3eb2d, 0x07537523, 0x00743bd3, 0x009fd3ac, 0x07b89d5c,
+        0x04fcd4df, 0x03db9a2f, 0x03307250, 0x04173ca0, 0x02e7a2ae, 0x05c0ec5e, 0x052b0421, 0x020c4ad1
+    },
+    {
+        0x00000000, 0x009f04f8, 0x013e09f0, 0x01a10d08, 0x027c13e0, 0x02e31718, 0x03421a10, 0x03dd1ee8,
+        0x04f827c0, 0x04672338, 0x05c62e30, 0x05592ac8, 0x06843420, 0x061b30d8, 0x07ba3dd0, 0x07253928,
+        0x007274ef, 0x00ed7017, 0x014c7d1f, 0x01d379e7, 0x020e670f, 0x029163f7, 0x03306eff, 0x03af6a07,
+        0x048a532f, 0x041557d7, 0x05b45adf, 0x052b5e27, 0x06f640cf, 0x06694437, 0x07c8493f, 0x07574dc7,
+        0x00e4e9de, 0x007bed26, 0x01dae02e, 0x0145e4d6, 0x0298fa3e, 0x0207fec6, 0x03a6f3ce, 0x0339f736,
+        0x041cce1e, 0x0483cae6, 0x0522c7ee, 0x05bdc316, 0x0660ddfe, 0x06ffd906, 0x075ed40e, 0x07c1d0f6,
+        0x00969d31, 0x000999c9, 0x01a894c1, 0x01379039, 0x02ea8ed1, 0x02758a29, 0x03d48721, 0x034b83d9,
+        0x046ebaf1, 0x04f1be09, 0x0550b301, 0x05cfb7f9, 0x0612a911, 0x068dade9, 0x072ca0e1, 0x07b3a419,
+        0x01c9d3bc, 0x0156d744, 0x00f7da4c, 0x0068deb4, 0x03b5c05c, 0x032ac4a4, 0x028bc9ac, 0x0214cd54,
+        0x0531f47c, 0x05aef084, 0x040ffd8c, 0x0490f974, 0x074de79c, 0x07d2e364, 0x0673ee6c, 0x06ecea94,
+        0x01bba753, 0x0124a3ab, 0x0085aea3, 0x001aaa5b, 0x03c7b4b3, 0x0358b04b, 0x02f9bd43, 0x0266b9bb,
+        0x05438093, 0x05dc846b, 0x047d8963, 0x04e28d9b, 0x073f9373, 0x07a0978b, 0x06019a83, 0x069e9e7b,
+        0x012d3a62, 0x01b23e9a, 0x00133392, 0x008c376a, 0x03512982, 0x03ce2d7a, 0x026f2072, 0x02f0248a,
+        0x05d51da2, 0x054a195a, 0x04eb1452, 0x047410aa, 0x07a90e42, 0x07360aba, 0x069707b2, 0x0608034a,
+        0x015f4e8d, 0x01c04a75, 0x0061477d, 0x00fe4385, 0x03235d6d, 0x03bc5995, 0x021d549d, 0x02825065,
+        0x05a7694d, 0x05386db5, 0x049960bd, 0x04066445, 0x07db7aad, 0x07447e55, 0x06e5735d, 0x067a77a5,
+        0x0393a778, 0x030ca380, 0x02adae88, 0x0232aa70, 0x01efb498, 0x0170b060, 0x00d1bd68, 0x004eb990,
+        0x076b80b8, 0x07f48440, 0x06558948, 0x06ca8db0, 0x05179358, 0x058897a0, 0x04299aa8, 0x04b69e50,
+        0x03e1d397, 0x037ed76f, 0x02dfda67, 0x0240de9f, 0x019dc077, 0x0102c48f, 0x00a3c987, 0x003ccd7f,
+        0x0719f457, 0x0786f0af, 0x0627fda7, 0x06b8f95f, 0x0565e7b7, 0x05fae34f, 0x045bee47, 0x04c4eabf,
+        0x03774ea6, 0x03e84a5e, 0x02494756, 0x02d643ae, 0x010b5d46, 0x019459be, 0x003554b6, 0x00aa504e,
+        0x078f6966, 0x07106d9e, 0x06b16096, 0x062e646e, 0x05f37a86, 0x056c7e7e, 0x04cd7376, 0x0452778e,
+        0x03053a49, 0x039a3eb1, 0x023b33b9, 0x02a43741, 0x017929a9, 0x01e62d51, 0x00472059, 0x00d824a1,
+        0x07fd1d89, 0x07621971, 0x06c31479, 0x065c1081, 0x05810e69, 0x051e0a91, 0x04bf0799, 0x04200361,
+        0x025a74c4, 0x02c5703c, 0x03647d34, 0x03fb79cc, 0x00266724, 0x00b963dc, 0x01186ed4, 0x01876a2c,
+        0x06a25304, 0x063d57fc, 0x079c5af4, 0x07035e0c, 0x04de40e4, 0x0441441c, 0x05e04914, 0x057f4dec,
+        0x0228002b, 0x02b704d3, 0x031609db, 0x03890d23, 0x005413cb, 0x00cb1733, 0x016a1a3b, 0x01f51ec3,
+        0x06d027eb, 0x064f2313, 0x07ee2e1b, 0x07712ae3, 0x04ac340b, 0x043330f3, 0x05923dfb, 0x050d3903,
+        0x02be9d1a, 0x022199e2, 0x038094ea, 0x031f9012, 0x00c28efa, 0x005d8a02, 0x01fc870a, 0x016383f2,
+        0x0646bada, 0x06d9be22, 0x0778b32a, 0x07e7b7d2, 0x043aa93a, 0x04a5adc2, 0x0504a0ca, 0x059ba432,
+        0x02cce9f5, 0x0253ed0d, 0x03f2e005, 0x036de4fd, 0x00b0fa15, 0x002ffeed, 0x018ef3e5, 0x0111f71d,
+        0x0634ce35, 0x06abcacd, 0x070ac7c5, 0x0795c33d, 0x0448ddd5, 0x04d7d92d, 0x0576d425, 0x05e9d0dd
+    },
+    {
+        0x00000000, 0x048d9368, 0x00991dbf, 0x04148ed7, 0x01323b7e, 0x05bfa816, 0x01ab26c1, 0x0526b5a9,
+        0x026476fc, 0x06e9e594, 0x02fd6b43, 0x0670f82b, 0x03564d82, 0x07dbdeea, 0x03cf503d, 0x0742c355,
+        0x04c8edf8, 0x00457e90, 0x0451f047, 0x00dc632f, 0x05fad686, 0x017745ee, 0x0563cb39, 0x01ee5851,
+        0x06ac9b04, 0x0221086c, 0x063586bb, 0x02b815d3, 0x079ea07a, 0x03133312, 0x0707bdc5, 0x038a2ead,
+        0x0013e09f, 0x049e73f7, 0x008afd20, 0x04076e48, 0x0121dbe1, 0x05ac4889, 0x01b8c65e, 0x05355536,
+        0x02779663, 0x06fa050b, 0x02ee8bdc, 0x066318b4, 0x0345ad1d, 0x07c83e75, 0x03dcb0a2, 0x075123ca,
+        0x04db0d67, 0x00569e0f, 0x044210d8, 0x00cf83b0, 0x05e93619, 0x0164a571, 0x05702ba6, 0x01fdb8ce,
+        0x06bf7b9b, 0x0232e8f3, 0x06266624, 0x02abf54c, 0x078d40e5, 0x0300d38d, 0x07145d5a, 0x0399ce32,
+        0x0027c13e, 0x04aa5256, 0x00bedc81, 0x04334fe9, 0x0115fa40, 0x05986928, 0x018ce7ff, 0x05017497,
+        0x0243b7c2, 0x06ce24aa, 0x02daaa7d, 0x06573915, 0x03718cbc, 0x07fc1fd4, 0x03e89103, 0x0765026b,
+        0x04ef2cc6, 0x0062bfae, 0x04763179, 0x00fba211, 0x05dd17b8, 0x015084d0, 0x05440a07, 0x01c9996f,
+        0x068b5a3a, 0x0206c952, 0x06124785, 0x029fd4ed, 0x07b96144, 0x0334f22c, 0x07207cfb, 0x03adef93,
+        0x003421a1, 0x04b9b2c9, 0x00ad3c1e, 0x0420af76, 0x01061adf, 0x058b89b7, 0x019f0760, 0x05129408,
+        0x0250575d, 0x06ddc435, 0x02c94ae2, 0x0644d98a, 0x03626c23, 0x07efff4b, 0x03fb719c, 0x0776e2f4,
+        0x04fccc59, 0x00715f31, 0x0465d1e6, 0x00e8428e, 0x05cef727, 0x0143644f, 0x0557ea98, 0x01da79f0,
+        0x0698baa5, 0x021529cd, 0x0601a71a, 0x028c3472, 0x07aa81db, 0x032712b3, 0x07339c64, 0x03be0f0c,
+        0x004f827c, 0x04c21114, 0x00d69fc3, 0x045b0cab, 0x017db902, 0x05f02a6a, 0x01e4a4bd, 0x056937d5,
+        0x022bf480, 0x06a667e8, 0x02b2e93f, 0x063f7a57, 0x0319cffe, 0x07945c96, 0x0380d241, 0x070d4129,
+        0x04876f84, 0x000afcec, 0x041e723b, 0x0093e153, 0x05b554fa, 0x0138c792, 0x052c4945, 0x01a1da2d,
+        0x06e31978, 0x026e8a10, 0x067a04c7, 0x02f797af, 0x07d12206, 0x035cb16e, 0x07483fb9, 0x03c5acd1,
+        0x005c62e3, 0x04d1f18b, 0x00c57f5c, 0x0448ec34, 0x016e599d, 0x05e3caf5, 0x01f74422, 0x057ad74a,
+        0x0238141f, 0x06b58777, 0x02a109a0, 0x062c9ac8, 0x030a2f61, 0x0787bc09, 0x039332de, 0x071ea1b6,
+        0x04948f1b, 0x00191c73, 0x040d92a4, 0x008001cc, 0x05a6b465, 0x012b270d, 0x053fa9da, 0x01b23ab2,
+        0x06f0f9e7, 0x027d6a8f, 0x0669e458, 0x02e47730, 0x07c2c299, 0x034f51f1, 0x075bdf26, 0x03d64c4e,
+        0x00684342, 0x04e5d02a, 0x00f15efd, 0x047ccd95, 0x015a783c, 0x05d7eb54, 0x01c36583, 0x054ef6eb,
+        0x020c35be, 0x0681a6d6, 0x02952801, 0x0618bb69, 0x033e0ec0, 0x07b39da8, 0x03a7137f, 0x072a8017,
+        0x04a0aeba, 0x002d3dd2, 0x0439b305, 0x00b4206d, 0x059295c4, 0x011f06ac, 0x050b887b, 0x01861b13,
+        0x06c4d846, 0x02494b2e, 0x065dc5f9, 0x02d05691, 0x07f6e338, 0x037b7050, 0x076ffe87, 0x03e26def,
+        0x007ba3dd, 0x04f630b5, 0x00e2be62, 0x046f2d0a, 0x014998a3, 0x05c40bcb, 0x01d0851c, 0x055d1674,
+        0x021fd521, 0x06924649, 0x0286c89e, 0x060b5bf6, 0x032dee5f, 0x07a07d37, 0x03b4f3e0, 0x07396088,
+        0x04b34e25, 0x003edd4d, 0x042a539a, 0x00a7c0f2, 0x0581755b, 0x010ce633, 0x051868e4, 0x0195fb8c,
+        0x06d738d9, 0x025aabb1, 0x064e2566, 0x02c3b60e, 0x07e503a7, 0x036890cf, 0x077c1e18, 0x03f18d70
+    },
+    {
+        0x00000000, 0x01e0f893, 0x03c1f126, 0x022109b5, 0x0783e24c, 0x06631adf, 0x0442136a, 0x05a2ebf9,
+        0x0685fff7, 0x07650764, 0x05440ed1, 0x04a4f642, 0x01061dbb, 0x00e6e528, 0x02c7ec9d, 0x0327140e,
+        0x0489c481, 0x05693c12, 0x074835a7, 0x06a8cd34, 0x030a26cd, 0x02eade5e, 0x00cbd7eb, 0x012b2f78,
+        0x020c3b76, 0x03ecc3e5, 0x01cdca50, 0x002d32c3, 0x058fd93a, 0x046f21a9, 0x064e281c, 0x07aed08f,
+        0x0091b26d, 0x01714afe, 0x0350434b, 0x02b0bbd8, 0x07125021, 0x06f2a8b2, 0x04d3a107, 0x05335994,
+        0x06144d9a, 0x07f4b509, 0x05d5bcbc, 0x0435442f, 0x0197afd6, 0x00775745, 0x02565ef0, 0x03b6a663,
+        0x041876ec, 0x05f88e7f, 0x07d987ca, 0x06397f59, 0x039b94a0, 0x027b6c33, 0x005a6586, 0x01ba9d15,
+        0x029d891b, 0x037d7188, 0x015c783d, 0x00bc80ae, 0x051e6b57, 0x04fe93c4, 0x06df9a71, 0x073f62e2,
+        0x012364da, 0x00c39c49, 0x02e295fc, 0x03026d6f, 0x06a08696, 0x07407e05, 0x056177b0, 0x04818f23,
+        0x07a69b2d, 0x064663be, 0x04676a0b, 0x05879298, 0x00257961, 0x01c581f2, 0x03e48847, 0x020470d4,
+        0x05aaa05b, 0x044a58c8, 0x066b517d, 0x078ba9ee, 0x02294217, 0x03c9ba84, 0x01e8b331, 0x00084ba2,
+        0x032f5fac, 0x02cfa73f, 0x00eeae8a, 0x010e5619, 0x04acbde0, 0x054c4573, 0x076d4cc6, 0x068db455,
+        0x01b2d6b7, 0x00522e24, 0x02732791, 0x0393df02, 0x063134fb, 0x07d1cc68, 0x05f0c5dd, 0x04103d4e,
+        0x07372940, 0x06d7d1d3, 0x04f6d866, 0x051620f5, 0x00b4cb0c, 0x0154339f, 0x03753a2a, 0x0295c2b9,
+        0x053b1236, 0x04dbeaa5, 0x06fae310, 0x071a1b83, 0x02b8f07a, 0x035808e9, 0x0179015c, 0x0099f9cf,
+        0x03beedc1, 0x025e1552, 0x007f1ce7, 0x019fe474, 0x043d0f8d, 0x05ddf71e, 0x07fcfeab, 0x061c0638,
+        0x0246c9b4, 0x03a63127, 0x01873892, 0x0067c001, 0x05c52bf8, 0x0425d36b, 0x0604dade, 0x07e4224d,
+        0x04c33643, 0x0523ced0, 0x0702c765, 0x06e23ff6, 0x0340d40f, 0x02a02c9c, 0x00812529, 0x0161ddba,
+        0x06cf0d35, 0x072ff5a6, 0x050efc13, 0x04ee0480, 0x014cef79, 0x00ac17ea, 0x028d1e5f, 0x036de6cc,
+        0x004af2c2, 0x01aa0a51, 0x038b03e4, 0x026bfb77, 0x07c9108e, 0x0629e81d, 0x0408e1a8, 0x05e8193b,
+        0x02d77bd9, 0x0337834a, 0x01168aff, 0x00f6726c, 0x05549995, 0x04b46106, 0x069568b3, 0x07759020,
+        0x0452842e, 0x05b27cbd, 0x07937508, 0x06738d9b, 0x03d16662, 0x02319ef1, 0x00109744, 0x01f06fd7,
+        0x065ebf58, 0x07be47cb, 0x059f4e7e, 0x047fb6ed, 0x01dd5d14, 0x003da587, 0x021cac32, 0x03fc54a1,
+        0x00db40af, 0x013bb83c, 0x031ab189, 0x02fa491a, 0x0758a2e3, 0x06b85a70, 0x049953c5, 0x0579ab56,
+        0x0365ad6e, 0x028555fd, 0x00a45c48, 0x0144a4db, 0x04e64f22, 0x0506b7b1, 0x0727be04, 0x06c74697,
+        0x05e05299, 0x0400aa0a, 0x0621a3bf, 0x07c15b2c, 0x0263b0d5, 0x03834846, 0x01a241f3, 0x0042b960,
+        0x07ec69ef, 0x060c917c, 0x042d98c9, 0x05cd605a, 0x006f8ba3, 0x018f7330, 0x03ae7a85, 0x024e8216,
+        0x01699618, 0x00896e8b, 0x02a8673e, 0x03489fad, 0x06ea7454, 0x070a8cc7, 0x052b8572, 0x04cb7de1,
+        0x03f41f03, 0x0214e790, 0x0035ee25, 0x01d516b6, 0x0477fd4f, 0x059705dc, 0x07b60c69, 0x0656f4fa,
+        0x0571e0f4, 0x04911867, 0x06b011d2, 0x0750e941, 0x02f202b8, 0x0312fa2b, 0x0133f39e, 0x00d30b0d,
+        0x077ddb82, 0x069d2311, 0x04bc2aa4, 0x055cd237, 0x00fe39ce, 0x011ec15d, 0x033fc8e8, 0x02df307b,
+        0x01f82475, 0x0018dce6, 0x0239d553, 0x03d92dc0, 0x067bc639, 0x079b3eaa, 0x05ba371f, 0x045acf8c
+    }
+#endif
+};
+
+static inline uint32_t _z_crc32_byte(uint32_t crc, uint8_t b) {
+    return (crc >> 8) ^ _z_crc32_table[0][(crc ^ (uint32_t)b) & (uint32_t)0xFF];
+}
+
+uint32_t _z_crc32(const uint8_t *message, size_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    size_t i = 0;
+#if Z_CRC32_TABLES == 8
+    // Bytes are assembled one by one, so that the message neither needs to be aligned nor little endian
+    for (; (len - i) >= (size_t)8; i += 8) {
+        const uint8_t *p = &message[i];
+        crc = crc ^ ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+        crc = _z_crc32_table[7][crc & (uint32_t)0xFF] ^ _z_crc32_table[6][(crc >> 8) & (uint32_t)0xFF] ^
+              _z_crc32_table[5][(crc >> 16) & (uint32_t)0xFF] ^ _z_crc32_table[4][crc >> 24] ^
+              _z_crc32_table[3][p[4]] ^ _z_crc32_table[2][p[5]] ^ _z_crc32_table[1][p[6]] ^ _z_crc32_table[0][p[7]];
+    }
+#endif
+    for (; i < len; i++) {
+        crc = _z_crc32_byte(crc, message[i]);
+    }
+    return ~crc;
+}
+#else
+#error "Z_CRC32_TABLES must be 0, 1 or 8"
+#endif
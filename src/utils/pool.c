@@ -0,0 +1,228 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/utils/pool.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/utils/logging.h"
+
+#if Z_FEATURE_MEMORY_POOLS == 1
+
+/*------------------ Lock ------------------*/
+// A spinlock rather than a z_mutex_t: it needs no initialization, and creating a mutex allocates on some platforms
+#if Z_FEATURE_MULTI_THREAD == 1
+#if ZENOH_C_STANDARD != 99
+#include <stdatomic.h>
+
+static atomic_flag _z_pool_lock_flag = ATOMIC_FLAG_INIT;
+
+static inline _Bool _z_pool_try_lock(void) {
+    return atomic_flag_test_and_set_explicit(&_z_pool_lock_flag, memory_order_acquire) == false;
+}
+
+static inline void _z_pool_unlock(void) { atomic_flag_clear_explicit(&_z_pool_lock_flag, memory_order_release); }
+#else  // ZENOH_C_STANDARD == 99
+#ifdef ZENOH_COMPILER_GCC
+static volatile int _z_pool_lock_flag = 0;
+
+static inline _Bool _z_pool_try_lock(void) { return __sync_lock_test_and_set(&_z_pool_lock_flag, 1) == 0; }
+
+static inline void _z_pool_unlock(void) { __sync_lock_release(&_z_pool_lock_flag); }
+#else  // !ZENOH_COMPILER_GCC
+#error "Memory pools in C99 only exist for GCC, use GCC or C11 or deactivate multi-thread"
+#endif  // ZENOH_COMPILER_GCC
+#endif  // ZENOH_C_STANDARD != 99
+
+#define _Z_POOL_LOCK_SPINS 64
+
+// The lock is only held for a few instructions, so it is spun for first. A waiting task then sleeps, as a higher
+// priority one spinning forever would never let a lower priority holder run on a single core
+static inline void _z_pool_lock(void) {
+    unsigned int spins = 0;
+    while (_z_pool_try_lock() == false) {
+        spins++;
+        if (spins < (unsigned int)_Z_POOL_LOCK_SPINS) {
+            ZP_ASM_NOP;
+        } else {
+            spins = 0;
+            (void)z_sleep_ms(Z_MEMORY_POOL_LOCK_BACKOFF_MS);
+        }
+    }
+}
+#else   // Z_FEATURE_MULTI_THREAD == 0
+static inline void _z_pool_lock(void) {}
+
+static inline void _z_pool_unlock(void) {}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+/*------------------ Pools ------------------*/
+// The blocks are made of units aligned for any of the types the library allocates
+typedef union {
+    uint64_t _u64;
+    double _double;
+    void *_ptr;
+} _z_pool_unit_t;
+
+#define _Z_POOL_UNITS(size) (((size_t)(size) + sizeof(_z_pool_unit_t) - 1) / sizeof(_z_pool_unit_t))
+
+typedef struct {
+    _z_pool_unit_t *_start;
+    size_t _units;   // Units per block
+    size_t _blocks;
+    size_t _carved;  // Blocks handed out at least once, the ones after them have never been used
+    void *_free;     // Freed blocks, each one starting with a pointer to the next one
+    size_t _in_use;
+    size_t _high_water;
+    size_t _misses;
+} _z_pool_t;
+
+// From the smallest blocks to the largest ones
+#define _Z_POOLS(X)                                                \
+    X(16, 16, Z_MEMORY_POOL_BLOCKS_16)                             \
+    X(32, 32, Z_MEMORY_POOL_BLOCKS_32)                             \
+    X(64, 64, Z_MEMORY_POOL_BLOCKS_64)                             \
+    X(128, 128, Z_MEMORY_POOL_BLOCKS_128)                          \
+    X(256, 256, Z_MEMORY_POOL_BLOCKS_256)                          \
+    X(512, 512, Z_MEMORY_POOL_BLOCKS_512)                          \
+    X(2k, 2048, Z_MEMORY_POOL_BLOCKS_2K)                           \
+    X(batch, Z_MEMORY_POOL_BATCH_SIZE, Z_MEMORY_POOL_BLOCKS_BATCH) \
+    X(frag, Z_FRAG_MAX_SIZE, Z_MEMORY_POOL_BLOCKS_FRAG)
+
+// A pool without blocks still gets one, as C has no empty arrays
+#define _Z_POOL_STORAGE(name, size, blocks) \
+    static _z_pool_unit_t _z_pool_##name[_Z_POOL_UNITS(size) * (((blocks) > 0) ? (size_t)(blocks) : (size_t)1)];
+_Z_POOLS(_Z_POOL_STORAGE)
+
+#define _Z_POOL(name, size, blocks) {._start = _z_pool_##name, ._units = _Z_POOL_UNITS(size), ._blocks = (blocks)},
+static _z_pool_t _z_pools[] = {_Z_POOLS(_Z_POOL)};
+
+#define _Z_POOLS_NUM (sizeof(_z_pools) / sizeof(_z_pools[0]))
+
+static inline size_t _z_pool_block_size(const _z_pool_t *pool) { return pool->_units * sizeof(_z_pool_unit_t); }
+
+// The bounds of the pools never change, so they can be looked up without holding the lock
+static _z_pool_t *_z_pool_of(const void *ptr) {
+    uintptr_t addr = (uintptr_t)ptr;
+    for (size_t i = 0; i < _Z_POOLS_NUM; i++) {
+        uintptr_t start = (uintptr_t)_z_pools[i]._start;
+        if ((addr >= start) && (addr < start + (_z_pools[i]._blocks * _z_pool_block_size(&_z_pools[i])))) {
+            return &_z_pools[i];
+        }
+    }
+    return NULL;
+}
+
+static void *_z_pool_take(_z_pool_t *pool) {
+    void *block = NULL;
+    if (pool->_free != NULL) {
+        block = pool->_free;
+        pool->_free = *(void **)block;
+    } else if (pool->_carved < pool->_blocks) {
+        block = &pool->_start[pool->_carved * pool->_units];
+        pool->_carved++;
+    }
+    if (block != NULL) {
+        pool->_in_use++;
+        if (pool->_in_use > pool->_high_water) {
+            pool->_high_water = pool->_in_use;
+        }
+    }
+    return block;
+}
+
+/*------------------ Memory ------------------*/
+void *_z_pool_malloc(size_t size) {
+    void *ptr = NULL;
+    _Bool missed = false;
+    _z_pool_lock();
+    for (size_t i = 0; (ptr == NULL) && (i < _Z_POOLS_NUM); i++) {
+        if (size <= _z_pool_block_size(&_z_pools[i])) {
+            ptr = _z_pool_take(&_z_pools[i]);
+            // Only the pool the allocation belongs to misses it, not the larger ones it spills over
+            if ((ptr == NULL) && (missed == false)) {
+                _z_pools[i]._misses++;
+                missed = true;
+            }
+        }
+    }
+    _z_pool_unlock();
+    return ptr;
+}
+
+void *_z_pool_realloc(void *ptr, size_t size) {
+    if (ptr == NULL) {
+        return _z_pool_malloc(size);
+    }
+    if (size == 0) {
+        _z_pool_free(ptr);
+        return NULL;
+    }
+
+    _z_pool_t *pool = _z_pool_of(ptr);
+    if (pool == NULL) {
+        // Same as _z_pool_free, the block was not allocated by z_malloc
+        _Z_ERROR("Reallocating %p that no memory pool owns", ptr);
+        assert(false);
+        return NULL;
+    }
+    size_t block_size = _z_pool_block_size(pool);
+    if (size <= block_size) {
+        return ptr;
+    }
+    void *new_ptr = _z_pool_malloc(size);
+    if (new_ptr != NULL) {
+        (void)memcpy(new_ptr, ptr, block_size);
+        _z_pool_free(ptr);
+    }
+    return new_ptr;
+}
+
+void _z_pool_free(void *ptr) {
+    _z_pool_t *pool = _z_pool_of(ptr);
+    if (pool != NULL) {
+        _z_pool_lock();
+        *(void **)ptr = pool->_free;
+        pool->_free = ptr;
+        pool->_in_use--;
+        _z_pool_unlock();
+    } else if (ptr != NULL) {
+        // Allocated by something other than z_malloc, which cannot be given back to any pool
+        _Z_ERROR("Freeing %p that no memory pool owns", ptr);
+        assert(false);
+    }
+}
+
+size_t _z_pool_stats(_z_pool_stats_t *stats, size_t len) {
+    _z_pool_lock();
+    for (size_t i = 0; (i < len) && (i < _Z_POOLS_NUM); i++) {
+        stats[i] = (_z_pool_stats_t){.block_size = _z_pool_block_size(&_z_pools[i]),
+                                     .blocks = _z_pools[i]._blocks,
+                                     .in_use = _z_pools[i]._in_use,
+                                     .high_water = _z_pools[i]._high_water,
+                                     .misses = _z_pools[i]._misses};
+    }
+    _z_pool_unlock();
+    return _Z_POOLS_NUM;
+}
+#else
+size_t _z_pool_stats(_z_pool_stats_t *stats, size_t len) {
+    (void)(stats);
+    (void)(len);
+    return 0;
+}
+#endif  // Z_FEATURE_MEMORY_POOLS == 1
@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/api/constants.h"
+#include "zenoh-pico/api/primitives.h"
+#include "zenoh-pico/api/types.h"
+#include "zenoh-pico/protocol/codec/message.h"
+#include "zenoh-pico/protocol/core.h"
+#include "zenoh-pico/protocol/iobuf.h"
+#include "zenoh-pico/system/platform.h"
+
+#include "z_bench.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_ATTACHMENT == 1
+
+#define ROUNDS 200000
+
+// Small metadata pairs, as attached to every sample
+static const char *keys[] = {"seq", "src", "unit", "frame", "schema", "trace"};
+static const char *values[] = {"42", "lidar/front", "m", "base_link", "v1", "00f067aa0ba902b7"};
+
+static void encode_put(_z_wbuf_t *wbf, z_attachment_t att) {
+    _z_push_body_t pshb = {._is_put = true,
+                           ._body._put = {._commons = {._source_info = _z_source_info_null(),
+                                                       ._timestamp = _z_timestamp_null()},
+                                          ._payload = _z_bytes_wrap((const uint8_t *)"payload", 7),
+                                          ._encoding = {.prefix = Z_ENCODING_PREFIX_EMPTY},
+                                          ._attachment = {.is_encoded = false, .body.decoded = att}}};
+    _z_wbuf_reset(wbf);
+    int8_t res = _z_push_body_encode(wbf, &pshb);
+    assert(res == _Z_RES_OK);
+    (void)res;
+}
+
+static void insert_pairs_in_map(z_owned_bytes_map_t *map) {
+    for (size_t i = 0; i < ARRAY_SIZE(keys); i++) {
+        z_bytes_map_insert_by_copy(map, z_bytes_from_str(keys[i]), z_bytes_from_str(values[i]));
+    }
+}
+
+static void insert_pairs_in_builder(z_owned_attachment_builder_t *builder) {
+    for (size_t i = 0; i < ARRAY_SIZE(keys); i++) {
+        int8_t res = z_attachment_builder_insert(builder, z_bytes_from_str(keys[i]), z_bytes_from_str(values[i]));
+        assert(res == _Z_RES_OK);
+        (void)res;
+    }
+}
+
+int main(void) {
+    _z_wbuf_t wbf = _z_wbuf_make(1024, false);
+    z_owned_attachment_builder_t builder = z_attachment_builder_new(128);
+
+    // Check both attachments decode to the same pairs before timing them
+    z_owned_bytes_map_t map = z_bytes_map_new();
+    insert_pairs_in_map(&map);
+    insert_pairs_in_builder(&builder);
+    z_attachment_t atts[] = {z_bytes_map_as_attachment(&map), z_attachment_builder_as_attachment(&builder)};
+    for (size_t a = 0; a < ARRAY_SIZE(atts); a++) {
+        encode_put(&wbf, atts[a]);
+        _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+        _z_push_body_t pshb = {0};
+        uint8_t header = _z_zbuf_read(&zbf);
+        assert(_z_push_body_decode(&pshb, &zbf, header) == _Z_RES_OK);
+        z_attachment_t received = _z_encoded_as_attachment(&pshb._body._put._attachment);
+        for (size_t i = 0; i < ARRAY_SIZE(keys); i++) {
+            z_bytes_t value = z_attachment_get(received, z_bytes_from_str(keys[i]));
+            assert((value.len == strlen(values[i])) && (memcmp(value.start, values[i], value.len) == 0));
+        }
+        _z_push_body_clear(&pshb);
+        _z_zbuf_clear(&zbf);
+    }
+    z_bytes_map_drop(&map);
+
+    printf("Attachment of %zu pairs, list -> flat buffer\n", ARRAY_SIZE(keys));
+
+    // Build and encode a new attachment for each sample
+    z_clock_t start = z_clock_now();
+    for (unsigned long r = 0; r < ROUNDS; r++) {
+        map = z_bytes_map_new();
+        insert_pairs_in_map(&map);
+        encode_put(&wbf, z_bytes_map_as_attachment(&map));
+        z_bytes_map_drop(&map);
+    }
+    double list = elapsed_ns_per_op(&start, ROUNDS);
+    start = z_clock_now();
+    for (unsigned long r = 0; r < ROUNDS; r++) {
+        z_attachment_builder_clear(&builder);
+        insert_pairs_in_builder(&builder);
+        encode_put(&wbf, z_attachment_builder_as_attachment(&builder));
+    }
+    double flat = elapsed_ns_per_op(&start, ROUNDS);
+    printf("build + encode: %7.1f -> %7.1f ns/sample\n", list, flat);
+
+    // Look a key up in a received attachment, copied into a map or read in place
+    encode_put(&wbf, z_attachment_builder_as_attachment(&builder));
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+    _z_push_body_t pshb = {0};
+    uint8_t header = _z_zbuf_read(&zbf);
+    assert(_z_push_body_decode(&pshb, &zbf, header) == _Z_RES_OK);
+    z_attachment_t received = _z_encoded_as_attachment(&pshb._body._put._attachment);
+    z_bytes_t key = z_bytes_from_str(keys[ARRAY_SIZE(keys) - 1]);
+    volatile size_t sink = 0;
+    start = z_clock_now();
+    for (unsigned long r = 0; r < ROUNDS; r++) {
+        map = z_bytes_map_from_attachment(received);
+        sink += z_bytes_map_get(&map, key).len;
+        z_bytes_map_drop(&map);
+    }
+    list = elapsed_ns_per_op(&start, ROUNDS);
+    start = z_clock_now();
+    for (unsigned long r = 0; r < ROUNDS; r++) {
+        sink += z_attachment_get(received, key).len;
+    }
+    flat = elapsed_ns_per_op(&start, ROUNDS);
+    (void)sink;
+    printf("receive + get:  %7.1f -> %7.1f ns/sample\n", list, flat);
+
+    _z_push_body_clear(&pshb);
+    _z_zbuf_clear(&zbf);
+    z_attachment_builder_drop(&builder);
+    _z_wbuf_clear(&wbf);
+    return 0;
+}
+#else
+int main(void) {
+    printf("ERROR: Zenoh pico was compiled without Z_FEATURE_ATTACHMENT but this test requires it.\n");
+    return -2;
+}
+#endif
@@ -0,0 +1,31 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_TESTS_BENCH_H
+#define ZENOH_PICO_TESTS_BENCH_H
+
+#include "zenoh-pico/system/platform.h"
+
+/*------------------ Timing helpers shared by the benchmarks ------------------*/
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof(array[0]))
+
+static inline double elapsed_ns_per_op(z_clock_t *start, unsigned long ops) {
+    return ((double)z_clock_elapsed_us(start) * 1000.0) / (double)ops;
+}
+
+static inline double elapsed_mb_per_s(z_clock_t *start, unsigned long bytes) {
+    return (double)bytes / (double)z_clock_elapsed_us(start);
+}
+
+#endif /* ZENOH_PICO_TESTS_BENCH_H */
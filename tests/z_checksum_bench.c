@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/utils/checksum.h"
+
+#include "z_bench.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#define BUFFER_SIZE 2048
+#define BYTES (64 * 1024 * 1024)
+
+// Bit at a time CRC32, i.e. the one the lookup tables replace
+static uint32_t bitwise_crc32(const uint8_t *message, size_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc = crc ^ (uint32_t)message[i];
+        for (uint8_t j = 0; j < (uint8_t)8; j++) {
+            crc = (crc >> 1) ^ ((uint32_t)0x04C11DB7 & (uint32_t)(-(int32_t)(crc & (uint32_t)1)));
+        }
+    }
+    return ~crc;
+}
+
+static void bench(const uint8_t *buf, size_t len) {
+    const unsigned long rounds = BYTES / len;
+    volatile uint32_t sink = 0;
+
+    z_clock_t start = z_clock_now();
+    for (unsigned long r = 0; r < rounds; r++) {
+        sink ^= bitwise_crc32(buf, len);
+    }
+    double bitwise = elapsed_mb_per_s(&start, rounds * len);
+
+    start = z_clock_now();
+    for (unsigned long r = 0; r < rounds; r++) {
+        sink ^= _z_crc32(buf, len);
+    }
+    double tables = elapsed_mb_per_s(&start, rounds * len);
+    (void)sink;
+
+    printf("%4zu bytes: %7.1f -> %7.1f MB/s\n", len, bitwise, tables);
+}
+
+int main(void) {
+    uint8_t buf[BUFFER_SIZE + 8];
+    z_random_fill(buf, sizeof(buf));
+
+    // Both implementations are checked against each other by z_checksum_test
+    assert(_z_crc32(buf, BUFFER_SIZE) == bitwise_crc32(buf, BUFFER_SIZE));
+
+    size_t lens[] = {16, 64, 256, 1500, 2048};
+    printf("CRC32, bit at a time -> %d lookup table(s) (%d MB each)\n", Z_CRC32_TABLES, BYTES / (1024 * 1024));
+    for (size_t i = 0; i < ARRAY_SIZE(lens); i++) {
+        bench(buf, lens[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/utils/checksum.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#define BUFFER_SIZE 2048
+
+// Bit at a time CRC32, i.e. the reference the lookup tables are checked against
+static uint32_t bitwise_crc32(const uint8_t *message, size_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc = crc ^ (uint32_t)message[i];
+        for (uint8_t j = 0; j < (uint8_t)8; j++) {
+            crc = (crc >> 1) ^ ((uint32_t)0x04C11DB7 & (uint32_t)(-(int32_t)(crc & (uint32_t)1)));
+        }
+    }
+    return ~crc;
+}
+
+void known_values_test(void) {
+    printf(">>> Known values\n");
+    // The serial frames are checked with the polynomial as is, not the reflected one of the usual CRC32
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    assert(_z_crc32(check, 0) == 0x00000000);
+    assert(_z_crc32(check, sizeof(check)) == 0xFC4F2BE9);
+}
+
+void lengths_and_alignments_test(void) {
+    printf(">>> Every length and alignment against the bitwise CRC32\n");
+    // Pseudo random, yet reproducible, content
+    uint8_t buf[BUFFER_SIZE + 8];
+    uint32_t seed = 0x12345678;
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        seed = (seed * (uint32_t)1103515245) + (uint32_t)12345;
+        buf[i] = (uint8_t)(seed >> 16);
+    }
+
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t len = 0; len <= BUFFER_SIZE; len++) {
+            assert(_z_crc32(&buf[offset], len) == bitwise_crc32(&buf[offset], len));
+        }
+    }
+}
+
+int main(void) {
+    printf("CRC32 with %d lookup table(s)\n", Z_CRC32_TABLES);
+    known_values_test();
+    lengths_and_alignments_test();
+    return 0;
+}
@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <stdint.h>
+#include <stdio.h>
+
+#include "zenoh-pico/protocol/codec/core.h"
+#include "zenoh-pico/protocol/iobuf.h"
+#include "zenoh-pico/system/platform.h"
+
+#include "z_bench.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#define VALUES 1024
+#define ROUNDS 2000
+
+// Byte at a time varint codec, i.e. the one the contiguous fast path replaces
+static int8_t bytewise_zint_encode(_z_wbuf_t *wbf, uint64_t v) {
+    while (v > 0x7f) {
+        _Z_RETURN_IF_ERR(_z_wbuf_write(wbf, (uint8_t)((v & 0x7f) | 0x80)));
+        v = v >> 7;
+    }
+    return _z_wbuf_write(wbf, (uint8_t)v);
+}
+
+static int8_t bytewise_zint_decode(uint64_t *v, _z_zbuf_t *zbf) {
+    *v = 0;
+    uint8_t i = 0;
+    uint8_t u8 = 0;
+    do {
+        _Z_RETURN_IF_ERR(_z_uint8_decode(&u8, zbf));
+        *v = *v | (((uint64_t)u8 & 0x7f) << i);
+        i = i + 7;
+    } while (u8 > 0x7f);
+    return _Z_RES_OK;
+}
+
+static void bench(unsigned int bits) {
+    uint64_t values[VALUES];
+    uint64_t mask = (bits == 64) ? UINT64_MAX : ((uint64_t)1 << bits) - 1;
+    for (size_t i = 0; i < VALUES; i++) {
+        z_random_fill(&values[i], sizeof(values[i]));
+        values[i] &= mask;
+    }
+    _z_wbuf_t wbf = _z_wbuf_make(VALUES * 10, false);
+
+    // Check both codecs agree before timing them
+    for (size_t i = 0; i < VALUES; i++) {
+        assert(bytewise_zint_encode(&wbf, values[i]) == _Z_RES_OK);
+    }
+    _z_zbuf_t ref = _z_wbuf_to_zbuf(&wbf);
+    _z_wbuf_reset(&wbf);
+    for (size_t i = 0; i < VALUES; i++) {
+        assert(_z_zint64_encode(&wbf, values[i]) == _Z_RES_OK);
+    }
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+    assert(_z_zbuf_len(&ref) == _z_zbuf_len(&zbf));
+    for (size_t i = 0; i < VALUES; i++) {
+        uint64_t v;
+        assert(_z_zint64_decode(&v, &ref) == _Z_RES_OK);
+        assert(v == values[i]);
+    }
+    size_t len = _z_zbuf_len(&zbf);
+
+    const unsigned long ops = (unsigned long)VALUES * ROUNDS;
+    z_clock_t start = z_clock_now();
+    for (unsigned long r = 0; r < ROUNDS; r++) {
+        _z_wbuf_reset(&wbf);
+        for (size_t i = 0; i < VALUES; i++) {
+            bytewise_zint_encode(&wbf, values[i]);
+        }
+    }
+    double bytewise_enc = elapsed_ns_per_op(&start, ops);
+
+    start = z_clock_now();
+    for (unsigned long r = 0; r < ROUNDS; r++) {
+        _z_wbuf_reset(&wbf);
+        for (size_t i = 0; i < VALUES; i++) {
+            _z_zint64_encode(&wbf, values[i]);
+        }
+    }
+    double fast_enc = elapsed_ns_per_op(&start, ops);
+
+    volatile uint64_t sink = 0;
+    start = z_clock_now();
+    for (unsigned long r = 0; r < ROUNDS; r++) {
+        _z_zbuf_set_rpos(&zbf, 0);
+        for (size_t i = 0; i < VALUES; i++) {
+            uint64_t v;
+            bytewise_zint_decode(&v, &zbf);
+            sink ^= v;
+        }
+    }
+    double bytewise_dec = elapsed_ns_per_op(&start, ops);
+
+    start = z_clock_now();
+    for (unsigned long r = 0; r < ROUNDS; r++) {
+        _z_zbuf_set_rpos(&zbf, 0);
+        for (size_t i = 0; i < VALUES; i++) {
+            uint64_t v;
+            _z_zint64_decode(&v, &zbf);
+            sink ^= v;
+        }
+    }
+    double fast_dec = elapsed_ns_per_op(&start, ops);
+    (void)sink;
+
+    printf("%2u bits (%4.1f bytes): encode %5.1f -> %5.1f ns, decode %5.1f -> %5.1f ns\n", bits,
+           (double)len / VALUES, bytewise_enc, fast_enc, bytewise_dec, fast_dec);
+
+    _z_zbuf_clear(&ref);
+    _z_zbuf_clear(&zbf);
+    _z_wbuf_clear(&wbf);
+}
+
+int main(void) {
+    unsigned int bits[] = {7, 14, 32, 64};
+
+    printf("Zint codec, byte at a time -> contiguous (%d values each)\n", VALUES * ROUNDS);
+    for (size_t i = 0; i < ARRAY_SIZE(bits); i++) {
+        bench(bits[i]);
+    }
+
+    return 0;
+}
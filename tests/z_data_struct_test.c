@@ -16,10 +16,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <string.h>
+
+#include "zenoh-pico/collections/ketree.h"
+#include "zenoh-pico/collections/ring_mt.h"
 #include "zenoh-pico/collections/string.h"
+#include "zenoh-pico/collections/vec.h"
+#include "zenoh-pico/protocol/codec/network.h"
 #include "zenoh-pico/protocol/core.h"
+#include "zenoh-pico/protocol/keyexpr.h"
 #include "zenoh-pico/system/platform.h"
 #include "zenoh-pico/transport/transport.h"
+#include "zenoh-pico/transport/utils.h"
 
 #undef NDEBUG
 #include <assert.h>
@@ -48,8 +56,388 @@ void entry_list_test(void) {
     _z_transport_peer_entry_list_free(&root);
 }
 
+void peer_index_test(void) {
+    printf(">>> peer-index\r\n");
+
+    // More peers than buckets, so that some of them share a bucket
+    _z_transport_peer_index_t index;
+    _z_transport_peer_index_init(&index);
+    _z_transport_peer_entry_t entries[3 * Z_PEER_INDEX_SIZE];
+    uint8_t addrs[3 * Z_PEER_INDEX_SIZE][6];
+    size_t n = sizeof(entries) / sizeof(entries[0]);
+    for (size_t i = 0; i < n; i++) {
+        (void)memset(addrs[i], 0, sizeof(addrs[i]));
+        addrs[i][0] = (uint8_t)i;
+        entries[i]._remote_addr = _z_bytes_wrap(addrs[i], sizeof(addrs[i]));
+        _z_transport_peer_index_add(&index, &entries[i]);
+    }
+    for (size_t i = 0; i < n; i++) {
+        _z_bytes_t addr = _z_bytes_wrap(addrs[i], sizeof(addrs[i]));
+        assert(_z_transport_peer_index_get(&index, &addr) == &entries[i]);
+    }
+    uint8_t unknown[6] = {0xff, 0, 0, 0, 0, 0};
+    _z_bytes_t addr = _z_bytes_wrap(unknown, sizeof(unknown));
+    assert(_z_transport_peer_index_get(&index, &addr) == NULL);
+    // A shorter address with the same prefix is a different peer
+    addr = _z_bytes_wrap(addrs[0], sizeof(addrs[0]) - 1);
+    assert(_z_transport_peer_index_get(&index, &addr) == NULL);
+
+    for (size_t i = 0; i < n; i += 2) {
+        _z_transport_peer_index_remove(&index, &entries[i]);
+    }
+    for (size_t i = 0; i < n; i++) {
+        addr = _z_bytes_wrap(addrs[i], sizeof(addrs[i]));
+        assert(_z_transport_peer_index_get(&index, &addr) == ((i % 2 == 0) ? NULL : &entries[i]));
+    }
+
+    // Addresses are written to the wrapped scratch buffer when it is large enough
+    uint8_t scratch[_Z_TRANSPORT_PEER_ADDR_MAX_LEN];
+    addr = _z_bytes_wrap(scratch, sizeof(scratch));
+    assert(_z_bytes_reserve(&addr, 18) == _Z_RES_OK);
+    assert(addr.start == scratch && addr.len == 18 && addr._is_alloc == false);
+    assert(_z_bytes_reserve(&addr, sizeof(scratch) + 1) == _Z_RES_OK);
+    assert(addr.start != scratch && addr.len == sizeof(scratch) + 1 && addr._is_alloc == true);
+    _z_bytes_clear(&addr);
+}
+
+void peer_lease_heap_test(void) {
+    printf(">>> peer-lease-heap\r\n");
+
+    _z_transport_peer_lease_heap_t heap;
+    _z_transport_peer_lease_heap_init(&heap);
+    assert(_z_transport_peer_lease_heap_top(&heap) == NULL);
+
+    _z_transport_peer_entry_t entries[37];
+    size_t n = sizeof(entries) / sizeof(entries[0]);
+    for (size_t i = 0; i < n; i++) {
+        entries[i]._lease_deadline = (i * 7919) % 101;  // Distinct, shuffled deadlines
+        assert(_z_transport_peer_lease_heap_push(&heap, &entries[i]) == _Z_RES_OK);
+    }
+
+    // Postpone some deadlines and drop some entries, as the lease task does
+    for (size_t i = 0; i < n; i += 3) {
+        entries[i]._lease_deadline += 50;
+        _z_transport_peer_lease_heap_update(&heap, &entries[i]);
+    }
+    for (size_t i = 1; i < n; i += 4) {
+        _z_transport_peer_lease_heap_remove(&heap, &entries[i]);
+    }
+    _z_transport_peer_lease_heap_remove(&heap, &entries[1]);  // Not in the heap anymore
+
+    size_t popped = 0;
+    uint64_t last = 0;
+    _z_transport_peer_entry_t *top = _z_transport_peer_lease_heap_top(&heap);
+    while (top != NULL) {
+        assert(top->_lease_deadline >= last);
+        assert(((size_t)(top - entries) % 4) != 1);
+        last = top->_lease_deadline;
+        _z_transport_peer_lease_heap_remove(&heap, top);
+        popped++;
+        top = _z_transport_peer_lease_heap_top(&heap);
+    }
+    assert(popped == n - ((n + 2) / 4));
+    _z_transport_peer_lease_heap_clear(&heap);
+}
+
+#define KETREE_N_KEYS 20
+static const char *ketree_keys[KETREE_N_KEYS] = {
+    "a", "a/b", "a/b/c", "a/*", "a/**", "**", "*/b", "a/b$*", "a/$*c", "a/**/c",
+    "a/*/c", "b/**/d", "@a/b", "@a/**", "a/@b/c", "a/c", "*", "a/b/**", "**/c/d", "x/y/z",
+};
+static const char *ketree_queries[] = {
+    "a", "a/b", "a/b/c", "a/bc", "a/xc", "b/c/d", "b/d", "a/@b/c", "@a/b", "a/b/c/d", "x/y/z",
+    "a/**", "**", "*/*", "a/*/c", "a/$*", "c/x/d", "q", "@a/c", "**/c/x/d", "a/b/x/c",
+};
+
+static void ketree_visit(void *val, void *arg) {
+    _Bool *hits = (_Bool *)arg;
+    size_t i = (size_t)((const char **)val - ketree_keys);
+    assert(hits[i] == false);  // Each value must be reported once
+    hits[i] = true;
+}
+
+static void ketree_check(_z_ketree_t *tree, const _Bool *inserted) {
+    for (size_t q = 0; q < sizeof(ketree_queries) / sizeof(ketree_queries[0]); q++) {
+        _Bool hits[KETREE_N_KEYS] = {0};
+        _z_ketree_intersecting(tree, ketree_queries[q], ketree_visit, hits);
+        for (size_t k = 0; k < KETREE_N_KEYS; k++) {
+            _Bool expected = inserted[k] && _z_keyexpr_intersects(ketree_keys[k], strlen(ketree_keys[k]),
+                                                                  ketree_queries[q], strlen(ketree_queries[q]));
+            if (hits[k] != expected) {
+                printf("ketree mismatch: %s vs %s\r\n", ketree_keys[k], ketree_queries[q]);
+            }
+            assert(hits[k] == expected);
+        }
+    }
+}
+
+void ketree_test(void) {
+    printf(">>> ketree\r\n");
+    _z_ketree_t tree;
+    _z_ketree_init(&tree);
+    _Bool inserted[KETREE_N_KEYS] = {0};
+    ketree_check(&tree, inserted);
+
+    for (size_t k = 0; k < KETREE_N_KEYS; k++) {
+        assert(_z_ketree_insert(&tree, ketree_keys[k], (void *)&ketree_keys[k]) == _Z_RES_OK);
+        inserted[k] = true;
+        ketree_check(&tree, inserted);
+    }
+    // Remove every other key, then the rest
+    for (size_t k = 0; k < KETREE_N_KEYS; k += 2) {
+        assert(_z_ketree_remove(&tree, ketree_keys[k], &ketree_keys[k]) == true);
+        assert(_z_ketree_remove(&tree, ketree_keys[k], &ketree_keys[k]) == false);
+        inserted[k] = false;
+        ketree_check(&tree, inserted);
+    }
+    for (size_t k = 1; k < KETREE_N_KEYS; k += 2) {
+        assert(_z_ketree_remove(&tree, ketree_keys[k], &ketree_keys[k]) == true);
+        inserted[k] = false;
+        ketree_check(&tree, inserted);
+    }
+    assert(_z_ketree_is_empty(&tree) == true);
+
+    assert(_z_ketree_insert(&tree, "a/b", (void *)&ketree_keys[1]) == _Z_RES_OK);
+    _z_ketree_clear(&tree);
+    assert(_z_ketree_is_empty(&tree) == true);
+}
+
+#if Z_FEATURE_MULTI_THREAD == 1
+#define TX_QUEUE_PRODUCERS 4
+#define TX_QUEUE_MSGS 2000
+
+static _z_zint_t tx_queue_entry_rid(_z_tx_queue_entry_t *entry) {
+    _z_zbuf_t zbf = _z_zbytes_as_zbuf(entry->_msg);
+    _z_network_message_t n_msg;
+    assert(_z_network_message_decode(&n_msg, &zbf) == _Z_RES_OK);
+    assert(n_msg._tag == _Z_N_RESPONSE_FINAL);
+    _z_zint_t rid = n_msg._body._response_final._request_id;
+    _z_n_msg_clear(&n_msg);
+    return rid;
+}
+
+typedef struct {
+    _z_tx_queue_t *queue;
+    _z_zint_t producer;
+} tx_queue_producer_t;
+
+static void *tx_queue_producer(void *arg) {
+    tx_queue_producer_t *p = (tx_queue_producer_t *)arg;
+    for (_z_zint_t i = 0; i < TX_QUEUE_MSGS; i++) {
+        _z_network_message_t n_msg = _z_n_msg_make_response_final(p->producer * TX_QUEUE_MSGS + i);
+        assert(_z_tx_queue_push(p->queue, &n_msg, Z_RELIABILITY_RELIABLE, Z_CONGESTION_CONTROL_BLOCK) == _Z_RES_OK);
+    }
+    return NULL;
+}
+
+void tx_queue_test(void) {
+    printf(">>> tx-queue\r\n");
+
+    // Sequential
+    _z_tx_queue_t *queue = _z_tx_queue_new(5);
+    assert(queue != NULL);
+    assert(_z_tx_queue_capacity(queue) == 8);
+    assert(_z_tx_queue_pop(queue, false) == NULL);
+    for (_z_zint_t i = 0; i < 8; i++) {
+        _z_network_message_t n_msg = _z_n_msg_make_response_final(i);
+        assert(_z_tx_queue_push(queue, &n_msg, Z_RELIABILITY_BEST_EFFORT, Z_CONGESTION_CONTROL_DROP) == _Z_RES_OK);
+    }
+    _z_network_message_t n_msg = _z_n_msg_make_response_final(8);
+    assert(_z_tx_queue_push(queue, &n_msg, Z_RELIABILITY_BEST_EFFORT, Z_CONGESTION_CONTROL_DROP) ==
+           _Z_ERR_TRANSPORT_NO_SPACE);
+    for (_z_zint_t i = 0; i < 8; i++) {
+        _z_tx_queue_entry_t *entry = _z_tx_queue_pop(queue, false);
+        assert(entry != NULL);
+        assert(entry->_reliability == Z_RELIABILITY_BEST_EFFORT);
+        assert(entry->_priority == _z_n_msg_get_priority(&n_msg));
+        assert(tx_queue_entry_rid(entry) == i);
+        _z_tx_queue_entry_free(&entry);
+        assert(entry == NULL);
+    }
+    assert(_z_tx_queue_pop(queue, false) == NULL);
+    // Left over messages are freed with the queue
+    assert(_z_tx_queue_push(queue, &n_msg, Z_RELIABILITY_BEST_EFFORT, Z_CONGESTION_CONTROL_DROP) == _Z_RES_OK);
+    _z_tx_queue_free(&queue);
+    assert(queue == NULL);
+
+    // Concurrent producers blocking on a small queue, messages of each producer are popped in order
+    queue = _z_tx_queue_new(4);
+    assert(queue != NULL);
+    z_task_t tasks[TX_QUEUE_PRODUCERS];
+    tx_queue_producer_t producers[TX_QUEUE_PRODUCERS];
+    _z_zint_t next[TX_QUEUE_PRODUCERS];
+    for (_z_zint_t i = 0; i < TX_QUEUE_PRODUCERS; i++) {
+        producers[i] = (tx_queue_producer_t){.queue = queue, .producer = i};
+        next[i] = 0;
+        assert(z_task_init(&tasks[i], NULL, tx_queue_producer, &producers[i]) == _Z_RES_OK);
+    }
+    size_t popped = 0;
+    while (popped < (size_t)(TX_QUEUE_PRODUCERS * TX_QUEUE_MSGS)) {
+        _z_tx_queue_entry_t *entry = _z_tx_queue_pop(queue, true);
+        assert(entry != NULL);
+        _z_zint_t rid = tx_queue_entry_rid(entry);
+        _z_zint_t producer = rid / TX_QUEUE_MSGS;
+        assert(producer < TX_QUEUE_PRODUCERS);
+        assert(rid % TX_QUEUE_MSGS == next[producer]);
+        next[producer]++;
+        popped++;
+        _z_tx_queue_entry_free(&entry);
+    }
+    for (size_t i = 0; i < TX_QUEUE_PRODUCERS; i++) {
+        z_task_join(&tasks[i]);
+    }
+    assert(_z_tx_queue_pop(queue, false) == NULL);
+
+    // Waking up the consumer of an empty queue
+    _z_tx_queue_wake(queue);
+    assert(_z_tx_queue_pop(queue, true) == NULL);
+    _z_tx_queue_free(&queue);
+}
+
+#define RING_MT_PRODUCERS 4
+#define RING_MT_ELEMS 2000
+
+static size_t ring_mt_freed = 0;
+
+static void ring_mt_elem_free(void **elem) {
+    z_free(*elem);
+    *elem = NULL;
+    ring_mt_freed++;
+}
+
+static size_t *ring_mt_elem(size_t val) {
+    size_t *elem = (size_t *)z_malloc(sizeof(size_t));
+    assert(elem != NULL);
+    *elem = val;
+    return elem;
+}
+
+static size_t ring_mt_take(size_t *elem) {
+    assert(elem != NULL);
+    size_t val = *elem;
+    z_free(elem);
+    return val;
+}
+
+typedef struct {
+    _z_ring_mt_t *ring;
+    size_t producer;
+} ring_mt_producer_t;
+
+static void *ring_mt_producer(void *arg) {
+    ring_mt_producer_t *p = (ring_mt_producer_t *)arg;
+    for (size_t i = 0; i < RING_MT_ELEMS; i++) {
+        assert(_z_ring_mt_push(p->ring, ring_mt_elem(p->producer * RING_MT_ELEMS + i)) == true);
+    }
+    return NULL;
+}
+
+static void *ring_mt_consumer(void *arg) {
+    assert(_z_ring_mt_pull((_z_ring_mt_t *)arg) == NULL);
+    return NULL;
+}
+
+static void *ring_mt_waker(void *arg) {
+    z_sleep_ms(10);
+    _z_ring_mt_wake((_z_ring_mt_t *)arg);
+    return NULL;
+}
+
+void ring_mt_test(void) {
+    printf(">>> ring-mt\r\n");
+
+    // Sequential, forced pushes drop the oldest elements
+    _z_ring_mt_t *ring = _z_ring_mt_new(5, ring_mt_elem_free);
+    assert(ring != NULL);
+    assert(_z_ring_mt_capacity(ring) == 8);
+    assert(_z_ring_mt_try_pull(ring) == NULL);
+    for (size_t i = 0; i < 8; i++) {
+        assert(_z_ring_mt_push(ring, ring_mt_elem(i)) == true);
+    }
+    for (size_t i = 8; i < 12; i++) {
+        assert(_z_ring_mt_push_force(ring, ring_mt_elem(i)) == true);
+    }
+    assert(ring_mt_freed == 4);
+    for (size_t i = 4; i < 12; i++) {
+        assert(ring_mt_take((size_t *)_z_ring_mt_try_pull(ring)) == i);
+    }
+    assert(_z_ring_mt_try_pull(ring) == NULL);
+
+    // Left over elements are freed with the last owner of the ring
+    _z_ring_mt_t *clone = _z_ring_mt_clone(ring);
+    assert(_z_ring_mt_push(ring, ring_mt_elem(0)) == true);
+    _z_ring_mt_free(&ring);
+    assert(ring == NULL);
+    assert(ring_mt_freed == 4);
+    _z_ring_mt_free(&clone);
+    assert(ring_mt_freed == 5);
+
+    // Concurrent producers blocking on a small ring, elements of each producer are pulled in order
+    ring = _z_ring_mt_new(4, ring_mt_elem_free);
+    assert(ring != NULL);
+    z_task_t tasks[RING_MT_PRODUCERS];
+    ring_mt_producer_t producers[RING_MT_PRODUCERS];
+    size_t next[RING_MT_PRODUCERS];
+    for (size_t i = 0; i < RING_MT_PRODUCERS; i++) {
+        producers[i] = (ring_mt_producer_t){.ring = ring, .producer = i};
+        next[i] = 0;
+        assert(z_task_init(&tasks[i], NULL, ring_mt_producer, &producers[i]) == _Z_RES_OK);
+    }
+    for (size_t n = 0; n < (size_t)(RING_MT_PRODUCERS * RING_MT_ELEMS); n++) {
+        size_t val = ring_mt_take((size_t *)_z_ring_mt_pull(ring));
+        size_t producer = val / RING_MT_ELEMS;
+        assert(producer < RING_MT_PRODUCERS);
+        assert(val % RING_MT_ELEMS == next[producer]);
+        next[producer]++;
+    }
+    for (size_t i = 0; i < RING_MT_PRODUCERS; i++) {
+        z_task_join(&tasks[i]);
+    }
+    assert(_z_ring_mt_try_pull(ring) == NULL);
+
+    // Pushing without waiting leaves the element to the caller while the ring is full
+    size_t *elem = ring_mt_elem(4);
+    for (size_t i = 0; i < 4; i++) {
+        assert(_z_ring_mt_try_push(ring, ring_mt_elem(i)) == true);
+    }
+    assert(_z_ring_mt_try_push(ring, elem) == false);
+    assert(ring_mt_take((size_t *)_z_ring_mt_pull(ring)) == 0);
+    assert(_z_ring_mt_try_push(ring, elem) == true);
+    for (size_t i = 1; i < 5; i++) {
+        assert(ring_mt_take((size_t *)_z_ring_mt_pull(ring)) == i);
+    }
+
+    // Waking up a waiting consumer makes it return without closing the ring
+    z_task_t waker;
+    assert(z_task_init(&waker, NULL, ring_mt_waker, ring) == _Z_RES_OK);
+    assert(_z_ring_mt_pull(ring) == NULL);
+    z_task_join(&waker);
+    assert(_z_ring_mt_is_closed(ring) == false);
+
+    // Closing wakes up a waiting consumer, and drops the next pushed elements
+    z_task_t consumer;
+    assert(z_task_init(&consumer, NULL, ring_mt_consumer, ring) == _Z_RES_OK);
+    z_sleep_ms(10);
+    _z_ring_mt_close(ring);
+    z_task_join(&consumer);
+    assert(_z_ring_mt_is_closed(ring) == true);
+    assert(_z_ring_mt_push(ring, ring_mt_elem(0)) == false);
+    assert(ring_mt_freed == 6);
+    assert(_z_ring_mt_pull(ring) == NULL);
+    _z_ring_mt_free(&ring);
+}
+#else
+void tx_queue_test(void) {}
+void ring_mt_test(void) {}
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
 int main(void) {
     entry_list_test();
+    peer_index_test();
+    peer_lease_heap_test();
+    ketree_test();
+    tx_queue_test();
+    ring_mt_test();
     char *s = (char *)malloc(64);
     size_t len = 128;
 
@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include "zenoh-pico/protocol/iobuf.h"
+#include "zenoh-pico/utils/result.h"
 
 #undef NDEBUG
 #include <assert.h>
@@ -554,6 +555,101 @@ void wbuf_add_iosli(void) {
     _z_wbuf_clear(&wbf);
 }
 
+void wbuf_siphon(void) {
+    _z_wbuf_t src = _z_wbuf_make(16, true);
+    printf("\n>>> WBuf => Siphon\n");
+
+    size_t len = 1 + gen_uint8();
+    for (size_t i = 0; i < len; i++) {
+        _z_wbuf_write(&src, (uint8_t)i);
+    }
+
+    // Copy the bytes in chunks, crossing the ioslices of both buffers
+    _z_wbuf_t dst = gen_wbuf(len);
+    size_t siphoned = 0;
+    while (siphoned < len) {
+        size_t to_siphon = 1 + (gen_size_t() % (len - siphoned));
+        if (dst._expansion_step == 0) {
+            size_t space_left = _z_wbuf_capacity(&dst) - _z_wbuf_len(&dst);
+            to_siphon = (to_siphon < space_left) ? to_siphon : space_left;
+        }
+        if (to_siphon == 0) {
+            assert(_z_wbuf_siphon(&dst, &src, 1) == _Z_ERR_TRANSPORT_NO_SPACE);
+            break;
+        }
+        assert(_z_wbuf_siphon(&dst, &src, to_siphon) == _Z_RES_OK);
+        siphoned = siphoned + to_siphon;
+    }
+    assert(_z_wbuf_len(&dst) == siphoned);
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(&dst);
+    for (size_t i = 0; i < siphoned; i++) {
+        assert(_z_zbuf_read(&zbf) == (uint8_t)i);
+    }
+    _z_zbuf_clear(&zbf);
+    _z_wbuf_clear(&dst);
+
+    // Alias the bytes instead, after a header written on the destination
+    _z_wbuf_reset(&src);
+    for (size_t i = 0; i < len; i++) {
+        _z_wbuf_write(&src, (uint8_t)i);
+    }
+    dst = _z_wbuf_make(4, false);
+    _z_wbuf_write(&dst, 0xff);
+    assert(_z_wbuf_siphon_view(&dst, &src, len) == _Z_RES_OK);
+    assert(_z_wbuf_len(&dst) == len + 1);
+    assert(_z_wbuf_len(&src) == 0);
+    zbf = _z_wbuf_to_zbuf(&dst);
+    assert(_z_zbuf_read(&zbf) == 0xff);
+    for (size_t i = 0; i < len; i++) {
+        assert(_z_zbuf_read(&zbf) == (uint8_t)i);
+    }
+    _z_zbuf_clear(&zbf);
+
+    // Resetting the destination drops all the aliasing ioslices
+    _z_wbuf_reset(&dst);
+    assert(_z_wbuf_len_iosli(&dst) == 1);
+    assert(_z_wbuf_len(&dst) == 0);
+    assert(_z_wbuf_space_left(&dst) == 4);
+
+    _z_wbuf_clear(&dst);
+    _z_wbuf_clear(&src);
+}
+
+void wbuf_wrap_bytes(void) {
+    _z_wbuf_t wbf = _z_wbuf_make(32, false);
+    printf("\n>>> WBuf => Wrap bytes\n");
+
+    uint8_t payload[16];
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = (uint8_t)i;
+    }
+
+    // The wrapped bytes are not copied but count in the capacity of a non-expandable buffer
+    _z_wbuf_write(&wbf, 0xaa);
+    assert(_z_wbuf_wrap_bytes(&wbf, payload, 0, sizeof(payload)) == _Z_RES_OK);
+    assert(_z_wbuf_len_iosli(&wbf) == 3);
+    assert(_z_iosli_to_bytes(_z_wbuf_get_iosli(&wbf, 1)).start == payload);
+    assert(_z_wbuf_space_left(&wbf) == 32 - 1 - sizeof(payload));
+    assert(_z_wbuf_wrap_bytes(&wbf, payload, 0, sizeof(payload)) == _Z_ERR_TRANSPORT_NO_SPACE);
+    _z_wbuf_write(&wbf, 0xbb);
+    assert(_z_wbuf_len(&wbf) == sizeof(payload) + 2);
+
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+    assert(_z_zbuf_read(&zbf) == 0xaa);
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        assert(_z_zbuf_read(&zbf) == (uint8_t)i);
+    }
+    assert(_z_zbuf_read(&zbf) == 0xbb);
+    _z_zbuf_clear(&zbf);
+
+    // Resetting the buffer drops the wrapped bytes and gives back the whole capacity
+    _z_wbuf_reset(&wbf);
+    assert(_z_wbuf_len_iosli(&wbf) == 1);
+    assert(_z_wbuf_space_left(&wbf) == 32);
+
+    _z_wbuf_clear(&wbf);
+}
+
 /*=============================*/
 /*            Main             */
 /*=============================*/
@@ -570,6 +666,8 @@ int main(void) {
         wbuf_writable_readable();
         wbuf_set_pos_wbuf_get_pos();
         wbuf_add_iosli();
+        wbuf_siphon();
+        wbuf_wrap_bytes();
         // WBuf and ZBuf
         wbuf_write_zbuf_read();
         wbuf_write_zbuf_read_bytes();
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_MEMORY_POOLS == 1 && Z_FEATURE_PUBLICATION == 1 && Z_FEATURE_SUBSCRIPTION == 1 && \
+    Z_FEATURE_MULTI_THREAD == 1
+
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof(array[0]))
+#define MAX_POOLS 16
+#define MSG 200
+#define MSG_LEN 256
+#define SLEEP_MS 10
+#define TIMEOUT 30
+
+const char *keyexpr = "test/pools/data";
+
+volatile unsigned int datas = 0;
+void data_handler(const z_sample_t *sample, void *arg) {
+    assert(sample->payload.len == MSG_LEN);
+    (void)(sample);
+    (void)(arg);
+    datas++;
+}
+
+static size_t memory_stats(zp_memory_pool_stats_t *stats) {
+    size_t pools = zp_memory_stats(stats, MAX_POOLS);
+    assert((pools > 0) && (pools <= MAX_POOLS));
+    return pools;
+}
+
+static void print_memory_stats(const char *when, const zp_memory_pool_stats_t *stats, size_t pools) {
+    printf("Memory pools %s:\n", when);
+    for (size_t i = 0; i < pools; i++) {
+        printf("  %6zu bytes: %3zu/%3zu blocks in use, high-water %3zu, %zu misses\n", stats[i].block_size,
+               stats[i].in_use, stats[i].blocks, stats[i].high_water, stats[i].misses);
+    }
+}
+
+static z_owned_session_t open_session(const char *locator) {
+    z_owned_config_t config = z_config_default();
+    zp_config_insert(z_loan(config), Z_CONFIG_MODE_KEY, z_string_make("peer"));
+    zp_config_insert(z_loan(config), Z_CONFIG_LISTEN_KEY, z_string_make(locator));
+    z_owned_session_t s = z_open(z_move(config));
+    assert(z_check(s));
+    zp_start_read_task(z_loan(s), NULL);
+    zp_start_lease_task(z_loan(s), NULL);
+    return s;
+}
+
+// Publish until the subscriber has received ``count`` more samples
+static void publish(z_owned_publisher_t *pub, const uint8_t *payload, unsigned int count) {
+    unsigned int expected = datas + count;
+    z_time_t start = z_time_now();
+    while (datas < expected) {
+        assert(z_time_elapsed_s(&start) < TIMEOUT);
+        (void)(start);
+        z_publisher_put(z_loan(*pub), payload, MSG_LEN, NULL);
+        z_sleep_ms(SLEEP_MS);
+    }
+}
+
+int main(int argc, char **argv) {
+    setvbuf(stdout, NULL, _IOLBF, 1024);
+    const char *locator = (argc > 1) ? argv[1] : "udp/224.0.0.224:7447#iface=lo";
+
+    zp_memory_pool_stats_t before[MAX_POOLS];
+    zp_memory_pool_stats_t after[MAX_POOLS];
+    size_t pools = memory_stats(before);
+    print_memory_stats("at startup", before, pools);
+
+    z_owned_session_t s1 = open_session(locator);
+    z_owned_session_t s2 = open_session(locator);
+
+    z_owned_closure_sample_t callback = z_closure(data_handler, NULL, NULL);
+    z_owned_subscriber_t sub = z_declare_subscriber(z_loan(s2), z_keyexpr(keyexpr), z_move(callback), NULL);
+    assert(z_check(sub));
+    z_owned_publisher_t pub = z_declare_publisher(z_loan(s1), z_keyexpr(keyexpr), NULL);
+    assert(z_check(pub));
+
+    uint8_t payload[MSG_LEN];
+    memset(payload, 1, MSG_LEN);
+
+    // Let the sessions discover each other and every allocation of the data path happen once
+    publish(&pub, payload, MSG);
+    z_sleep_ms(Z_JOIN_INTERVAL);
+    publish(&pub, payload, MSG);
+    z_sleep_ms(SLEEP_MS * 10);
+    memory_stats(before);
+    print_memory_stats("after warm-up", before, pools);
+
+    // In steady state, publishing and receiving samples only reuses the blocks freed by the previous ones
+    publish(&pub, payload, MSG);
+    z_sleep_ms(SLEEP_MS * 10);
+    memory_stats(after);
+    print_memory_stats("in steady state", after, pools);
+    for (size_t i = 0; i < pools; i++) {
+        assert(after[i].in_use == before[i].in_use);
+        assert(after[i].high_water == before[i].high_water);
+        assert(after[i].misses == 0);
+    }
+
+    z_undeclare_publisher(z_move(pub));
+    z_undeclare_subscriber(z_move(sub));
+    zp_stop_read_task(z_loan(s1));
+    zp_stop_lease_task(z_loan(s1));
+    zp_stop_read_task(z_loan(s2));
+    zp_stop_lease_task(z_loan(s2));
+    z_close(z_move(s1));
+    z_close(z_move(s2));
+
+    // Every block is back in its pool once the sessions are closed
+    memory_stats(after);
+    print_memory_stats("after closing", after, pools);
+    for (size_t i = 0; i < pools; i++) {
+        assert(after[i].in_use == 0);
+    }
+    return 0;
+}
+#else
+int main(void) {
+    printf("ERROR: Zenoh pico was compiled without Z_FEATURE_MEMORY_POOLS but this test requires it.\n");
+    return -2;
+}
+#endif
@@ -13,8 +13,10 @@
 //
 
 #include "zenoh-pico/api/constants.h"
+#include "zenoh-pico/api/types.h"
 #include "zenoh-pico/protocol/codec/message.h"
 #include "zenoh-pico/protocol/codec/network.h"
+#include "zenoh-pico/protocol/codec/serial.h"
 #include "zenoh-pico/protocol/definitions/message.h"
 #include "zenoh-pico/protocol/definitions/transport.h"
 #define ZENOH_PICO_TEST_H
@@ -39,6 +41,9 @@
 #include "zenoh-pico/protocol/iobuf.h"
 #include "zenoh-pico/protocol/keyexpr.h"
 #include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/transport/utils.h"
+#include "zenoh-pico/utils/checksum.h"
+#include "zenoh-pico/utils/encoding.h"
 
 #undef NDEBUG
 #include <assert.h>
@@ -463,6 +468,49 @@ void zbuf_extension(void) {
 /*=============================*/
 /*       Message Fields        */
 /*=============================*/
+/*------------------ Zint field ------------------*/
+void zint_field(void) {
+    printf("\n>> Zint field\n");
+    // A value of each encoded length, from 1 to 10 bytes
+    uint64_t e_u = gen_uint64() >> (gen_uint8() % 64);
+    // Tiny expansion steps make the varint span several slices
+    size_t step = 1 + (gen_uint8() % 12);
+    _z_wbuf_t wbf = gen_bool() ? _z_wbuf_make(step, true) : gen_wbuf(65535);
+
+    // Encode
+    int8_t res = _z_zint64_encode(&wbf, e_u);
+    assert(res == _Z_RES_OK);
+    res = _z_zint_encode(&wbf, (_z_zint_t)e_u);
+    assert(res == _Z_RES_OK);
+
+    // Decode
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+    uint64_t d_u;
+    res = _z_zint64_decode(&d_u, &zbf);
+    assert(res == _Z_RES_OK);
+    size_t len = _z_zbuf_get_rpos(&zbf);
+    printf("   %ju:%ju\n", (uintmax_t)e_u, (uintmax_t)d_u);
+    assert(e_u == d_u);
+    _z_zint_t d_z;
+    res = _z_zint_decode(&d_z, &zbf);
+    assert(res == _Z_RES_OK);
+    assert((_z_zint_t)e_u == d_z);
+    assert(_z_zbuf_len(&zbf) == 0);
+
+    // A truncated varint is an error
+    _z_zbuf_set_rpos(&zbf, 0);
+    _z_zbuf_set_wpos(&zbf, len - 1);
+    if (e_u > 0x7f) {
+        res = _z_zint64_decode(&d_u, &zbf);
+        assert(res != _Z_RES_OK);
+    }
+    (void)(res);
+
+    // Free
+    _z_zbuf_clear(&zbf);
+    _z_wbuf_clear(&wbf);
+}
+
 /*------------------ Payload field ------------------*/
 void assert_eq_bytes(const _z_bytes_t *left, const _z_bytes_t *right) { assert_eq_uint8_array(left, right); }
 
@@ -659,6 +707,11 @@ void keyexpr_field(void) {
     printf("   ");
     assert_eq_keyexpr(&e_rk, &d_rk);
     printf("\n");
+    // The suffix is borrowed from the buffer
+    if (d_rk._suffix != NULL) {
+        assert(_z_keyexpr_owns_suffix(&d_rk) == false);
+        assert(((uint8_t *)d_rk._suffix >= zbf._ios._buf) && ((uint8_t *)d_rk._suffix < _z_zbuf_get_rptr(&zbf)));
+    }
 
     // Free
     _z_keyexpr_clear(&e_rk);
@@ -1103,6 +1156,119 @@ void push_body_message(void) {
     _z_wbuf_clear(&wbf);
 }
 
+#if Z_FEATURE_ATTACHMENT == 1
+/*------------------ Attachment field ------------------*/
+#define _Z_TEST_ATTACHMENT_PAIRS 8
+
+typedef struct {
+    _z_bytes_t keys[_Z_TEST_ATTACHMENT_PAIRS];
+    _z_bytes_t values[_Z_TEST_ATTACHMENT_PAIRS];
+    size_t len;
+} attachment_pairs_t;
+
+// An attachment that is only iterable, as a user defined one would be
+int8_t attachment_pairs_iteration_driver(const void *this_, z_attachment_iter_body_t body, void *ctx) {
+    const attachment_pairs_t *pairs = (const attachment_pairs_t *)this_;
+    for (size_t i = 0; i < pairs->len; i++) {
+        int8_t ret = body(pairs->keys[i], pairs->values[i], ctx);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    return 0;
+}
+
+int8_t assert_eq_attachment_pair(_z_bytes_t key, _z_bytes_t value, void *ctx) {
+    attachment_pairs_t *pairs = (attachment_pairs_t *)ctx;
+    assert_eq_bytes(&key, &pairs->keys[pairs->len]);
+    assert_eq_bytes(&value, &pairs->values[pairs->len]);
+    pairs->len++;
+    return 0;
+}
+
+_z_bytes_t encode_put_with_attachment(_z_bytes_t payload, z_attachment_t att) {
+    _z_push_body_t pshb = {._is_put = true,
+                           ._body._put = {._commons = {._source_info = _z_source_info_null(),
+                                                       ._timestamp = _z_timestamp_null()},
+                                          ._payload = payload,
+                                          ._encoding = {.prefix = Z_ENCODING_PREFIX_EMPTY},
+                                          ._attachment = {.is_encoded = false, .body.decoded = att}}};
+    _z_wbuf_t wbf = _z_wbuf_make(UINT16_MAX, false);
+    assert(_z_push_body_encode(&wbf, &pshb) == _Z_RES_OK);
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+    _z_bytes_t encoded;
+    _z_bytes_copy(&encoded, &(_z_bytes_t){.start = _z_zbuf_get_rptr(&zbf), .len = _z_zbuf_len(&zbf)});
+    _z_zbuf_clear(&zbf);
+    _z_wbuf_clear(&wbf);
+    return encoded;
+}
+
+void attachment_field(void) {
+    printf("\n>> Attachment field\n");
+    attachment_pairs_t pairs = {.len = 1 + (gen_uint8() % _Z_TEST_ATTACHMENT_PAIRS)};
+    z_owned_attachment_builder_t builder = z_attachment_builder_new(gen_uint8() % 32);
+    assert(z_attachment_builder_check(&builder));
+    for (size_t i = 0; i < pairs.len; i++) {
+        pairs.keys[i] = gen_bytes(16);
+        ((uint8_t *)pairs.keys[i].start)[0] = (uint8_t)i;  // Distinct keys
+        pairs.values[i] = gen_bool() ? gen_bytes(200) : _z_bytes_empty();
+        assert(z_attachment_builder_insert(&builder, pairs.keys[i], pairs.values[i]) == _Z_RES_OK);
+    }
+    z_attachment_t iterated = {.data = &pairs, .iteration_driver = attachment_pairs_iteration_driver};
+    z_attachment_t built = z_attachment_builder_as_attachment(&builder);
+    assert(_z_attachment_estimate_length(built) == _z_attachment_estimate_length(iterated));
+
+    // The builder lays the pairs out as they are encoded
+    _z_bytes_t payload = gen_bytes(64);
+    _z_bytes_t e_iterated = encode_put_with_attachment(payload, iterated);
+    _z_bytes_t e_built = encode_put_with_attachment(payload, built);
+    assert_eq_bytes(&e_iterated, &e_built);
+
+    // A received attachment aliases the received bytes
+    _z_zbuf_t zbf = _z_zbytes_as_zbuf(e_built);
+    _z_push_body_t d_pshb = {0};
+    uint8_t header = _z_zbuf_read(&zbf);
+    assert(_z_push_body_decode(&d_pshb, &zbf, header) == _Z_RES_OK);
+    assert(d_pshb._body._put._attachment.is_encoded == true);
+    const _z_bytes_t *d_att = &d_pshb._body._put._attachment.body.encoded;
+    assert(d_att->_is_alloc == false);
+    assert((d_att->start > e_built.start) && (d_att->start < &e_built.start[e_built.len]));
+    z_attachment_t received = _z_encoded_as_attachment(&d_pshb._body._put._attachment);
+    attachment_pairs_t visited = {.len = 0};
+    memcpy(visited.keys, pairs.keys, sizeof(pairs.keys));
+    memcpy(visited.values, pairs.values, sizeof(pairs.values));
+    assert(z_attachment_iterate(received, assert_eq_attachment_pair, &visited) == 0);
+    assert(visited.len == pairs.len);
+    for (size_t i = 0; i < pairs.len; i++) {
+        _z_bytes_t value = z_attachment_get(received, pairs.keys[i]);
+        assert_eq_bytes(&value, &pairs.values[i]);
+    }
+    uint8_t missing = 0xFF;
+    assert(z_attachment_get(received, _z_bytes_wrap(&missing, 1)).start == NULL);
+    _z_push_body_clear(&d_pshb);
+
+    // A cleared builder is reused for the next attachment
+    z_attachment_builder_clear(&builder);
+    assert(_z_attachment_estimate_length(z_attachment_builder_as_attachment(&builder)) == 0);
+    assert(z_attachment_builder_insert(&builder, pairs.keys[0], pairs.values[0]) == _Z_RES_OK);
+    assert(_z_attachment_estimate_length(z_attachment_builder_as_attachment(&builder)) ==
+           _z_bytes_encode_len(&pairs.keys[0]) + _z_bytes_encode_len(&pairs.values[0]));
+
+    z_attachment_builder_drop(&builder);
+    z_attachment_builder_drop(&builder);
+    assert(!z_attachment_builder_check(&builder));
+    built = z_attachment_builder_as_attachment(&builder);
+    assert(!z_attachment_check(&built));
+    for (size_t i = 0; i < pairs.len; i++) {
+        _z_bytes_clear(&pairs.keys[i]);
+        _z_bytes_clear(&pairs.values[i]);
+    }
+    _z_bytes_clear(&payload);
+    _z_bytes_clear(&e_iterated);
+    _z_bytes_clear(&e_built);
+}
+#endif
+
 /*------------------ Pull message ------------------*/
 _z_msg_pull_t gen_pull_message(void) { return (_z_msg_pull_t){._ext_source_info = _z_source_info_null()}; }
 
@@ -1287,6 +1453,35 @@ void push_message(void) {
     _z_wbuf_clear(&wbf);
 }
 
+void push_header_message(void) {
+    printf("\n>> Push message with pre-encoded header\n");
+    _z_n_msg_push_t expected = gen_push();
+    if (expected._body._is_put == false) {
+        _z_push_body_clear(&expected._body);
+        expected._body = (_z_push_body_t){._is_put = true, ._body._put = {._encoding = gen_encoding()}};
+    }
+    _z_bytes_t header;
+    assert(_z_push_header_make(&header, &expected) == _Z_RES_OK);
+    _z_bytes_clear(&expected._body._body._put._payload);
+    expected._body._body._put._payload = gen_bytes(64);
+
+    // Only the payload is encoded after the header, the rest of the message is ignored
+    _z_wbuf_t wbf = gen_wbuf(UINT16_MAX);
+    _z_n_msg_push_t push = {._body = {._is_put = true, ._body._put._payload = expected._body._body._put._payload},
+                            ._header = header};
+    assert(_z_push_encode(&wbf, &push) == _Z_RES_OK);
+    _z_n_msg_push_t decoded;
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+    uint8_t msg_header = _z_zbuf_read(&zbf);
+    assert(_Z_RES_OK == _z_push_decode(&decoded, &zbf, msg_header));
+    assert_eq_push(&expected, &decoded);
+    _z_n_msg_push_clear(&decoded);
+    _z_n_msg_push_clear(&expected);
+    _z_bytes_clear(&header);
+    _z_zbuf_clear(&zbf);
+    _z_wbuf_clear(&wbf);
+}
+
 _z_n_msg_request_t gen_request(void) {
     _z_n_msg_request_t request = {
         ._rid = gen_uint64(),
@@ -1657,37 +1852,64 @@ void assert_eq_net_msg(const _z_network_message_t *left, const _z_network_messag
         } break;
     }
 }
-_z_network_message_vec_t gen_net_msgs(size_t n) {
-    _z_network_message_vec_t ret = _z_network_message_vec_make(n);
+// The payload of a frame is a view on the buffer it has been decoded from: the generated ones are owned by the test
+_z_zbuf_t gen_frame_payload(_z_network_message_t *msgs, size_t n) {
+    _z_wbuf_t wbf = gen_wbuf(UINT16_MAX);
     for (size_t i = 0; i < n; i++) {
-        _z_network_message_t *msg = (_z_network_message_t *)z_malloc(sizeof(_z_network_message_t));
-        *msg = gen_net_msg();
-        _z_network_message_vec_append(&ret, msg);
+        msgs[i] = gen_net_msg();
+        assert(_z_network_message_encode(&wbf, &msgs[i]) == _Z_RES_OK);
     }
+    _z_zbuf_t ret = _z_wbuf_to_zbuf(&wbf);
+    _z_wbuf_clear(&wbf);
     return ret;
 }
 
 _z_transport_message_t gen_frame(void) {
-    return _z_t_msg_make_frame(gen_uint(), gen_net_msgs(gen_uint8() % 16), gen_bool());
+    _z_network_message_t msgs[16];
+    size_t n = gen_uint8() % 16;
+    _z_zbuf_t payload = gen_frame_payload(msgs, n);
+    for (size_t i = 0; i < n; i++) {
+        _z_n_msg_clear(&msgs[i]);
+    }
+    return _z_t_msg_make_frame(gen_uint(), payload, gen_bool());
+}
+void frame_payload_clear(_z_transport_message_t *msg) {
+    if (_Z_MID(msg->_header) == _Z_MID_T_FRAME) {
+        _z_zbuf_clear(&msg->_body._frame._payload);
+    }
 }
 void assert_eq_frame(const _z_t_msg_frame_t *left, const _z_t_msg_frame_t *right) {
     assert(left->_sn == right->_sn);
-    assert(left->_messages._len == right->_messages._len);
-    for (size_t i = 0; i < left->_messages._len; i++) {
-        assert_eq_net_msg(left->_messages._val[i], right->_messages._val[i]);
-    }
+    assert(_z_zbuf_len(&left->_payload) == _z_zbuf_len(&right->_payload));
+    assert(memcmp(_z_zbuf_get_rptr(&left->_payload), _z_zbuf_get_rptr(&right->_payload),
+                  _z_zbuf_len(&left->_payload)) == 0);
 }
 void frame_message(void) {
     printf("\n>> frame message\n");
     _z_wbuf_t wbf = gen_wbuf(UINT16_MAX);
-    _z_transport_message_t expected = gen_frame();
+    _z_network_message_t msgs[16];
+    size_t n = gen_uint8() % 16;
+    _z_transport_message_t expected = _z_t_msg_make_frame(gen_uint(), gen_frame_payload(msgs, n), gen_bool());
     assert(_z_frame_encode(&wbf, expected._header, &expected._body._frame) == _Z_RES_OK);
     _z_t_msg_frame_t decoded;
     _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
     int8_t ret = _z_frame_decode(&decoded, &zbf, expected._header);
     assert(_Z_RES_OK == ret);
+    assert(_z_zbuf_len(&zbf) == 0);
     assert_eq_frame(&expected._body._frame, &decoded);
+
+    // The network messages are decoded one by one from the frame payload
+    for (size_t i = 0; i < n; i++) {
+        _z_network_message_t nm;
+        assert(_z_frame_decode_message(&decoded, &nm) == _Z_RES_OK);
+        assert_eq_net_msg(&msgs[i], &nm);
+        _z_n_msg_clear(&nm);
+        _z_n_msg_clear(&msgs[i]);
+    }
+    assert(_z_zbuf_len(&decoded._payload) == 0);
+
     _z_t_msg_frame_clear(&decoded);
+    frame_payload_clear(&expected);
     _z_t_msg_clear(&expected);
     _z_zbuf_clear(&zbf);
     _z_wbuf_clear(&wbf);
@@ -1716,6 +1938,62 @@ void fragment_message(void) {
     _z_wbuf_clear(&wbf);
 }
 
+#if Z_FEATURE_FRAGMENTATION == 1
+void defragmentation(void) {
+    printf("\n>> defragmentation\n");
+    _z_defrag_buf_t dbuf;
+    assert(_z_defrag_buf_init(&dbuf) == _Z_RES_OK);
+
+    // Split an encoded network message into fragments, then reassemble them from their decoded payloads
+    _z_network_message_t expected;
+    _z_zbuf_t payload = gen_frame_payload(&expected, 1);
+    size_t len = _z_zbuf_len(&payload);
+    size_t chunk = (size_t)1 + (gen_uint8() % 32);
+    for (size_t offset = 0; offset < len; offset += chunk) {
+        size_t n = ((len - offset) < chunk) ? (len - offset) : chunk;
+        _z_bytes_t bytes = _z_bytes_wrap(_z_zbuf_get_rptr(&payload) + offset, n);
+        _z_transport_message_t fragment = _z_t_msg_make_fragment(gen_uint(), bytes, true, (offset + n) < len);
+        _z_wbuf_t wbf = gen_wbuf(UINT16_MAX);
+        assert(_z_fragment_encode(&wbf, fragment._header, &fragment._body._fragment) == _Z_RES_OK);
+        _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+        _z_t_msg_fragment_t decoded;
+        assert(_z_fragment_decode(&decoded, &zbf, fragment._header) == _Z_RES_OK);
+        assert(_z_defrag_buf_push(&dbuf, &decoded._payload) == _Z_RES_OK);
+        _z_t_msg_fragment_clear(&decoded);
+        _z_zbuf_clear(&zbf);
+        _z_wbuf_clear(&wbf);
+    }
+    assert(_z_zbuf_len(&dbuf._buf) == len);
+    assert(_z_zbuf_capacity(&dbuf._buf) <= Z_FRAG_MAX_SIZE);
+
+    // The reassembled message is decoded in place
+    _z_network_message_t decoded;
+    assert(_z_network_message_decode(&decoded, &dbuf._buf) == _Z_RES_OK);
+    assert_eq_net_msg(&expected, &decoded);
+    _z_n_msg_clear(&decoded);
+    _z_n_msg_clear(&expected);
+    _z_zbuf_clear(&payload);
+    _z_defrag_buf_reset(&dbuf);
+    assert(_z_zbuf_len(&dbuf._buf) == 0);
+
+    // A message exceeding Z_FRAG_MAX_SIZE is dropped along with its remaining fragments
+    uint8_t *big = (uint8_t *)z_malloc(Z_FRAG_MAX_SIZE);
+    assert(big != NULL);
+    _z_bytes_t bytes = _z_bytes_wrap(big, Z_FRAG_MAX_SIZE);
+    assert(_z_defrag_buf_push(&dbuf, &bytes) == _Z_RES_OK);
+    bytes = _z_bytes_wrap(big, 1);
+    assert(_z_defrag_buf_push(&dbuf, &bytes) != _Z_RES_OK);
+    assert(dbuf._drop == true);
+    assert(_z_defrag_buf_push(&dbuf, &bytes) != _Z_RES_OK);
+    _z_defrag_buf_reset(&dbuf);
+    assert(dbuf._drop == false);
+    assert(_z_defrag_buf_push(&dbuf, &bytes) == _Z_RES_OK);
+    z_free(big);
+
+    _z_defrag_buf_clear(&dbuf);
+}
+#endif
+
 _z_transport_message_t gen_transport(void) {
     switch (gen_uint8() % 7) {
         case 0: {
@@ -1781,6 +2059,7 @@ void transport_message(void) {
     assert(_Z_RES_OK == ret);
     assert_eq_transport(&expected, &decoded);
     _z_t_msg_clear(&decoded);
+    frame_payload_clear(&expected);
     _z_t_msg_clear(&expected);
     _z_zbuf_clear(&zbf);
     _z_wbuf_clear(&wbf);
@@ -1827,6 +2106,126 @@ void scouting_message(void) {
     _z_wbuf_clear(&wbf);
 }
 
+/*=============================*/
+/*        Serial frames        */
+/*=============================*/
+size_t gen_serial_payload(uint8_t *payload) {
+    size_t len = z_random_u32() % (_Z_SERIAL_MTU_SIZE + 1);
+    // Alternate between runs of zeros, of non-zero bytes longer than a COBS block, and of random bytes
+    uint8_t kind = gen_uint8() % 3;
+    for (size_t i = 0; i < len; i++) {
+        if (kind == 0) {
+            payload[i] = (gen_uint8() % 4 == 0) ? 0x00 : gen_uint8();
+        } else if (kind == 1) {
+            payload[i] = (uint8_t)((gen_uint8() % 255) + 1);
+        } else {
+            payload[i] = gen_uint8();
+        }
+    }
+    return len;
+}
+
+// Feed the decoder with chunks of random size, as a serial link would read them
+size_t feed_serial_frames(_z_serial_decoder_t *dec, const uint8_t *raw, size_t len, uint8_t *payloads[],
+                          size_t payload_lens[]) {
+    size_t n = 0;
+    size_t pos = 0;
+    while (pos < len) {
+        size_t chunk = 1 + (gen_uint8() % 64);
+        if (chunk > len - pos) {
+            chunk = len - pos;
+        }
+        size_t end = pos + chunk;
+        while (pos < end) {
+            _Bool complete = false;
+            pos += _z_serial_decoder_feed(dec, &raw[pos], end - pos, &complete);
+            if (complete == true) {
+                payload_lens[n] = _z_serial_decoder_take(dec, payloads[n], _Z_SERIAL_MTU_SIZE);
+                n++;
+            }
+        }
+    }
+    return n;
+}
+
+void serial_frame(void) {
+    printf("\n>> Serial frame\n");
+#define _Z_SERIAL_TEST_FRAMES 3
+    uint8_t *raw = (uint8_t *)z_malloc(_Z_SERIAL_TEST_FRAMES * (_Z_SERIAL_MAX_COBS_BUF_SIZE + 1));
+    uint8_t *ref = (uint8_t *)z_malloc(_Z_SERIAL_MAX_COBS_BUF_SIZE);
+    uint8_t *before_cobs = (uint8_t *)z_malloc(_Z_SERIAL_MFS_SIZE);
+    _z_serial_decoder_t *dec = (_z_serial_decoder_t *)z_malloc(sizeof(_z_serial_decoder_t));
+    uint8_t *payloads[_Z_SERIAL_TEST_FRAMES];
+    uint8_t *decoded[_Z_SERIAL_TEST_FRAMES];
+    size_t lens[_Z_SERIAL_TEST_FRAMES];
+    size_t decoded_lens[_Z_SERIAL_TEST_FRAMES];
+    for (size_t i = 0; i < _Z_SERIAL_TEST_FRAMES; i++) {
+        payloads[i] = (uint8_t *)z_malloc(_Z_SERIAL_MTU_SIZE);
+        decoded[i] = (uint8_t *)z_malloc(_Z_SERIAL_MTU_SIZE);
+    }
+
+    // Several frames in a row, possibly separated by empty ones
+    size_t raw_len = 0;
+    for (size_t i = 0; i < _Z_SERIAL_TEST_FRAMES; i++) {
+        if (gen_bool()) {
+            raw[raw_len++] = 0x00;
+        }
+        lens[i] = gen_serial_payload(payloads[i]);
+        size_t wb = _z_serial_frame_encode(&raw[raw_len], payloads[i], lens[i]);
+        assert(wb != SIZE_MAX);
+
+        // Same bytes on the wire as the COBS encoding of the whole frame
+        size_t n = 0;
+        before_cobs[n++] = (uint8_t)(lens[i] & 0xFF);
+        before_cobs[n++] = (uint8_t)(lens[i] >> 8);
+        memcpy(&before_cobs[n], payloads[i], lens[i]);
+        n += lens[i];
+        uint32_t crc = _z_crc32(payloads[i], lens[i]);
+        for (size_t j = 0; j < sizeof(crc); j++) {
+            before_cobs[n++] = (uint8_t)(crc >> (j * 8));
+        }
+        size_t twb = _z_cobs_encode(before_cobs, n, ref);
+        assert(wb == twb + 1);
+        assert(memcmp(&raw[raw_len], ref, twb) == 0);
+        assert(raw[raw_len + twb] == 0x00);
+        raw_len += wb;
+    }
+
+    _z_serial_decoder_reset(dec);
+    size_t n = feed_serial_frames(dec, raw, raw_len, decoded, decoded_lens);
+    assert(n == _Z_SERIAL_TEST_FRAMES);
+    for (size_t i = 0; i < _Z_SERIAL_TEST_FRAMES; i++) {
+        assert(decoded_lens[i] == lens[i]);
+        assert(memcmp(decoded[i], payloads[i], lens[i]) == 0);
+    }
+
+    // A corrupted frame is dropped without affecting the next one
+    size_t first_len = _z_serial_frame_encode(raw, payloads[0], lens[0]);
+    size_t second_len = _z_serial_frame_encode(&raw[first_len], payloads[1], lens[1]);
+    raw[1 + (gen_uint8() % (first_len - 2))] ^= (uint8_t)((gen_uint8() % 255) + 1);
+    _z_serial_decoder_reset(dec);
+    n = feed_serial_frames(dec, raw, first_len + second_len, decoded, decoded_lens);
+    assert(n >= 2);  // The corrupted byte may have become a delimiter, cutting the frame in two
+    for (size_t i = 0; i < n - 1; i++) {
+        assert(decoded_lens[i] == SIZE_MAX);
+    }
+    assert(decoded_lens[n - 1] == lens[1]);
+    assert(memcmp(decoded[n - 1], payloads[1], lens[1]) == 0);
+
+    // Payloads larger than the MTU are refused
+    assert(_z_serial_frame_encode(raw, payloads[0], _Z_SERIAL_MTU_SIZE + 1) == SIZE_MAX);
+
+    for (size_t i = 0; i < _Z_SERIAL_TEST_FRAMES; i++) {
+        z_free(payloads[i]);
+        z_free(decoded[i]);
+    }
+    z_free(dec);
+    z_free(before_cobs);
+    z_free(ref);
+    z_free(raw);
+#undef _Z_SERIAL_TEST_FRAMES
+}
+
 /*=============================*/
 /*            Main             */
 /*=============================*/
@@ -1837,6 +2236,7 @@ int main(void) {
         printf("\n\n== RUN %u", i);
 
         // Message fields
+        zint_field();
         payload_field();
         timestamp_field();
         keyexpr_field();
@@ -1852,6 +2252,9 @@ int main(void) {
         // Zenoh messages
         declare_message();
         push_body_message();
+#if Z_FEATURE_ATTACHMENT == 1
+        attachment_field();
+#endif
         pull_message();
         query_message();
         err_message();
@@ -1860,6 +2263,7 @@ int main(void) {
 
         // Network messages
         push_message();
+        push_header_message();
         request_message();
         response_message();
         response_final_message();
@@ -1872,10 +2276,16 @@ int main(void) {
         keep_alive_message();
         frame_message();
         fragment_message();
+#if Z_FEATURE_FRAGMENTATION == 1
+        defragmentation();
+#endif
         transport_message();
 
         // Scouting messages
         scouting_message();
+
+        // Serial frames
+        serial_frame();
     }
 
     return 0;
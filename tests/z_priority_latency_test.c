@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+
+#define LOCATOR "udp/224.0.0.224:7447#iface=lo"
+#define RT_SAMPLES 1000
+#define RT_PERIOD_MS 2
+#define BULK_THREADS 3
+#if Z_FEATURE_FRAGMENTATION == 1 && Z_FEATURE_TX_PREEMPTION == 1
+#define BULK_LEN 262144  // Fragmented, real-time messages are sent between the fragments
+#else
+#define BULK_LEN 4096  // Fits in a single batch
+#endif
+
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_PUBLICATION == 1
+
+static unsigned long latency_us[RT_SAMPLES];
+static volatile _Bool bulk_running = false;
+
+void *bulk_task(void *arg) {
+    z_publisher_t pub = *(z_publisher_t *)arg;
+    uint8_t *value = (uint8_t *)malloc(BULK_LEN);
+    memset(value, 0xbb, BULK_LEN);
+    while (bulk_running == true) {
+        z_publisher_put(pub, value, BULK_LEN, NULL);
+    }
+    free(value);
+    return NULL;
+}
+
+static int cmp_ulong(const void *l, const void *r) {
+    unsigned long a = *(const unsigned long *)l;
+    unsigned long b = *(const unsigned long *)r;
+    return (a > b) - (a < b);
+}
+
+// Publish the samples one at a time and return the 99th percentile of the time they take to be sent, i.e. the time
+// spent waiting for the transport plus the time to write them on the link
+static unsigned long measure(const char *phase, z_publisher_t pub) {
+    for (uint32_t i = 0; i < RT_SAMPLES; i++) {
+        z_clock_t start = z_clock_now();
+        z_publisher_put(pub, (const uint8_t *)&i, sizeof(i), NULL);
+        latency_us[i] = z_clock_elapsed_us(&start);
+        z_sleep_ms(RT_PERIOD_MS);
+    }
+
+    qsort(latency_us, RT_SAMPLES, sizeof(latency_us[0]), cmp_ulong);
+    unsigned long p50 = latency_us[(RT_SAMPLES - 1) / 2];
+    unsigned long p99 = latency_us[((RT_SAMPLES - 1) * 99) / 100];
+    unsigned long max = latency_us[RT_SAMPLES - 1];
+    printf("%-18s: %d samples, send latency p50 %6lu us, p99 %6lu us, max %6lu us\n", phase, RT_SAMPLES, p50, p99,
+           max);
+    return p99;
+}
+
+int main(void) {
+    setvbuf(stdout, NULL, _IOLBF, 1024);
+
+    z_owned_config_t config = z_config_default();
+    zp_config_insert(z_loan(config), Z_CONFIG_MODE_KEY, z_string_make("peer"));
+    zp_config_insert(z_loan(config), Z_CONFIG_LISTEN_KEY, z_string_make(LOCATOR));
+    z_owned_session_t s = z_open(z_move(config));
+    if (!z_check(s)) {
+        printf("Unable to open the session on %s\n", LOCATOR);
+        return -1;
+    }
+    zp_start_read_task(z_loan(s), NULL);
+    zp_start_lease_task(z_loan(s), NULL);
+
+    z_publisher_options_t rt_opts = z_publisher_options_default();
+    rt_opts.priority = Z_PRIORITY_REAL_TIME;
+    rt_opts.congestion_control = Z_CONGESTION_CONTROL_BLOCK;
+    z_owned_publisher_t rt_pub = z_declare_publisher(z_loan(s), z_keyexpr("test/prio/rt"), &rt_opts);
+
+    z_publisher_options_t bulk_opts = z_publisher_options_default();
+    bulk_opts.priority = Z_PRIORITY_DATA_LOW;
+    bulk_opts.congestion_control = Z_CONGESTION_CONTROL_BLOCK;
+    z_owned_publisher_t bulk_pub = z_declare_publisher(z_loan(s), z_keyexpr("test/prio/bulk"), &bulk_opts);
+    // Same priority as the bulk publishers, for reference
+    z_owned_publisher_t probe_pub = z_declare_publisher(z_loan(s), z_keyexpr("test/prio/probe"), &bulk_opts);
+    if (!z_check(rt_pub) || !z_check(bulk_pub) || !z_check(probe_pub)) {
+        printf("Unable to declare the publishers\n");
+        return -1;
+    }
+
+    printf("Real-time send latency, %d bulk publishers of %d bytes at a lower priority\n", BULK_THREADS, BULK_LEN);
+    measure("real-time, idle", z_loan(rt_pub));
+
+    z_publisher_t bulk = z_loan(bulk_pub);
+    z_task_t tasks[BULK_THREADS];
+    bulk_running = true;
+    for (int i = 0; i < BULK_THREADS; i++) {
+        z_task_init(&tasks[i], NULL, bulk_task, &bulk);
+    }
+    z_sleep_ms(100);
+    unsigned long rt = measure("real-time, loaded", z_loan(rt_pub));
+    unsigned long probe = measure("data low, loaded", z_loan(probe_pub));
+    bulk_running = false;
+    for (int i = 0; i < BULK_THREADS; i++) {
+        z_task_join(&tasks[i]);
+    }
+
+    z_undeclare_publisher(z_move(probe_pub));
+    z_undeclare_publisher(z_move(bulk_pub));
+    z_undeclare_publisher(z_move(rt_pub));
+    zp_stop_read_task(z_loan(s));
+    zp_stop_lease_task(z_loan(s));
+    z_close(z_move(s));
+
+    if (rt >= probe) {
+        printf("The real-time samples are not sent ahead of the bulk load\n");
+        return -1;
+    }
+    return 0;
+}
+#else
+int main(void) {
+    printf(
+        "ERROR: Zenoh pico was compiled without Z_FEATURE_MULTI_THREAD or Z_FEATURE_PUBLICATION but this test "
+        "requires them.\n");
+    return -2;
+}
+#endif
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+#include "zenoh-pico/session/interest.h"
+#include "zenoh-pico/session/subscription.h"
+#include "zenoh-pico/session/utils.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_PUBLICATION == 1 && Z_FEATURE_SUBSCRIPTION == 1 && Z_FEATURE_MULTICAST_TRANSPORT == 1
+
+#define MSG_LEN 16
+
+const char *keyexpr = "test/matching/data";
+
+unsigned int datas = 0;
+void data_handler(const z_sample_t *sample, void *arg) {
+    assert(sample->payload.len == MSG_LEN);
+    (void)(sample);
+    (void)(arg);
+    datas++;
+}
+
+void local_subscriptions_test(z_session_t s) {
+    printf(">>> Local subscriptions\n");
+    uint8_t payload[MSG_LEN];
+    memset(payload, 1, MSG_LEN);
+
+    z_owned_publisher_t pub = z_declare_publisher(s, z_keyexpr(keyexpr), NULL);
+    assert(z_check(pub));
+
+    // Nothing matches: the publisher remembers it and skips local delivery
+    datas = 0;
+    assert(z_publisher_put(z_loan(pub), payload, MSG_LEN, NULL) == _Z_RES_OK);
+    assert(datas == 0);
+    assert(_z_publisher_has_local_subscriptions(z_loan(pub)._val) == false);
+
+    // A subscription declared afterwards gets the very next sample
+    z_owned_closure_sample_t callback = z_closure(data_handler, NULL, NULL);
+    z_owned_subscriber_t sub = z_declare_subscriber(s, z_keyexpr(keyexpr), z_move(callback), NULL);
+    assert(z_check(sub));
+    assert(_z_publisher_has_local_subscriptions(z_loan(pub)._val) == true);
+    assert(z_publisher_put(z_loan(pub), payload, MSG_LEN, NULL) == _Z_RES_OK);
+    assert(datas == 1);
+
+    // And none once it is undeclared
+    z_undeclare_subscriber(z_move(sub));
+    assert(z_publisher_put(z_loan(pub), payload, MSG_LEN, NULL) == _Z_RES_OK);
+    assert(datas == 1);
+    assert(_z_publisher_has_local_subscriptions(z_loan(pub)._val) == false);
+
+    z_undeclare_publisher(z_move(pub));
+}
+
+#if Z_FEATURE_INTEREST == 1
+#define SUB_ID 7
+#define PEER_A 1
+#define PEER_B 2
+
+// Handle a subscriber declaration as if it had just been received from a peer
+void remote_declare(_z_session_t *zn, uint16_t peer, _Bool declare) {
+    _z_keyexpr_t key = _z_rname(keyexpr);
+    _z_declaration_t declaration;
+    if (declare == true) {
+        _z_keyexpr_t owned = _z_keyexpr_duplicate(key);
+        declaration = _z_make_decl_subscriber(&owned, SUB_ID, true, false);
+    } else {
+        declaration = _z_make_undecl_subscriber(SUB_ID, &key);
+    }
+    _z_network_message_t n_msg = _z_n_msg_make_declare(declaration);
+    assert(_z_handle_network_message(zn, &n_msg, peer) == _Z_RES_OK);
+}
+
+void remote_subscribers_test(z_session_t s) {
+    printf(">>> Remote subscribers\n");
+    _z_session_t *zn = &s._val.in->val;
+
+    z_owned_publisher_t pub = z_declare_publisher(s, z_keyexpr(keyexpr), NULL);
+    assert(z_check(pub));
+    assert(zp_publisher_has_matching_subscribers(z_loan(pub)) == false);
+
+    // Two peers declare a subscriber with the same id: each one is kept on its own
+    remote_declare(zn, PEER_A, true);
+    assert(zp_publisher_has_matching_subscribers(z_loan(pub)) == true);
+    remote_declare(zn, PEER_B, true);
+    assert(zp_publisher_has_matching_subscribers(z_loan(pub)) == true);
+
+    // The undeclaration of one peer leaves the subscriber of the other
+    remote_declare(zn, PEER_A, false);
+    assert(zp_publisher_has_matching_subscribers(z_loan(pub)) == true);
+
+    // And the subscribers of a dropped peer are gone with it
+    _z_unregister_remote_subscribers_for_peer(zn, PEER_B);
+    assert(zp_publisher_has_matching_subscribers(z_loan(pub)) == false);
+
+    // Both ways out work the other way round too
+    remote_declare(zn, PEER_A, true);
+    remote_declare(zn, PEER_B, true);
+    _z_unregister_remote_subscribers_for_peer(zn, PEER_A);
+    assert(zp_publisher_has_matching_subscribers(z_loan(pub)) == true);
+    remote_declare(zn, PEER_B, false);
+    assert(zp_publisher_has_matching_subscribers(z_loan(pub)) == false);
+
+    z_undeclare_publisher(z_move(pub));
+}
+#endif
+
+int main(int argc, char **argv) {
+    setvbuf(stdout, NULL, _IOLBF, 1024);
+    const char *locator = (argc > 1) ? argv[1] : "udp/224.0.0.224:7447#iface=lo";
+
+    z_owned_config_t config = z_config_default();
+    zp_config_insert(z_loan(config), Z_CONFIG_MODE_KEY, z_string_make("peer"));
+    zp_config_insert(z_loan(config), Z_CONFIG_LISTEN_KEY, z_string_make(locator));
+    z_owned_session_t s = z_open(z_move(config));
+    assert(z_check(s));
+
+    local_subscriptions_test(z_loan(s));
+#if Z_FEATURE_INTEREST == 1
+    remote_subscribers_test(z_loan(s));
+#endif
+
+    z_close(z_move(s));
+    return 0;
+}
+#else
+int main(void) {
+    printf(
+        "ERROR: Zenoh pico was compiled without Z_FEATURE_PUBLICATION, Z_FEATURE_SUBSCRIPTION or "
+        "Z_FEATURE_MULTICAST_TRANSPORT but this test requires it.\n");
+    return -2;
+}
+#endif
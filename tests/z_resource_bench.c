@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zenoh-pico/net/session.h"
+#include "zenoh-pico/session/resource.h"
+#include "zenoh-pico/system/platform.h"
+
+#include "z_bench.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#define LOOKUPS 1000000
+
+// Linear scan over a resource list, i.e. the lookup the resource table replaces
+static _z_resource_t *list_get_resource_by_id(_z_resource_list_t *xs, uint16_t mapping, uint16_t id) {
+    while (xs != NULL) {
+        _z_resource_t *r = _z_resource_list_head(xs);
+        if (r->_id == id && _z_keyexpr_mapping_id(&r->_key) == mapping) {
+            return r;
+        }
+        xs = _z_resource_list_tail(xs);
+    }
+    return NULL;
+}
+
+static _z_resource_t *list_get_resource_by_key(_z_resource_list_t *xs, const _z_keyexpr_t *keyexpr) {
+    uint16_t mapping = _z_keyexpr_mapping_id(keyexpr);
+    while (xs != NULL) {
+        _z_resource_t *r = _z_resource_list_head(xs);
+        if ((r->_key._id == keyexpr->_id) && _z_keyexpr_mapping_id(&r->_key) == mapping &&
+            (_z_str_eq(r->_key._suffix, keyexpr->_suffix) == true)) {
+            return r;
+        }
+        xs = _z_resource_list_tail(xs);
+    }
+    return NULL;
+}
+
+static void bench(_z_session_t *zn, size_t n) {
+    // Declare a common prefix, then n resources on top of it, so that expanding a key takes two hops
+    _z_keyexpr_t prefix = {._id = Z_RESOURCE_ID_NONE, ._mapping = _z_keyexpr_mapping(0, false), ._suffix = "bench"};
+    uint16_t prefix_id = (uint16_t)_z_register_resource(zn, prefix, 0, _Z_KEYEXPR_MAPPING_LOCAL);
+    assert(prefix_id != Z_RESOURCE_ID_NONE);
+
+    uint16_t *ids = (uint16_t *)malloc(n * sizeof(uint16_t));
+    char(*suffixes)[32] = malloc(n * sizeof(*suffixes));
+    for (size_t i = 0; i < n; i++) {
+        snprintf(suffixes[i], sizeof(suffixes[i]), "/res/%zu", i);
+        _z_keyexpr_t key = {._id = prefix_id, ._mapping = _z_keyexpr_mapping(0, false), ._suffix = suffixes[i]};
+        ids[i] = (uint16_t)_z_register_resource(zn, key, 0, _Z_KEYEXPR_MAPPING_LOCAL);
+        assert(ids[i] != Z_RESOURCE_ID_NONE);
+    }
+    assert(_z_resource_table_len(&zn->_local_resources) == n + 1);
+
+    // Mirror the table into a list, in declaration order as the session used to keep them
+    _z_resource_list_t *list = NULL;
+    list = _z_resource_list_push(list, _z_get_resource_by_id(zn, _Z_KEYEXPR_MAPPING_LOCAL, prefix_id));
+    for (size_t i = 0; i < n; i++) {
+        list = _z_resource_list_push(list, _z_get_resource_by_id(zn, _Z_KEYEXPR_MAPPING_LOCAL, ids[i]));
+    }
+
+    // Check both lookups agree before timing them
+    for (size_t i = 0; i < n; i++) {
+        _z_keyexpr_t key = {._id = prefix_id, ._mapping = _z_keyexpr_mapping(0, false), ._suffix = suffixes[i]};
+        _z_resource_t *r = __unsafe_z_get_resource_by_id(zn, _Z_KEYEXPR_MAPPING_LOCAL, ids[i]);
+        assert(r != NULL);
+        assert(r == list_get_resource_by_id(list, _Z_KEYEXPR_MAPPING_LOCAL, ids[i]));
+        assert(r == _z_get_resource_by_key(zn, &key));
+        assert(r == list_get_resource_by_key(list, &key));
+    }
+
+    volatile uintptr_t sink = 0;
+    z_clock_t start = z_clock_now();
+    for (unsigned long i = 0; i < LOOKUPS; i++) {
+        sink ^= (uintptr_t)list_get_resource_by_id(list, _Z_KEYEXPR_MAPPING_LOCAL, ids[i % n]);
+    }
+    double list_id = elapsed_ns_per_op(&start, LOOKUPS);
+
+    start = z_clock_now();
+    for (unsigned long i = 0; i < LOOKUPS; i++) {
+        sink ^= (uintptr_t)__unsafe_z_get_resource_by_id(zn, _Z_KEYEXPR_MAPPING_LOCAL, ids[i % n]);
+    }
+    double table_id = elapsed_ns_per_op(&start, LOOKUPS);
+
+    start = z_clock_now();
+    for (unsigned long i = 0; i < LOOKUPS; i++) {
+        _z_keyexpr_t key = {._id = prefix_id, ._mapping = _z_keyexpr_mapping(0, false), ._suffix = suffixes[i % n]};
+        sink ^= (uintptr_t)list_get_resource_by_key(list, &key);
+    }
+    double list_key = elapsed_ns_per_op(&start, LOOKUPS);
+
+    start = z_clock_now();
+    for (unsigned long i = 0; i < LOOKUPS; i++) {
+        _z_keyexpr_t key = {._id = prefix_id, ._mapping = _z_keyexpr_mapping(0, false), ._suffix = suffixes[i % n]};
+        sink ^= (uintptr_t)_z_resource_table_get_by_key(&zn->_local_resources, &key);
+    }
+    double table_key = elapsed_ns_per_op(&start, LOOKUPS);
+
+    start = z_clock_now();
+    for (unsigned long i = 0; i < LOOKUPS; i++) {
+        _z_keyexpr_t key = {._id = ids[i % n], ._mapping = _z_keyexpr_mapping(0, false), ._suffix = NULL};
+        _z_keyexpr_t expanded = __unsafe_z_get_expanded_key_from_key(zn, &key);
+        sink ^= (uintptr_t)expanded._suffix;
+        _z_keyexpr_clear(&expanded);
+    }
+    double table_expand = elapsed_ns_per_op(&start, LOOKUPS);
+    (void)sink;
+
+    printf("%5zu resources: by id %8.1f -> %6.1f ns, by key %8.1f -> %6.1f ns, expand %6.1f ns\n", n, list_id,
+           table_id, list_key, table_key, table_expand);
+
+    _z_list_free(&list, _z_noop_free);
+    for (size_t i = 0; i < n; i++) {
+        _z_unregister_resource(zn, ids[i], _Z_KEYEXPR_MAPPING_LOCAL);
+    }
+    _z_unregister_resource(zn, prefix_id, _Z_KEYEXPR_MAPPING_LOCAL);
+    assert(_z_resource_table_len(&zn->_local_resources) == 0);
+    free(suffixes);
+    free(ids);
+}
+
+int main(void) {
+    size_t sizes[] = {10, 100, 1000};
+
+    _z_session_t zn;
+    memset(&zn, 0, sizeof(zn));
+    zn._resource_id = 1;
+    _z_resource_table_init(&zn._local_resources);
+    _z_resource_table_init(&zn._remote_resources);
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_init(&zn._mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    printf("Resource lookup, list scan -> hash table (%d lookups each)\n", LOOKUPS);
+    for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+        bench(&zn, sizes[i]);
+    }
+
+    _z_flush_resources(&zn);
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_free(&zn._mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+
+    return 0;
+}
@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zenoh-pico/api/primitives.h"
+#include "zenoh-pico/api/types.h"
+#include "zenoh-pico/net/session.h"
+#include "zenoh-pico/protocol/codec/network.h"
+#include "zenoh-pico/protocol/codec/transport.h"
+#include "zenoh-pico/protocol/definitions/network.h"
+#include "zenoh-pico/protocol/definitions/transport.h"
+#include "zenoh-pico/session/resource.h"
+#include "zenoh-pico/session/subscription.h"
+#include "zenoh-pico/session/utils.h"
+#include "zenoh-pico/system/platform.h"
+
+#include "z_bench.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_SUBSCRIPTION == 1 && Z_RX_ARENA_SIZE > 0
+
+#define FRAMES 20000
+#define MSGS_PER_FRAME 16
+
+// The key and payload sizes of z_perf_rx, whose samples are published on a string key
+static const char *keyexpr = "test/thr";
+static const size_t sizes[] = {8, 64, 512, 1024};
+
+static unsigned long samples = 0;
+static void data_handler(const _z_sample_t *sample, void *arg) {
+    (void)(sample);
+    (void)(arg);
+    samples++;
+}
+
+// Count the allocations going through z_malloc, served by libc
+static unsigned long allocs = 0;
+static void *count_alloc(size_t size, void *ctx) {
+    (void)(ctx);
+    allocs++;
+    return malloc(size);
+}
+static void *count_realloc(void *ptr, size_t size, void *ctx) {
+    (void)(ctx);
+    allocs++;
+    return realloc(ptr, size);
+}
+static void count_free(void *ptr, void *ctx) {
+    (void)(ctx);
+    free(ptr);
+}
+
+// A frame full of pushes, as sent by z_perf_tx
+static void encode_frame(_z_wbuf_t *wbf, const uint8_t *payload, size_t len) {
+    _z_transport_message_t t_msg = _z_t_msg_make_frame_header(1, false);
+    int8_t res = _z_transport_message_encode(wbf, &t_msg);
+    assert(res == _Z_RES_OK);
+    for (size_t i = 0; i < MSGS_PER_FRAME; i++) {
+        _z_network_message_t n_msg = {
+            ._tag = _Z_N_PUSH,
+            ._body._push = {._key = _z_rname(keyexpr),
+                            ._qos = _z_n_qos_make(0, false, Z_PRIORITY_DATA),
+                            ._timestamp = _z_timestamp_null(),
+                            ._body._is_put = true,
+                            ._body._body._put = {._commons = {._timestamp = _z_timestamp_null(),
+                                                              ._source_info = _z_source_info_null()},
+                                                 ._payload = _z_bytes_wrap(payload, len),
+                                                 ._encoding = z_encoding_default()}}};
+        res = _z_network_message_encode(wbf, &n_msg);
+        assert(res == _Z_RES_OK);
+    }
+    (void)res;
+}
+
+// Handle the frame as the multicast and unicast transports do: the messages are decoded in place, one at a time, so
+// the frame is copied in the read buffer first as if it had just been received
+static void handle_frame(_z_session_t *zn, _z_zbuf_t *zbf, const _z_zbuf_t *frame) {
+    size_t len = _z_zbuf_len(frame);
+    _z_zbuf_reset(zbf);
+    (void)memcpy(_z_zbuf_get_wptr(zbf), _z_zbuf_start(frame), len);
+    _z_zbuf_set_wpos(zbf, len);
+    _z_transport_message_t t_msg;
+    int8_t res = _z_transport_message_decode(&t_msg, zbf);
+    assert(res == _Z_RES_OK);
+    while (_z_zbuf_len(&t_msg._body._frame._payload) > (size_t)0) {
+        _z_zenoh_message_t zm;
+        res = _z_frame_decode_message(&t_msg._body._frame, &zm);
+        assert(res == _Z_RES_OK);
+        _z_handle_network_message(zn, &zm, _Z_KEYEXPR_MAPPING_UNKNOWN_REMOTE);
+        _z_msg_clear(&zm);
+    }
+    _z_t_msg_clear(&t_msg);
+    (void)res;
+}
+
+static double bench(_z_session_t *zn, _z_zbuf_t *zbf, const _z_zbuf_t *frame, unsigned long *allocs_per_frame) {
+    // Warm up, then check every frame gets through before timing it
+    handle_frame(zn, zbf, frame);
+    unsigned long before = samples;
+    allocs = 0;
+    handle_frame(zn, zbf, frame);
+    assert(samples == before + MSGS_PER_FRAME);
+    *allocs_per_frame = allocs;
+
+    z_clock_t start = z_clock_now();
+    for (unsigned long i = 0; i < FRAMES; i++) {
+        handle_frame(zn, zbf, frame);
+    }
+    return elapsed_ns_per_op(&start, FRAMES * MSGS_PER_FRAME);
+}
+
+int main(void) {
+    // The allocator is set before anything is allocated
+    zp_allocator_t allocator = {.alloc_fn = count_alloc, .realloc_fn = count_realloc, .free_fn = count_free};
+    int8_t res = zp_set_allocator(&allocator);
+    assert(res == _Z_RES_OK);
+    (void)res;
+
+    _z_session_t zn;
+    memset(&zn, 0, sizeof(zn));
+    _z_resource_table_init(&zn._local_resources);
+    _z_resource_table_init(&zn._remote_resources);
+    _z_ketree_init(&zn._local_subscriptions_ketree);
+    _ZP_SHARED_SIZE_STORE(zn._subscriptions_generation, 1);
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_init(&zn._mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+    _z_arena_t arena;
+    res = _z_arena_init(&arena, Z_RX_ARENA_SIZE);
+    assert(res == _Z_RES_OK);
+
+    _z_subscription_t sub = {._key = _z_rname(keyexpr),
+                             ._id = 1,
+                             ._callback = data_handler,
+                             ._dropper = NULL,
+                             ._arg = NULL,
+                             ._info = _z_subinfo_push_default()};
+    assert(_z_register_subscription(&zn, &sub) != NULL);
+
+    printf("Sample dispatch, libc -> RX arena (%d frames of %d samples each)\n", FRAMES, MSGS_PER_FRAME);
+    for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+        uint8_t *payload = (uint8_t *)malloc(sizes[i]);
+        memset(payload, 1, sizes[i]);
+        _z_wbuf_t wbf = _z_wbuf_make(MSGS_PER_FRAME * (sizes[i] + 32), false);
+        encode_frame(&wbf, payload, sizes[i]);
+        _z_zbuf_t frame = _z_wbuf_to_zbuf(&wbf);
+        _z_zbuf_t zbf = _z_zbuf_make(_z_zbuf_len(&frame));
+
+        // Without an arena, every transient allocation goes to z_malloc
+        _z_arena_t none;
+        res = _z_arena_init(&none, 0);
+        assert(res == _Z_RES_OK);
+        zn._rx_arena = none;
+        unsigned long libc_allocs;
+        double libc = bench(&zn, &zbf, &frame, &libc_allocs);
+
+        zn._rx_arena = arena;
+        unsigned long arena_allocs;
+        double with_arena = bench(&zn, &zbf, &frame, &arena_allocs);
+        assert(arena_allocs == 0);
+        assert(arena_allocs < libc_allocs);
+
+        printf("%5zu bytes: %6.1f -> %6.1f ns/sample, %lu -> %lu allocations/frame\n", sizes[i], libc, with_arena,
+               libc_allocs, arena_allocs);
+
+        _z_zbuf_clear(&zbf);
+        _z_zbuf_clear(&frame);
+        _z_wbuf_clear(&wbf);
+        free(payload);
+    }
+
+    zn._rx_arena = arena;
+    _z_arena_clear(&zn._rx_arena);
+    _z_flush_subscriptions(&zn);
+    _z_flush_resources(&zn);
+#if Z_FEATURE_MULTI_THREAD == 1
+    z_mutex_free(&zn._mutex_inner);
+#endif  // Z_FEATURE_MULTI_THREAD == 1
+    return 0;
+}
+#else
+int main(void) {
+    printf("ERROR: Zenoh pico was compiled without Z_FEATURE_SUBSCRIPTION or an RX arena but this test requires it.\n");
+    return -2;
+}
+#endif
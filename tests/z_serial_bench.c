@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2022 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#define _XOPEN_SOURCE 600  // posix_openpt
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/system/link/serial.h"
+#include "zenoh-pico/system/platform.h"
+
+#include "z_bench.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_LINK_SERIAL == 1 && Z_FEATURE_MULTI_THREAD == 1
+#include <fcntl.h>
+#include <stdlib.h>
+
+#define BAUDRATE 115200  // Ignored by a pseudo terminal
+#define BYTES (4 * 1024 * 1024)
+
+typedef struct {
+    const _z_serial_socket_t *sock;
+    uint8_t *payload;
+    size_t len;
+    size_t frames;
+} writer_arg_t;
+
+static void *writer_task(void *ctx) {
+    writer_arg_t *arg = (writer_arg_t *)ctx;
+    for (size_t i = 0; i < arg->frames; i++) {
+        // Each frame starts with its number, so that the reader can spot a lost one
+        memcpy(arg->payload, &i, sizeof(i));
+        size_t wb = _z_send_serial(arg->sock, arg->payload, arg->len);
+        assert(wb == arg->len);
+    }
+    return NULL;
+}
+
+// Read one byte per call, as the platforms did before the bulk reads
+static size_t read_serial_bytewise(const _z_serial_socket_t *sock, uint8_t *ptr, size_t len) {
+    for (;;) {
+        uint8_t byte = 0;
+        if (_z_read_serial_internal(sock->_sock, &byte, 1) != (size_t)1) {
+            return SIZE_MAX;
+        }
+        _Bool complete = false;
+        (void)_z_serial_decoder_feed(&sock->_bufs->_dec, &byte, 1, &complete);
+        if (complete == true) {
+            return _z_serial_decoder_take(&sock->_bufs->_dec, ptr, len);
+        }
+    }
+}
+
+static double bench(const _z_serial_socket_t *tx, const _z_serial_socket_t *rx, size_t len, _Bool bytewise) {
+    uint8_t *sent = (uint8_t *)z_malloc(len);
+    uint8_t *received = (uint8_t *)z_malloc(_Z_SERIAL_MTU_SIZE);
+    z_random_fill(sent, len);
+
+    writer_arg_t arg = {.sock = tx, .payload = sent, .len = len, .frames = BYTES / len};
+    z_clock_t start = z_clock_now();
+    z_task_t writer;
+    assert(z_task_init(&writer, NULL, writer_task, &arg) == 0);
+    for (size_t i = 0; i < arg.frames; i++) {
+        size_t rb = (bytewise == true) ? read_serial_bytewise(rx, received, _Z_SERIAL_MTU_SIZE)
+                                       : _z_read_serial(rx, received, _Z_SERIAL_MTU_SIZE);
+        assert(rb == len);
+        size_t n = 0;
+        memcpy(&n, received, sizeof(n));
+        assert(n == i);
+        assert(memcmp(&received[sizeof(n)], &sent[sizeof(n)], len - sizeof(n)) == 0);
+    }
+    double mb_per_s = elapsed_mb_per_s(&start, arg.frames * len);
+    z_task_join(&writer);
+
+    z_free(received);
+    z_free(sent);
+    return mb_per_s;
+}
+
+int main(int argc, char **argv) {
+    // Either a pair of connected devices, e.g. from `socat pty,raw,echo=0 pty,raw,echo=0`, or a pseudo terminal
+    _z_serial_socket_t tx = {._bufs = NULL};
+    _z_serial_socket_t rx = {._bufs = NULL};
+    if (argc == 3) {
+        assert(_z_open_serial_from_dev(&tx._sock, argv[1], BAUDRATE) == _Z_RES_OK);
+        assert(_z_open_serial_from_dev(&rx._sock, argv[2], BAUDRATE) == _Z_RES_OK);
+    } else if (argc == 1) {
+        tx._sock._fd = posix_openpt(O_RDWR | O_NOCTTY);
+        assert(tx._sock._fd >= 0);
+        assert((grantpt(tx._sock._fd) == 0) && (unlockpt(tx._sock._fd) == 0));
+        assert(_z_open_serial_from_dev(&rx._sock, ptsname(tx._sock._fd), BAUDRATE) == _Z_RES_OK);
+    } else {
+        printf("Usage: %s [<tx device> <rx device>]\n", argv[0]);
+        return -1;
+    }
+    assert(_z_serial_buffers_init(&tx) == _Z_RES_OK);
+    assert(_z_serial_buffers_init(&rx) == _Z_RES_OK);
+
+    size_t lens[] = {16, 64, 256, 1500};
+    printf("Serial link throughput, byte reads -> bulk reads (%d MB each)\n", BYTES / (1024 * 1024));
+    for (size_t i = 0; i < ARRAY_SIZE(lens); i++) {
+        double bytewise = bench(&tx, &rx, lens[i], true);
+        double bulk = bench(&tx, &rx, lens[i], false);
+        printf("%4zu bytes: %7.1f -> %7.1f MB/s\n", lens[i], bytewise, bulk);
+    }
+
+    _z_close_serial(&rx._sock);
+    _z_close_serial(&tx._sock);
+    _z_serial_buffers_clear(&rx);
+    _z_serial_buffers_clear(&tx);
+    return 0;
+}
+#else
+int main(void) {
+    printf("ERROR: Zenoh pico was compiled without Z_FEATURE_LINK_SERIAL but this test requires it.\n");
+    return -2;
+}
+#endif